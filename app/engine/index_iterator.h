@@ -7,21 +7,22 @@
 #include <cmath>
 #include <unordered_set>
 #include "index_loader.h"
+#include "segmented_index.h"
 #include "../../index_jumps.h"
 
 using namespace std;
 
 
-Index INDEX;
-
-
 inline float DFtoIDF(float len, float maxLen) {
-    return log(maxLen / len);
+    return log(maxLen / max(len, 1.0f));
 }
 
 
 class IndexIterator {
+protected:
+    Index *index;
 public:
+    IndexIterator(Index *index) : index(index) {}
     virtual ~IndexIterator() {};
 
     virtual void next() = 0;
@@ -36,7 +37,11 @@ public:
     virtual float getRank() { return 0.0; }
 
     virtual TID getExternalId() {
-        return INDEX.getExternalId(this->get());
+        return index->getExternalId(this->get());
+    }
+
+    Index* getIndex() {
+        return index;
     }
 };
 
@@ -52,29 +57,54 @@ private:
     unsigned int prevNum;
     unsigned int prevOffset;
     float IDF;
+    // the trace is looked up once, the scan of an untraced query doesn't time its postings
+    bool traced;
+    // deleted documents are skipped here, at the leaves, so no iterator
+    // above reads their positions or TF
+    bool skipsDeleted;
+
+    void advance() {
+        curDocId += rec.get();
+        if (isJump()) {
+            rec.next();
+            rec.next();
+        }
+        curNum++;
+        rec.next();
+    }
+
+    void skipDeleted() {
+        while (!rec.end() && index->isDeleted(get())) {
+            advance();
+        }
+    }
 public:
-    SimpleIterator(TID termId) {
-        rec = INDEX.get(termId);
+    SimpleIterator(Index *index, TID termId) : IndexIterator(index) {
+        rec = index->get(termId);
         id = termId;
         prevDocId = curDocId = 0;
         prevNum = curNum = 0;
         prevOffset = 0;
         jlen = Jump::jumpLength(rec.length);
-        IDF = DFtoIDF(rec.length, MAX_DOC_ID + 1);
+        IDF = DFtoIDF(rec.length, index->getMaxDocId() + 1);
+        traced = QueryTrace::current != nullptr;
+        skipsDeleted = index->hasDeletions();
+        if (skipsDeleted) skipDeleted();
     }
 
     ~SimpleIterator() {
-        INDEX.unget(id);
+        index->unget(id);
     }
 
     void next() override {
-        curDocId += rec.get();
-        if (isJump()) {
-            rec.next();
-            rec.next();
+        if (!traced) {
+            advance();
+        } else {
+            TracePhase phase(QueryTrace::DECODE);
+            TRACE_COUNT(postingsDecoded, isJump() ? 3 : 1);
+            advance();
         }
-        curNum++;
-        rec.next();
+        if (skipsDeleted) skipDeleted();
     }
 
     bool end() override {
@@ -90,9 +120,9 @@ public:
     }
 
     float getRank() override {
-        unsigned int tf = INDEX.getTF(get(), id);
+        unsigned int tf = index->getTF(get(), id);
         return tf == 0 ? 0 : 1 + log(tf);
-        // return log(1 + INDEX.getTF(get(), id)) * IDF;
+        // return log(1 + index->getTF(get(), id)) * IDF;
     }
 
     bool isJump() override { 
@@ -100,6 +130,9 @@ public:
     }
 
     void jump() override {
+        TracePhase phase(QueryTrace::DECODE);
+        TRACE_COUNT(jumps, 1);
+        TRACE_COUNT(postingsDecoded, 3);
         prevOffset = rec.getOffset();
         prevDocId = curDocId;
         prevNum = curNum;
@@ -114,9 +147,12 @@ public:
         rec.setOffset(rec.getOffset() + tmp);
 
         curNum += jlen;
+        if (skipsDeleted) skipDeleted();
     }
 
     void rollback() override {
+        TracePhase phase(QueryTrace::DECODE);
+        TRACE_COUNT(rollbacks, 1);
         rec.setOffset(prevOffset);
         curDocId = prevDocId;
         curNum = prevNum;
@@ -131,16 +167,26 @@ private:
     float TF_IDF;
     static const unsigned int NOT_TF = 10;
 public:
-    NotIterator(IndexIterator *iter) {
+    NotIterator(IndexIterator *iter) : IndexIterator(iter->getIndex()) {
         id = 0;
         this->iter = iter;
+        skip();
+
+        TF_IDF = NOT_TF * DFtoIDF(iter->len(), index->getMaxDocId() + 1);
+    }
 
-        while (!iter->end() && id == iter->get()) {
+    /* Moves id to the first live document not in iter, deleted ones are skipped by words */
+    void skip() {
+        while (true) {
+            id = index->nextLive(id);
+            while (!iter->end() && iter->get() < id) {
+                iter->next();
+            }
+            if (iter->end() || iter->get() != id) {
+                break;
+            }
             id++;
-            iter->next();
         }
-
-        TF_IDF = NOT_TF * DFtoIDF(iter->len(), MAX_DOC_ID + 1);
     }
 
     ~NotIterator() {
@@ -151,15 +197,11 @@ public:
 
     void next() override {
         id++;
-
-        while (!iter->end() && id == iter->get()) {
-            id++;
-            iter->next();
-        }
+        skip();
     }
 
     bool end() override {
-        return id > MAX_DOC_ID;
+        return id > index->getMaxDocId();
     }
 
     TID get() override {
@@ -167,7 +209,7 @@ public:
     }
 
     unsigned int len() override {
-        return max((unsigned int)0, MAX_DOC_ID - iter->len() + 1);
+        return max((unsigned int)0, index->getMaxDocId() - iter->len() + 1);
     }
 
     float getRank() override {
@@ -181,9 +223,10 @@ private:
     IndexIterator *a;
     IndexIterator *b;
 public:
-    AndIterator(IndexIterator *first, IndexIterator *second) {
+    AndIterator(IndexIterator *first, IndexIterator *second) : IndexIterator(first->getIndex()) {
         a = first;
         b = second;
+        TracePhase phase(QueryTrace::INTERSECT);
         while (!end() && a->get() != b->get()) {
             if (a->get() > b->get()) {
                 swap(a, b);
@@ -255,7 +298,7 @@ private:
     IndexIterator *a;
     IndexIterator *b;
 public:
-    OrIterator(IndexIterator *first, IndexIterator *second) {
+    OrIterator(IndexIterator *first, IndexIterator *second) : IndexIterator(first->getIndex()) {
         a = first;
         b = second;
     }
@@ -302,7 +345,7 @@ public:
     }
 
     unsigned int len() override {
-        return min(a->len() + b->len(), MAX_DOC_ID + 1);
+        return min(a->len() + b->len(), index->getMaxDocId() + 1);
     }
 
     float getRank() override {
@@ -328,15 +371,28 @@ public:
 };
 
 
+/*
+ * Documents with the terms in this order within dist positions. Postings
+ * of biwords of adjacent terms, if the quote is an exact phrase, narrow
+ * the documents down before positions are read. A quote of two terms
+ * with a biword doesn't read positions at all: TF of the biword is the
+ * number of matches.
+ */
 class QuoteIterator : public IndexIterator {
 private:
     vector<TID> ids;
     set<TID> uniqTerms;
     unsigned int dist;
     IndexIterator *docIter;
+    IndexIterator *candidates;
+    TID pairBiword;
     unsigned int lastOkResult;
+
+    unsigned int matches(TID docId) {
+        return pairBiword == Index::NO_BIWORD ? ok(docId) : index->getTF(docId, pairBiword);
+    }
 public:
-    QuoteIterator(vector<TID> terms, unsigned int distance) {
+    QuoteIterator(Index *index, vector<TID> terms, unsigned int distance, const vector<TID> &biwordIds = {}) : IndexIterator(index) {
         assert(terms.size() >= 2);
 
         ids = terms;
@@ -344,50 +400,58 @@ public:
 
         uniqTerms = set<TID>(terms.begin(), terms.end());
         auto curId = uniqTerms.begin();
-        docIter = new SimpleIterator(*curId);
+        docIter = new SimpleIterator(index, *curId);
         ++curId;
         while (curId != uniqTerms.end()) {
-            docIter = new AndIterator(docIter, new SimpleIterator(*curId));
+            docIter = new AndIterator(docIter, new SimpleIterator(index, *curId));
             ++curId;
         }
 
-        while (!docIter->end()) {
-            lastOkResult = ok(docIter->get());
+        // docIter stays inside candidates for the rank of terms
+        candidates = docIter;
+        for (TID biwordId : biwordIds) {
+            candidates = new AndIterator(candidates, new SimpleIterator(index, biwordId));
+        }
+        pairBiword = terms.size() == 2 && biwordIds.size() == 1 ? biwordIds[0] : Index::NO_BIWORD;
+
+        TracePhase phase(QueryTrace::INTERSECT);
+        while (!candidates->end()) {
+            lastOkResult = matches(candidates->get());
             if (lastOkResult != 0) {
                 break;
             }
-            docIter->next();
+            candidates->next();
         }
     }
 
     ~QuoteIterator() {
-        if (docIter) delete docIter;
+        if (candidates) delete candidates;
     }
 
     void next() override {
-        docIter->next();
-        while (!docIter->end()) {
-            lastOkResult = ok(docIter->get());
+        candidates->next();
+        while (!candidates->end()) {
+            lastOkResult = matches(candidates->get());
             if (lastOkResult != 0) {
                 break;
             }
-            docIter->next();
+            candidates->next();
         }
     }
 
     bool end() override {
-        return docIter->end();
+        return candidates->end();
     }
 
     TID get() override {
-        if (docIter->end()) {
+        if (candidates->end()) {
             cerr << "ERROR: QuoteIterator go over bound" << endl;
         }
-        return docIter->get();
+        return candidates->get();
     }
 
     unsigned int len() override {
-        return docIter->len();
+        return candidates->len();
     }
 
     float getRank() override {
@@ -396,9 +460,10 @@ public:
     }
 
     unsigned int ok(TID docId) {
+        TracePhase phase(QueryTrace::POSITIONS);
         unsigned int result = 0;
 
-        auto allPositions = INDEX.getPositions(docId);
+        auto allPositions = index->getPositions(docId, &uniqTerms);
         auto &v = allPositions.terms;
         map<TID, unsigned int> pos;
 
@@ -452,96 +517,281 @@ public:
 };
 
 
+/* Quote with the postings of biwords of the index, they are only used for exact phrases */
+inline IndexIterator* newQuoteIterator(Index *index, const vector<TID> &terms, unsigned int dist) {
+    vector<TID> biwordIds;
+    if (dist == terms.size()) {
+        for (size_t i = 1; i < terms.size(); i++) {
+            TID biwordId = index->getBiword(terms[i - 1], terms[i]);
+            if (biwordId != Index::NO_BIWORD) {
+                biwordIds.push_back(biwordId);
+            }
+        }
+    }
+    return new QuoteIterator(index, terms, dist, biwordIds);
+}
+
+
+/*
+ * Iterators over the segments one after another, doc ids of a segment
+ * are shifted by its base.
+ */
+class ConcatIterator : public IndexIterator {
+private:
+    vector<IndexIterator*> iters;
+    vector<TID> bases;
+    size_t cur;
+
+    void skipEnded() {
+        while (cur < iters.size() && iters[cur]->end()) {
+            cur++;
+        }
+    }
+public:
+    ConcatIterator(const vector<IndexIterator*> &iters, const vector<TID> &bases) :
+        IndexIterator(iters.front()->getIndex()), iters(iters), bases(bases), cur(0)
+    {
+        skipEnded();
+    }
+
+    ~ConcatIterator() {
+        for (auto i : iters) {
+            delete i;
+        }
+    }
+
+    void next() override {
+        iters[cur]->next();
+        skipEnded();
+    }
+
+    bool end() override {
+        return cur == iters.size();
+    }
+
+    TID get() override {
+        return bases[cur] + iters[cur]->get();
+    }
+
+    unsigned int len() override {
+        unsigned int res = 0;
+        for (auto i : iters) {
+            res += i->len();
+        }
+        return res;
+    }
+
+    float getRank() override {
+        return iters[cur]->getRank();
+    }
+
+    TID getExternalId() override {
+        return iters[cur]->getExternalId();
+    }
+};
+
+
+/*
+ * Ranked results of the query page by page. In the lazy mode a level is
+ * scanned only as far as the page needs: every page is the best PAGE_SIZE
+ * of PAGE_CANDIDATES unserved candidates, and the iterator of the level
+ * stays open so the next page resumes the scan. The ranking has no score
+ * bound per list, so a document further in the level can rank below a
+ * worse one of an earlier page; the full mode ranks the whole level first.
+ */
 class RankDecorator {
 private:
     const int MAX_RES_NUM = 500;
-
-    vector<pair<TID, float>> result;
+    const int PAGE_SIZE = 50;
+    const int PAGE_CANDIDATES = 4 * PAGE_SIZE;
+
+    // Candidates of the current level as (rank, external id). Only the
+    // prefix [0, sorted) is ordered, the rest is ordered page by page
+    // when the reader gets to it.
+    vector<pair<float, TID>> result;
+    unsigned int sorted;
     unsigned int pos;
 
+    SegmentedIndex *index;
     vector<TID> ids;
     int quoteLen;
     unordered_set<TID> used;
 
+    bool lazy;
+    // Iterator of the current level while the lazy scan isn't over
+    IndexIterator *levelIter;
+
+    static bool better(const pair<float, TID> &a, const pair<float, TID> &b) {
+        return a > b;
+    }
+
+    void shrinkResult() {
+        nth_element(result.begin(), result.begin() + MAX_RES_NUM - 1, result.end(), better);
+        result.resize(MAX_RES_NUM);
+    }
+
+    /* Iterator of the current relaxation level over one segment */
+    IndexIterator* getLevelIterator(Index *index) {
+        IndexIterator *iter = nullptr;
+        if (quoteLen == 0) {
+            iter = new SimpleIterator(index, ids.front());
+            for (int i = 1; i < ids.size(); i++) {
+                iter = new OrIterator(iter, new SimpleIterator(index, ids[i]));
+            }
+        } else if (quoteLen == 1) {
+            iter = new SimpleIterator(index, ids.front());
+            for (int i = 1; i < ids.size(); i++) {
+                iter = new AndIterator(iter, new SimpleIterator(index, ids[i]));
+            }
+        } else if (quoteLen > 1) {
+            for (int start = 0; start + quoteLen - 1 < ids.size(); start++) {
+                vector<TID> quote;
+                for (auto i = start; i < start + quoteLen; i++) {
+                    quote.push_back(ids[i]);
+                }
+
+                auto tmp = newQuoteIterator(index, quote, quote.size());
+                if (!iter) iter = tmp;
+                else iter = new AndIterator(iter, tmp);
+            }
+        } else {
+            cout << "ERROR: quoteLen out of domain" << endl;
+        }
+        return iter;
+    }
+
+    void sortPage() {
+        TracePhase phase(QueryTrace::RANK);
+        unsigned int last = min<size_t>(sorted + PAGE_SIZE, result.size());
+        partial_sort(result.begin() + sorted, result.begin() + last, result.end(), better);
+        sorted = last;
+    }
+
+    // Intersection is timed apart from ranking only in a traced query,
+    // the phase is too costly to open for every document otherwise
+    static void advance(IndexIterator *iter) {
+        if (QueryTrace::current) {
+            TracePhase phase(QueryTrace::INTERSECT);
+            iter->next();
+        } else {
+            iter->next();
+        }
+    }
+
+    /* Lazy mode: scans the level until the page has its candidates, the level gives MAX_RES_NUM at most */
+    void scanLevel() {
+        TracePhase phase(QueryTrace::RANK);
+        while (!levelIter->end() && result.size() < MAX_RES_NUM && result.size() - sorted < PAGE_CANDIDATES) {
+            pair<float, TID> cur(levelIter->getRank(), levelIter->getExternalId());
+            if (used.insert(cur.second).second) {
+                result.push_back(cur);
+            }
+            TRACE_COUNT(docsScored, 1);
+            advance(levelIter);
+        }
+
+        if (levelIter->end() || result.size() == MAX_RES_NUM) {
+            delete levelIter;
+            levelIter = nullptr;
+        }
+    }
+
+    /* Orders the page from pos on, the lazy scan goes on first */
+    void fillPage() {
+        if (levelIter) {
+            scanLevel();
+        }
+        if (sorted < result.size()) {
+            sortPage();
+        }
+    }
+
     void initByIndexIterator(IndexIterator *iter) {
         result.clear();
+        sorted = 0;
         pos = 0;
 
-        set<pair<float, TID>> s;
+        if (lazy) {
+            levelIter = iter;
+            fillPage();
+            return;
+        }
+
+        TracePhase phase(QueryTrace::RANK);
+
+        // Until the buffer overflows for the first time every candidate is
+        // kept; after that only ones better than the current MAX_RES_NUM-th.
+        bool hasThreshold = false;
+        pair<float, TID> threshold;
 
         while (!iter->end()) {
-            if (used.count(iter->getExternalId()) == 0) {
-                s.emplace(iter->getRank(), iter->getExternalId());
-                if (s.size() > MAX_RES_NUM) s.erase(s.begin());
+            pair<float, TID> cur(iter->getRank(), iter->getExternalId());
+            if ((!hasThreshold || better(cur, threshold)) && used.count(cur.second) == 0) {
+                result.push_back(cur);
+                if (result.size() == 2 * MAX_RES_NUM) {
+                    shrinkResult();
+                    threshold = result.back();
+                    hasThreshold = true;
+                }
             }
-            iter->next();
+            TRACE_COUNT(docsScored, 1);
+            advance(iter);
         }
 
         delete iter;
 
-        auto i = s.end();
+        if (result.size() > MAX_RES_NUM) {
+            shrinkResult();
+        }
 
-        while (i != s.begin()) {
-            i = prev(i);
-            result.emplace_back(i->second, i->first);
-            used.insert(i->second);
+        for (auto &i : result) {
+            used.insert(i.second);
         }
+
+        sortPage();
     }
 public:
-    RankDecorator(IndexIterator *iter) {
-        initByIndexIterator(iter);
+    RankDecorator(IndexIterator *iter, bool lazy = false) : lazy(lazy), levelIter(nullptr) {
+        index = nullptr;
         quoteLen = -1;
+        initByIndexIterator(iter);
     }
 
-    RankDecorator(const vector<TID> &ids) {
-        if (ids.size() == 1) {
-            initByIndexIterator(new SimpleIterator(ids.front()));
-            quoteLen = -1;
-            return;
-        }
-
+    RankDecorator(SegmentedIndex *index, const vector<TID> &ids, bool lazy = false) : lazy(lazy), levelIter(nullptr) {
+        this->index = index;
         this->ids = ids;
-        quoteLen = ids.size();
+        quoteLen = ids.size() == 1 ? 0 : ids.size();
+        sorted = pos = 0;
 
         while (!end() && result.size() == 0) {
             next();
         }
     }
 
-    ~RankDecorator() {}
+    RankDecorator(const RankDecorator&) = delete;
+    RankDecorator& operator=(const RankDecorator&) = delete;
+
+    ~RankDecorator() {
+        if (levelIter) delete levelIter;
+    }
 
     void next() {
         ++pos;
 
+        if (pos == sorted) {
+            fillPage();
+        }
+
         if (pos >= result.size() && quoteLen > -1) {
-            IndexIterator *iter = nullptr;
-            if (quoteLen == 0) {
-                iter = new SimpleIterator(ids.front());
-                for (int i = 1; i < ids.size(); i++) {
-                    iter = new OrIterator(iter, new SimpleIterator(ids[i]));
-                }
-            } else if (quoteLen == 1) {
-                iter = new SimpleIterator(ids.front());
-                for (int i = 1; i < ids.size(); i++) {
-                    iter = new AndIterator(iter, new SimpleIterator(ids[i]));
-                }
-            } else if (quoteLen > 1) {
-                for (int start = 0; start + quoteLen - 1 < ids.size(); start++) {
-                    vector<TID> quote;
-                    for (auto i = start; i < start + quoteLen; i++) {
-                        quote.push_back(ids[i]);
-                    }
-
-                    auto tmp = new QuoteIterator(quote, quote.size());
-                    if (!iter) iter = tmp;
-                    else iter = new AndIterator(iter, tmp);
-                }
-            } else {
-                cout << "ERROR: quoteLen out of domain" << endl;
+            vector<IndexIterator*> iters;
+            vector<TID> bases;
+            for (size_t i = 0; i < index->size(); i++) {
+                iters.push_back(getLevelIterator(index->segment(i)));
+                bases.push_back(index->base(i));
             }
 
             // cout << "quoteLen = " << quoteLen << endl;
-            initByIndexIterator(iter);
+            initByIndexIterator(iters.size() == 1 ? iters.front() : new ConcatIterator(iters, bases));
             quoteLen--;
         }
 
@@ -551,12 +801,12 @@ public:
     }
 
     bool end() {
-        return pos >= result.size() && quoteLen == -1;
+        return pos >= result.size() && quoteLen == -1 && !levelIter;
     }
 
     TID get() {
-        // cout << result[pos].first << " has rank " << result[pos].second << endl;
-        return result[pos].first;
+        // cout << result[pos].second << " has rank " << result[pos].first << endl;
+        return result[pos].second;
     }
 
     unsigned int len() {
@@ -2,6 +2,7 @@
 
 #include <string>
 #include <cstdio>
+#include <cstring>
 #include <map>
 #include <unordered_map>
 #include <set>
@@ -10,6 +11,13 @@
 #include <fstream>
 #include <sstream>
 #include "compressed_data_stream.h"
+#include "mapped_file.h"
+#include "live_docs.h"
+#include "query_trace.h"
+#include "metrics.h"
+#include "../../index_manifest.h"
+#include "../../index_deletions.h"
+#include "../../index_biwords.h"
 
 using namespace std;
 
@@ -17,7 +25,6 @@ using TID = unsigned int;
 
 
 const string WORK_DIR("/home/krik-standard/wiki_index/");
-const TID MAX_DOC_ID = 1476244;
 
 const size_t MAX_INDEX_FILES_NUM = 100;
 const size_t RECORDS_PER_FILE = 100000;
@@ -37,8 +44,10 @@ private:
 public:
     unsigned int length;
 
+    /* Record of a term without postings, a segment may have none */
     IndexRecord() {
         stream = nullptr;
+        length = 0;
     }
 
     IndexRecord(FILE *fin) {
@@ -63,7 +72,7 @@ public:
     }
 
     IndexRecord(const IndexRecord &other) {
-        stream = other.stream->copy();
+        stream = other.stream ? other.stream->copy() : nullptr;
         length = other.length;
     }
 
@@ -75,7 +84,7 @@ public:
         if (stream) {
             delete stream;
         }
-        stream = other.stream->copy();
+        stream = other.stream ? other.stream->copy() : nullptr;
         length = other.length;
         return *this;
     }
@@ -89,7 +98,7 @@ public:
     }
 
     bool end() {
-        return stream->end();
+        return !stream || stream->end();
     }
 
     void clear() {
@@ -162,7 +171,12 @@ struct DocTermPositions {
 
     DocTermPositions() {}
 
-    DocTermPositions(TID id, FILE *fin) {
+    /*
+     * Record of the doc at p of a positions file read into memory, p goes
+     * past it. Only the terms of the set are decoded if there is one, the
+     * others are skipped.
+     */
+    DocTermPositions(TID id, const int8_t *&p, const int8_t *end, const set<TID> *only = nullptr) {
         docId = id;
         TID termId;
         unsigned int termNum;
@@ -171,20 +185,29 @@ struct DocTermPositions {
         int codecType;
         CompressedDataStream<unsigned int> *stream;
 
-        fread(&termNum, sizeof(unsigned int), 1, fin);
+        if (!read(p, end, termNum)) return;
 
-        terms.reserve(termNum);
+        terms.reserve(only ? only->size() : termNum);
 
         for (int i = 0; i < termNum; i++) {
-            fread(&termId, sizeof(TID), 1, fin);
-            fread(&bitCnt, sizeof(unsigned int), 1, fin);
+            if (!read(p, end, termId) || !read(p, end, bitCnt)) return;
 
             codecType = bitCnt >> (sizeof(unsigned int) * 8 - 1);
-            bitCnt &= (1 << (sizeof(unsigned int) * 8 - 1)) - 1;
+            bitCnt &= (1u << (sizeof(unsigned int) * 8 - 1)) - 1;
             size = (bitCnt + sizeof(int8_t) * 8 - 1) / (sizeof(int8_t) * 8);
 
+            if (size > end - p) {
+                p = end;
+                return;
+            }
+            if (only && only->count(termId) == 0) {
+                p += size;
+                continue;
+            }
+
             int8_t *data = new int8_t[size];
-            fread(data, sizeof(int8_t), size, fin);
+            memcpy(data, p, size);
+            p += size;
 
             if (codecType == 0) {
                 stream = new VBDataStream<unsigned int>(data, size);
@@ -202,43 +225,74 @@ struct DocTermPositions {
         }
     }
 
-    static void skip(FILE *fin) {
-        TID termId;
-        unsigned int termNum;
-        unsigned int bitCnt;
-        unsigned int size;
-
-        fread(&termNum, sizeof(unsigned int), 1, fin);
-
-        for (int i = 0; i < termNum; i++) {
-            fread(&termId, sizeof(TID), 1, fin);
-            fread(&bitCnt, sizeof(unsigned int), 1, fin);
-
-            bitCnt &= (1 << (sizeof(unsigned int) * 8 - 1)) - 1;
-            size = (bitCnt + sizeof(int8_t) * 8 - 1) / (sizeof(int8_t) * 8);
+    static bool read(const int8_t *&p, const int8_t *end, unsigned int &x) {
+        if (end - p < (long)sizeof(unsigned int)) return false;
+        memcpy(&x, p, sizeof(unsigned int));
+        p += sizeof(unsigned int);
+        return true;
+    }
 
-            fseek(fin, sizeof(int8_t) * size, SEEK_CUR);
-        }
+    static void skip(const int8_t *&p, const int8_t *end) {
+        static const set<TID> none;
+        DocTermPositions(0, p, end, &none);
     }
 };
 
 
 class Index {
+public:
+    static const TID NO_BIWORD = -1;
 private:
+    string workDir;
+    bool loaded;
+    TID maxDocId;
+
+    bool hasManifest;
+    Manifest::Header manifest;
+
     size_t recordsNum;
+    size_t recordsPerFile;
+    size_t docsPerFile;
+    size_t posFilesPerDir;
     vector<string> indexFiles;
     map<TID, size_t> usageCnt;
     map<TID, IndexRecord> records;
 
     static const int MAX_DOC_TF_CACHE_SIZE = 100000;
-    vector<unsigned int> TFOffsets;
+    // Tree node of a cached tf: the pair, pointers and the color
+    static const size_t TF_ENTRY_BYTES = sizeof(pair<const TID, unsigned int>) + 32;
+    MappedFile TFOffsetsFile;
+    vector<unsigned int> TFOffsetsData;
+    const unsigned int *TFOffsets;
     map<TID, map<TID, unsigned int>> docTermTF;
     FILE *finTF;
 
-    vector<TID> externalIds;
+    MappedFile externalIdsFile;
+    vector<TID> externalIdsData;
+    const TID *externalIds;
+    size_t docsNum;
+
+    LiveDocs liveDocs;
+
+    unordered_map<uint64_t, TID> biwords;
+
+    vector<int8_t> positionsBuffer;
+
+    // Memory of the gauges, taken back when the index goes
+    int64_t postingsBytes;
+    int64_t tfCacheBytes;
+    int64_t arraysBytes;
 
     void loadDocId(unsigned int file) {
+        TracePhase phase(QueryTrace::LOAD_POSTINGS);
+        if (file >= indexFiles.size()) {
+            return;
+        }
         FILE *fin = fopen(indexFiles[file].c_str(), "rb");
+        if (!fin) {
+            cerr << "ERROR: Can't open index file '" << indexFiles[file] << "'" << endl;
+            return;
+        }
 
         unsigned int n;
         fread(&n, sizeof(unsigned int), 1, fin);
@@ -247,6 +301,7 @@ private:
         for (unsigned int i = 0; i < n; i++) {
             fread(&termId, sizeof(TID), 1, fin);
 
+            long from = ftell(fin);
             IndexRecord rec(fin);
 
             if (records.find(termId) != records.end()) {
@@ -255,13 +310,19 @@ private:
             }
 
             records[termId] = rec;
+            postingsBytes += ftell(fin) - from;
+            Metrics::addGauge(Metrics::POSTINGS_MEMORY, ftell(fin) - from);
         }
 
+        Metrics::add(Metrics::INDEX_BYTES_READ, ftell(fin));
         fclose(fin);
     }
 
     void loadDocTF(TID docId) {
         if (docTermTF.size() == MAX_DOC_TF_CACHE_SIZE) {
+            int64_t bytes = docTermTF.begin()->second.size() * TF_ENTRY_BYTES;
+            tfCacheBytes -= bytes;
+            Metrics::addGauge(Metrics::TF_CACHE_MEMORY, -bytes);
             docTermTF.erase(docTermTF.begin());
         }
         fseek(finTF, sizeof(int8_t) * TFOffsets[docId], SEEK_SET);
@@ -284,37 +345,137 @@ private:
         delete[] buf;
 
         docTermTF[docId].insert(res.begin(), res.end());
+
+        int64_t bytes = res.size() * TF_ENTRY_BYTES;
+        tfCacheBytes += bytes;
+        Metrics::addGauge(Metrics::TF_CACHE_MEMORY, bytes);
+        Metrics::add(Metrics::TF_BYTES_READ, length);
     }
-public:
-    Index() {
-        recordsNum = 0;
+    /* Index written with manifest: both arrays are mapped as they are */
+    bool loadBinary() {
+        if (manifest.version != Manifest::VERSION) {
+            cerr << "ERROR: Unsupported index version " << manifest.version << endl;
+            return false;
+        }
 
-        for (int i = 0; i < MAX_INDEX_FILES_NUM; i++) {
-            indexFiles.push_back(WORK_DIR + to_string(i));
+        uint32_t codecs = manifest.postingsCodecs | manifest.positionsCodecs | manifest.tfCodecs;
+        if (codecs & ~Manifest::KNOWN_CODECS) {
+            cerr << "ERROR: Index uses unknown codecs, mask " << codecs << endl;
+            return false;
         }
 
-        unsigned int tmp;
-        FILE *fin = fopen((WORK_DIR + TF_OFFSET_FILE_PATH).c_str(), "rb");
-        for (TID i = 0; i <= MAX_DOC_ID; ++i) {
-            fread(&tmp, sizeof(unsigned int), 1, fin);
-            TFOffsets.push_back(tmp);
+        docsNum = manifest.docsNum;
+
+        if (!externalIdsFile.open(workDir + Manifest::EXTERNAL_IDS_FILE_PATH) ||
+            externalIdsFile.size() != docsNum * sizeof(TID))
+        {
+            cerr << "ERROR: Bad external ids file in '" << workDir << "'" << endl;
+            return false;
         }
-        fclose(fin);
+        externalIds = externalIdsFile.as<TID>();
+
+        if (!TFOffsetsFile.open(workDir + TF_OFFSET_FILE_PATH) ||
+            TFOffsetsFile.size() != (docsNum + 1) * sizeof(unsigned int))
+        {
+            cerr << "ERROR: Bad TF offsets file in '" << workDir << "'" << endl;
+            return false;
+        }
+        TFOffsets = TFOffsetsFile.as<unsigned int>();
+
+        recordsPerFile = manifest.recordsPerFile;
+        docsPerFile = manifest.docsPerFile;
+        posFilesPerDir = manifest.posFilesPerDir;
 
-        finTF = fopen((WORK_DIR + TF_FILE_PATH).c_str(), "rb");
+        for (uint32_t i = 0; i < manifest.indexFilesNum; i++) {
+            indexFiles.push_back(workDir + to_string(i));
+        }
+
+        arraysBytes = externalIdsFile.size() + TFOffsetsFile.size();
+        return true;
+    }
 
-        ifstream finExternalIds(WORK_DIR + EXTERNAL_IDS_FILE_PATH);
+    /* Index built before manifest: text doc list and layout from the constants */
+    bool loadLegacy() {
+        for (int i = 0; i < MAX_INDEX_FILES_NUM; i++) {
+            indexFiles.push_back(workDir + to_string(i));
+        }
+
+        ifstream finExternalIds(workDir + EXTERNAL_IDS_FILE_PATH);
         string externalIdString;
         while (finExternalIds >> externalIdString) {
-            externalIds.push_back(stoll(externalIdString));
+            externalIdsData.push_back(stoll(externalIdString));
+        }
+        externalIds = externalIdsData.data();
+        docsNum = externalIdsData.size();
+
+        FILE *fin = fopen((workDir + TF_OFFSET_FILE_PATH).c_str(), "rb");
+        if (!fin) {
+            return false;
         }
+        TFOffsetsData.resize(docsNum + 1);
+        fread(TFOffsetsData.data(), sizeof(unsigned int), TFOffsetsData.size(), fin);
+        fclose(fin);
+        TFOffsets = TFOffsetsData.data();
+
+        arraysBytes = (externalIdsData.size() + TFOffsetsData.size()) * sizeof(TID);
+        return true;
     }
+public:
+    Index(const string &workDir) : workDir(workDir + "/") {
+        recordsNum = 0;
+        loaded = false;
+        maxDocId = 0;
+        finTF = nullptr;
+        TFOffsets = nullptr;
+        externalIds = nullptr;
+        docsNum = 0;
+        postingsBytes = 0;
+        tfCacheBytes = 0;
+        arraysBytes = 0;
+
+        recordsPerFile = RECORDS_PER_FILE;
+        docsPerFile = DOCS_PER_FILE;
+        posFilesPerDir = MAX_POS_FILES_PER_DIR;
+
+        hasManifest = Manifest::read(this->workDir + Manifest::FILE_PATH, manifest);
+
+        if (!(hasManifest ? loadBinary() : loadLegacy()) || docsNum == 0) {
+            cerr << "ERROR: Can't load index from '" << workDir << "'" << endl;
+            return;
+        }
+
+        finTF = fopen((this->workDir + TF_FILE_PATH).c_str(), "rb");
+
+        vector<TID> deleted;
+        if (Deletions::read(this->workDir + Deletions::FILE_PATH, deleted)) {
+            liveDocs.init(deleted, docsNum);
+        }
+
+        uint32_t firstBiwordId;
+        vector<pair<uint32_t, uint32_t>> biwordPairs;
+        if (Biwords::read(this->workDir + Biwords::FILE_PATH, firstBiwordId, biwordPairs)) {
+            for (size_t i = 0; i < biwordPairs.size(); i++) {
+                biwords[Biwords::key(biwordPairs[i].first, biwordPairs[i].second)] = firstBiwordId + i;
+            }
+        }
+
+        maxDocId = docsNum - 1;
+        loaded = finTF != nullptr;
+        Metrics::addGauge(Metrics::INDEX_ARRAYS_MEMORY, arraysBytes);
+    }
+
+    Index(const Index&) = delete;
+    Index& operator=(const Index&) = delete;
 
     ~Index() {
         for (auto i : records) {
             i.second.clear();
         }
         if (finTF) fclose(finTF);
+
+        Metrics::addGauge(Metrics::POSTINGS_MEMORY, -postingsBytes);
+        Metrics::addGauge(Metrics::TF_CACHE_MEMORY, -tfCacheBytes);
+        Metrics::addGauge(Metrics::INDEX_ARRAYS_MEMORY, -arraysBytes);
     }
 
     IndexRecord& get(TID termId) {
@@ -322,8 +483,10 @@ public:
 
         auto iter = records.find(termId);
         if (iter == records.end()) {
-            loadDocId(termId / RECORDS_PER_FILE);
+            Metrics::add(Metrics::POSTINGS_CACHE_MISSES);
+            loadDocId(termId / recordsPerFile);
         } else {
+            Metrics::add(Metrics::POSTINGS_CACHE_HITS);
             return iter->second;
         }
 
@@ -334,42 +497,98 @@ public:
         usageCnt[termId]--;
     }
 
-    DocTermPositions getPositions(TID docId) {
-        unsigned int n;
+    DocTermPositions getPositions(TID docId, const set<TID> *only = nullptr) {
         TID curId = -1;
         string fileName = 
-            WORK_DIR + POSITIONS_DIR_PATH + 
-            to_string(docId / DOCS_PER_FILE / MAX_POS_FILES_PER_DIR) + "/" + 
-            to_string(docId / DOCS_PER_FILE);
+            workDir + POSITIONS_DIR_PATH + 
+            to_string(docId / docsPerFile / posFilesPerDir) + "/" + 
+            to_string(docId / docsPerFile);
 
         FILE *fin = fopen(fileName.c_str(), "rb");
+        if (!fin) {
+            cerr << "ERROR: Can't open positions file '" << fileName << "'" << endl;
+            return DocTermPositions();
+        }
+        TRACE_COUNT(positionsFilesOpened, 1);
+
+        // The file is read whole: a seek over a record of another doc
+        // refills the stdio buffer, which costs more than the file
+        fseek(fin, 0, SEEK_END);
+        positionsBuffer.resize(ftell(fin));
+        fseek(fin, 0, SEEK_SET);
+        positionsBuffer.resize(fread(positionsBuffer.data(), sizeof(int8_t), positionsBuffer.size(), fin));
+        fclose(fin);
+        Metrics::add(Metrics::POSITIONS_BYTES_READ, positionsBuffer.size());
 
-        for (int i = 0; i < DOCS_PER_FILE; i++) {
-            fread(&curId, sizeof(TID), 1, fin);
+        const int8_t *p = positionsBuffer.data();
+        const int8_t *end = p + positionsBuffer.size();
+        for (int i = 0; i < docsPerFile && DocTermPositions::read(p, end, curId); i++) {
             if (curId == docId) {
-                DocTermPositions res(docId, fin);
-                fclose(fin);
-                return res;
-            } else {
-                DocTermPositions::skip(fin);
+                return DocTermPositions(docId, p, end, only);
             }
+            DocTermPositions::skip(p, end);
         }
 
-        fclose(fin);
-        if (curId != docId) {
-            cerr << "ERROR: Can't find positions for docId " << docId << ", file name is '" << fileName << "'" << endl;
-        }
+        cerr << "ERROR: Can't find positions for docId " << docId << ", file name is '" << fileName << "'" << endl;
         return DocTermPositions();
     }
 
     unsigned int getTF(TID docId, TID termId) {
-        if (docTermTF.count(docId) == 0) {
+        TracePhase phase(QueryTrace::TF_LOOKUP);
+        auto doc = docTermTF.find(docId);
+        if (doc == docTermTF.end()) {
+            Metrics::add(Metrics::TF_CACHE_MISSES);
             loadDocTF(docId);
+            doc = docTermTF.find(docId);
+        } else {
+            Metrics::add(Metrics::TF_CACHE_HITS);
         }
-        return docTermTF[docId][termId];
+        // find, not [], a missing term mustn't grow the cache
+        auto tf = doc->second.find(termId);
+        return tf == doc->second.end() ? 0 : tf->second;
     }
 
     TID getExternalId(TID internalId) {
         return externalIds[internalId];
     }
+
+    TID getMaxDocId() {
+        return maxDocId;
+    }
+
+    bool hasDeletions() {
+        return !liveDocs.empty();
+    }
+
+    bool isDeleted(TID docId) {
+        return liveDocs.isDeleted(docId);
+    }
+
+    TID nextLive(TID docId) {
+        return liveDocs.nextLive(docId);
+    }
+
+    /* Term id of the postings of documents with a right before b, NO_BIWORD if there are none */
+    TID getBiword(TID a, TID b) {
+        auto it = biwords.find(Biwords::key(a, b));
+        return it == biwords.end() ? NO_BIWORD : it->second;
+    }
+
+    bool isLoaded() {
+        return loaded;
+    }
+
+    /* Compares arrays with the manifest checksums, it reads them whole */
+    bool verify() {
+        if (!hasManifest) {
+            return true;
+        }
+        bool ok =
+            Manifest::checksum(externalIds, docsNum * sizeof(TID)) == manifest.externalIdsChecksum &&
+            Manifest::checksum(TFOffsets, (docsNum + 1) * sizeof(unsigned int)) == manifest.tfOffsetsChecksum;
+        if (!ok) {
+            cerr << "ERROR: Checksum mismatch in '" << workDir << "'" << endl;
+        }
+        return ok;
+    }
 };
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <iostream>
+#include "segmented_index.h"
+
+using namespace std;
+
+
+/*
+ * One loaded generation of the index. Every session keeps a shared_ptr
+ * to the snapshot it was started on, so the index stays alive until
+ * the last session over it is closed, even after a newer one is active.
+ */
+struct IndexSnapshot {
+    unsigned int generation;
+    // Canonical path of the index directory
+    string path;
+    shared_ptr<SegmentedIndex> index;
+};
+
+
+class IndexHolder {
+private:
+    mutex m;
+    shared_ptr<IndexSnapshot> current;
+    vector<weak_ptr<IndexSnapshot>> snapshots;
+    // snapshot the last refresh started from, it isn't retried if it failed
+    weak_ptr<IndexSnapshot> refreshed;
+    unsigned int nextGeneration;
+    bool verify;
+
+    thread loader;
+    atomic<bool> loading;
+
+    static string realPath(const string &path) {
+        char *p = realpath(path.c_str(), nullptr);
+        if (p == nullptr) {
+            return path;
+        }
+        string s(p);
+        free(p);
+        return s;
+    }
+
+    bool load(const string &path) {
+        auto index = make_shared<SegmentedIndex>(path, verify);
+        if (!index->isLoaded()) {
+            return false;
+        }
+
+        lock_guard<mutex> lock(m);
+        current = make_shared<IndexSnapshot>(IndexSnapshot{nextGeneration++, realPath(path), index});
+        snapshots.push_back(current);
+        return true;
+    }
+
+    /*
+     * Generation of a live snapshot of the single index directory at path,
+     * 0 if there is none. Such a snapshot maps files of the directory and
+     * opens positions files by path, so a rebuild in place breaks it. Once
+     * the directory has segments its index is the base segment, the files
+     * of which are never changed.
+     */
+    unsigned int usedBy(const string &path) {
+        vector<string> names;
+        if (Segments::read(path + Segments::FILE_PATH, names)) {
+            return 0;
+        }
+        string real = realPath(path);
+
+        lock_guard<mutex> lock(m);
+        snapshots.erase(remove_if(snapshots.begin(), snapshots.end(), [](const weak_ptr<IndexSnapshot> &w) {
+            return w.expired();
+        }), snapshots.end());
+
+        for (auto &w : snapshots) {
+            auto snapshot = w.lock();
+            if (snapshot && !snapshot->index->isSegmented() && snapshot->path == real) {
+                return snapshot->generation;
+            }
+        }
+        return 0;
+    }
+public:
+    /* verify checks the index of every load against its checksums */
+    IndexHolder(const string &path, bool verify = true) : nextGeneration(1), verify(verify), loading(false) {
+        load(path);
+    }
+
+    ~IndexHolder() {
+        if (loader.joinable()) loader.join();
+    }
+
+    IndexHolder(const IndexHolder&) = delete;
+    IndexHolder& operator=(const IndexHolder&) = delete;
+
+    /* Active snapshot, nullptr if no index was loaded successfully yet */
+    shared_ptr<IndexSnapshot> get() {
+        lock_guard<mutex> lock(m);
+        return current;
+    }
+
+    /*
+     * Starts loading the index from path in background, the new generation
+     * becomes active for new sessions as soon as it is loaded.
+     * Returns false if the previous reload is still in progress, or path
+     * is a single index directory still used by a loaded generation: a
+     * rebuilt index goes to a new directory, a segmented one is reloaded
+     * in place since its segments are never changed.
+     */
+    bool reload(const string &path) {
+        if (loading.exchange(true)) {
+            return false;
+        }
+
+        unsigned int generation = usedBy(path);
+        if (generation != 0) {
+            cerr << "ERROR: '" << path << "' is still used by generation " << generation
+                 << ", reload a rebuilt index from a new directory" << endl;
+            loading = false;
+            return false;
+        }
+
+        if (loader.joinable()) loader.join();
+
+        loader = thread([this, path]() {
+            if (!load(path)) {
+                cerr << "ERROR: Reload from '" << path << "' failed, index is not changed" << endl;
+            }
+            loading = false;
+        });
+
+        return true;
+    }
+
+    /*
+     * Reloads the active index in background if a deletions file of it was
+     * replaced, so deletes of the segments tool need no explicit reload.
+     * Called before requests, it costs a stat per segment.
+     */
+    void refresh() {
+        auto snapshot = get();
+        if (!snapshot || loading || refreshed.lock() == snapshot || !snapshot->index->deletionsChanged()) {
+            return;
+        }
+        refreshed = snapshot;
+        cout << "Deletions of '" << snapshot->path << "' changed, reloading" << endl;
+        reload(snapshot->path);
+    }
+
+    bool isLoading() {
+        return loading;
+    }
+
+    unsigned int generation() {
+        auto snapshot = get();
+        return snapshot ? snapshot->generation : 0;
+    }
+};
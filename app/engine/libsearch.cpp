@@ -0,0 +1,138 @@
+#include <iostream>
+#include <string>
+#include <mutex>
+#include "libsearch.h"
+#include "query_parser.h"
+#include "index_snapshot.h"
+
+using namespace std;
+
+
+/*
+ * Index loads postings and TF blocks on demand into shared caches and file
+ * buffers, so every call touching an index or a cursor takes the lock.
+ */
+struct search_index {
+    IndexHolder holder;
+    mutex lock;
+
+    search_index(const char *path) : holder(path) {}
+};
+
+
+struct search_cursor {
+    search_index *handle;
+    shared_ptr<IndexSnapshot> snapshot;
+    RankDecorator *iter;
+};
+
+
+search_index* search_open(const char *path) {
+    try {
+        search_index *handle = new search_index(path);
+        if (!handle->holder.get()) {
+            delete handle;
+            return nullptr;
+        }
+        return handle;
+    } catch (const exception &e) {
+        cerr << "ERROR: search_open: " << e.what() << endl;
+        return nullptr;
+    }
+}
+
+
+void search_close(search_index *handle) {
+    if (handle) {
+        delete handle;
+    }
+}
+
+
+search_cursor* search_cursor_open(search_index *handle, const char *expr) {
+    if (!handle || !expr) {
+        return nullptr;
+    }
+    try {
+        lock_guard<mutex> guard(handle->lock);
+        handle->holder.refresh();
+        auto snapshot = handle->holder.get();
+        RankDecorator *iter = getIterator(snapshot->index.get(), expr);
+        if (iter == nullptr) {
+            return nullptr;
+        }
+        return new search_cursor{handle, snapshot, iter};
+    } catch (const exception &e) {
+        cerr << "ERROR: search_cursor_open: " << e.what() << endl;
+        return nullptr;
+    }
+}
+
+
+int search_cursor_next(search_cursor *cursor, unsigned int k, unsigned int *docIds) {
+    if (!cursor) {
+        return -1;
+    }
+    try {
+        lock_guard<mutex> guard(cursor->handle->lock);
+        unsigned int n = 0;
+        while (n < k && !cursor->iter->end()) {
+            docIds[n++] = cursor->iter->get();
+            cursor->iter->next();
+        }
+        return n;
+    } catch (const exception &e) {
+        cerr << "ERROR: search_cursor_next: " << e.what() << endl;
+        return -1;
+    }
+}
+
+
+void search_cursor_close(search_cursor *cursor) {
+    if (cursor) {
+        lock_guard<mutex> guard(cursor->handle->lock);
+        delete cursor->iter;
+        delete cursor;
+    }
+}
+
+
+int search_query(search_index *handle, const char *expr, unsigned int k, unsigned int *docIds) {
+    search_cursor *cursor = search_cursor_open(handle, expr);
+    if (cursor == nullptr) {
+        return -1;
+    }
+    int n = search_cursor_next(cursor, k, docIds);
+    search_cursor_close(cursor);
+    return n;
+}
+
+
+int search_reload(search_index *handle, const char *path) {
+    if (!handle) {
+        return -1;
+    }
+    try {
+        string p = path && path[0] ? string(path) : handle->holder.get()->path;
+        return handle->holder.reload(p) ? 0 : -1;
+    } catch (const exception &e) {
+        cerr << "ERROR: search_reload: " << e.what() << endl;
+        return -1;
+    }
+}
+
+
+unsigned int search_generation(search_index *handle) {
+    if (!handle) {
+        return 0;
+    }
+    return handle->holder.generation();
+}
+
+
+int search_is_reloading(search_index *handle) {
+    if (!handle) {
+        return 0;
+    }
+    return handle->holder.isLoading();
+}
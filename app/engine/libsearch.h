@@ -0,0 +1,57 @@
+#pragma once
+
+/*
+ * Plain C interface of the search engine, see libsearch.cpp.
+ * Doc ids returned by the functions are external ids (wiki article ids).
+ * Functions never throw, errors are reported by NULL or negative result.
+ * Calls on one index and its cursors may come from any thread, they are
+ * serialized by the lock of the index. Cursors must be closed before
+ * search_close of their index.
+ */
+
+#define SEARCH_API __attribute__((visibility("default")))
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct search_index search_index;
+typedef struct search_cursor search_cursor;
+
+/* Loads index from the directory built by index_builder, NULL on error */
+SEARCH_API search_index* search_open(const char *path);
+
+SEARCH_API void search_close(search_index *handle);
+
+/*
+ * Evaluates the query expression (same syntax as the pipe protocol)
+ * and writes up to k best doc ids into docIds.
+ * Returns number of written ids or -1 if the expression is bad.
+ */
+SEARCH_API int search_query(search_index *handle, const char *expr, unsigned int k, unsigned int *docIds);
+
+/* Starts paging through the results of the expression, NULL if it is bad */
+SEARCH_API search_cursor* search_cursor_open(search_index *handle, const char *expr);
+
+/* Writes up to k next doc ids into docIds, returns their number, 0 at the end, -1 on error */
+SEARCH_API int search_cursor_next(search_cursor *cursor, unsigned int k, unsigned int *docIds);
+
+SEARCH_API void search_cursor_close(search_cursor *cursor);
+
+/*
+ * Starts loading the index from path (NULL or "" for the current one) in
+ * background. New cursors use it as soon as it is loaded, open cursors keep
+ * the index they were opened on. Returns -1 if a reload is already running
+ * or path is a single index directory still in use, a rebuilt index needs
+ * a new directory; a segmented index can be reloaded in place.
+ */
+SEARCH_API int search_reload(search_index *handle, const char *path);
+
+/* Generation of the active index, the first loaded one is 1 */
+SEARCH_API unsigned int search_generation(search_index *handle);
+
+SEARCH_API int search_is_reloading(search_index *handle);
+
+#ifdef __cplusplus
+}
+#endif
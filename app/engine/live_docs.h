@@ -0,0 +1,58 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+using namespace std;
+
+using TID = unsigned int;
+
+
+/* Bitmap of the deleted documents of a segment, a set bit is a deleted doc */
+class LiveDocs {
+private:
+    vector<uint64_t> words;
+    size_t deletedNum;
+public:
+    LiveDocs() : deletedNum(0) {}
+
+    void init(const vector<TID> &deleted, size_t docsNum) {
+        words.assign((docsNum + 63) / 64, 0);
+        deletedNum = 0;
+        for (TID docId : deleted) {
+            if (docId < docsNum && !isDeleted(docId)) {
+                words[docId >> 6] |= 1ULL << (docId & 63);
+                deletedNum++;
+            }
+        }
+    }
+
+    bool empty() const {
+        return deletedNum == 0;
+    }
+
+    size_t size() const {
+        return deletedNum;
+    }
+
+    bool isDeleted(TID docId) const {
+        size_t w = docId >> 6;
+        return w < words.size() && (words[w] >> (docId & 63)) & 1;
+    }
+
+    /* First not deleted doc id >= docId, 64 docs are checked at once */
+    TID nextLive(TID docId) const {
+        size_t w = docId >> 6;
+        if (w >= words.size()) {
+            return docId;
+        }
+        uint64_t live = ~words[w] & (~0ULL << (docId & 63));
+        while (live == 0) {
+            if (++w == words.size()) {
+                return w << 6;
+            }
+            live = ~words[w];
+        }
+        return (w << 6) + __builtin_ctzll(live);
+    }
+};
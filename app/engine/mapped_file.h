@@ -0,0 +1,68 @@
+#pragma once
+
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace std;
+
+
+/* Read-only mapping of the whole file, unmapped on destruction */
+class MappedFile {
+private:
+    void *data;
+    size_t length;
+public:
+    MappedFile() : data(nullptr), length(0) {}
+
+    ~MappedFile() {
+        close();
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const string &path) {
+        close();
+
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            ::close(fd);
+            return false;
+        }
+
+        length = st.st_size;
+        if (length > 0) {
+            data = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+            if (data == MAP_FAILED) {
+                data = nullptr;
+                length = 0;
+            }
+        }
+
+        ::close(fd);
+        return data != nullptr || st.st_size == 0;
+    }
+
+    void close() {
+        if (data) {
+            munmap(data, length);
+            data = nullptr;
+            length = 0;
+        }
+    }
+
+    template<typename T>
+    const T* as() const {
+        return static_cast<const T*>(data);
+    }
+
+    size_t size() const {
+        return length;
+    }
+};
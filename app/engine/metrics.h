@@ -0,0 +1,203 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <ostream>
+#include <cstdint>
+
+using namespace std;
+
+
+/*
+ * Engine counters, gauges and latency histograms. Every thread writes
+ * only to its own shard, so an update is a relaxed load and store of the
+ * thread's slot without locks or atomic read-modify-write. Readers sum the
+ * shards; a shard is registered under a mutex once per thread and stays
+ * after the thread exits, so its counts are kept.
+ */
+namespace Metrics {
+    enum Counter {
+        BAD_QUERIES,
+        POSTINGS_CACHE_HITS,
+        POSTINGS_CACHE_MISSES,
+        TF_CACHE_HITS,
+        TF_CACHE_MISSES,
+        INDEX_BYTES_READ,
+        POSITIONS_BYTES_READ,
+        TF_BYTES_READ,
+        COUNTERS_NUM
+    };
+
+    enum Gauge {
+        SESSIONS,
+        POSTINGS_MEMORY,
+        TF_CACHE_MEMORY,
+        INDEX_ARRAYS_MEMORY,
+        GAUGES_NUM
+    };
+
+    enum Latency {
+        SINGLE,
+        FREE_TEXT,
+        BOOLEAN,
+        QUOTE,
+        PAGE,
+        LATENCIES_NUM
+    };
+
+    /*
+     * Log-linear buckets of microseconds like HDR histograms: values below
+     * 16 have their own bucket, above it every power of 2 is split into 16
+     * buckets, so a bucket is within 1/16 of its values.
+     */
+    const unsigned int SUB_BITS = 4;
+    const unsigned int SUB_BUCKETS = 1 << SUB_BITS;
+    const unsigned int MAX_EXPONENT = 40;
+    const unsigned int BUCKETS_NUM = (MAX_EXPONENT - SUB_BITS + 2) * SUB_BUCKETS;
+
+    inline unsigned int bucket(uint64_t us) {
+        if (us < SUB_BUCKETS) return us;
+        unsigned int e = 63 - __builtin_clzll(us);
+        if (e > MAX_EXPONENT) return BUCKETS_NUM - 1;
+        return (e - SUB_BITS + 1) * SUB_BUCKETS + ((us >> (e - SUB_BITS)) & (SUB_BUCKETS - 1));
+    }
+
+    /* Upper bound of the values of the bucket */
+    inline uint64_t bucketLimit(unsigned int b) {
+        if (b < SUB_BUCKETS) return b;
+        unsigned int e = b / SUB_BUCKETS + SUB_BITS - 1;
+        return ((uint64_t)(SUB_BUCKETS + b % SUB_BUCKETS + 1) << (e - SUB_BITS)) - 1;
+    }
+
+    struct Shard {
+        atomic<uint64_t> counters[COUNTERS_NUM];
+        atomic<int64_t> gauges[GAUGES_NUM];
+        atomic<uint64_t> buckets[LATENCIES_NUM][BUCKETS_NUM];
+        atomic<uint64_t> sumUs[LATENCIES_NUM];
+
+        Shard() {
+            for (auto &c : counters) c = 0;
+            for (auto &g : gauges) g = 0;
+            for (auto &h : buckets) for (auto &b : h) b = 0;
+            for (auto &s : sumUs) s = 0;
+        }
+    };
+
+    inline mutex shardsMutex;
+    inline vector<unique_ptr<Shard>> shards;
+    inline thread_local Shard *local = nullptr;
+
+    inline Shard& shard() {
+        if (!local) {
+            lock_guard<mutex> lock(shardsMutex);
+            shards.emplace_back(new Shard());
+            local = shards.back().get();
+        }
+        return *local;
+    }
+
+    template<typename T, typename V>
+    inline void bump(atomic<T> &slot, V n) {
+        slot.store(slot.load(memory_order_relaxed) + n, memory_order_relaxed);
+    }
+
+    inline void add(Counter c, uint64_t n = 1) {
+        bump(shard().counters[c], n);
+    }
+
+    inline void addGauge(Gauge g, int64_t n) {
+        bump(shard().gauges[g], n);
+    }
+
+    inline void observe(Latency l, uint64_t us) {
+        Shard &s = shard();
+        bump(s.buckets[l][bucket(us)], 1);
+        bump(s.sumUs[l], us);
+    }
+
+    /* Latency of the query as its type */
+    inline Latency queryLatency(const string &expr) {
+        if (expr.find('"') != string::npos) return QUOTE;
+        if (expr.find_first_of("&|!()") != string::npos) return BOOLEAN;
+        size_t first = expr.find_first_not_of(' ');
+        size_t space = expr.find(' ', first);
+        return space == string::npos || expr.find_first_not_of(' ', space) == string::npos ? SINGLE : FREE_TEXT;
+    }
+
+    /* All metrics in the Prometheus text format, latencies as summaries */
+    inline void writePrometheus(ostream &out) {
+        static const char *counterNames[COUNTERS_NUM][2] = {
+            {"search_bad_queries_total", ""},
+            {"search_cache_requests_total", "cache=\"postings\",result=\"hit\""},
+            {"search_cache_requests_total", "cache=\"postings\",result=\"miss\""},
+            {"search_cache_requests_total", "cache=\"tf\",result=\"hit\""},
+            {"search_cache_requests_total", "cache=\"tf\",result=\"miss\""},
+            {"search_bytes_read_total", "file=\"index\""},
+            {"search_bytes_read_total", "file=\"positions\""},
+            {"search_bytes_read_total", "file=\"tf\""},
+        };
+        static const char *gaugeNames[GAUGES_NUM][2] = {
+            {"search_sessions", ""},
+            {"search_memory_bytes", "subsystem=\"postings\""},
+            {"search_memory_bytes", "subsystem=\"tf_cache\""},
+            {"search_memory_bytes", "subsystem=\"index_arrays\""},
+        };
+        static const char *latencyNames[LATENCIES_NUM] = {"single", "free_text", "boolean", "quote", "page"};
+        static const double QUANTILES[] = {0.5, 0.9, 0.99, 0.999};
+
+        uint64_t counters[COUNTERS_NUM] = {};
+        int64_t gauges[GAUGES_NUM] = {};
+        vector<vector<uint64_t>> buckets(LATENCIES_NUM, vector<uint64_t>(BUCKETS_NUM, 0));
+        uint64_t sumUs[LATENCIES_NUM] = {};
+        {
+            lock_guard<mutex> lock(shardsMutex);
+            for (auto &s : shards) {
+                for (int i = 0; i < COUNTERS_NUM; i++) counters[i] += s->counters[i].load(memory_order_relaxed);
+                for (int i = 0; i < GAUGES_NUM; i++) gauges[i] += s->gauges[i].load(memory_order_relaxed);
+                for (int l = 0; l < LATENCIES_NUM; l++) {
+                    for (unsigned int b = 0; b < BUCKETS_NUM; b++) buckets[l][b] += s->buckets[l][b].load(memory_order_relaxed);
+                    sumUs[l] += s->sumUs[l].load(memory_order_relaxed);
+                }
+            }
+        }
+
+        string last;
+        auto header = [&](const string &name, const char *type) {
+            if (name == last) return;
+            out << "# TYPE " << name << " " << type << "\n";
+            last = name;
+        };
+        auto labels = [](const char *l) {
+            return string(*l ? "{" : "") + l + (*l ? "}" : "");
+        };
+
+        for (int i = 0; i < COUNTERS_NUM; i++) {
+            header(counterNames[i][0], "counter");
+            out << counterNames[i][0] << labels(counterNames[i][1]) << " " << counters[i] << "\n";
+        }
+        for (int i = 0; i < GAUGES_NUM; i++) {
+            header(gaugeNames[i][0], "gauge");
+            out << gaugeNames[i][0] << labels(gaugeNames[i][1]) << " " << gauges[i] << "\n";
+        }
+
+        header("search_latency_seconds", "summary");
+        for (int l = 0; l < LATENCIES_NUM; l++) {
+            uint64_t count = 0;
+            for (auto n : buckets[l]) count += n;
+
+            for (double q : QUANTILES) {
+                uint64_t rank = count * q;
+                uint64_t seen = 0;
+                unsigned int b = 0;
+                while (b + 1 < BUCKETS_NUM && seen + buckets[l][b] <= rank) seen += buckets[l][b++];
+                out << "search_latency_seconds{type=\"" << latencyNames[l] << "\",quantile=\"" << q << "\"} "
+                    << (count ? bucketLimit(b) / 1e6 : 0) << "\n";
+            }
+            out << "search_latency_seconds_sum{type=\"" << latencyNames[l] << "\"} " << sumUs[l] / 1e6 << "\n";
+            out << "search_latency_seconds_count{type=\"" << latencyNames[l] << "\"} " << count << "\n";
+        }
+    }
+};
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <string>
+#include <sstream>
+#include <vector>
+#include <cassert>
+#include "index_iterator.h"
+
+using namespace std;
+
+
+template<typename T>
+void clearVector(vector<T*> &v) {
+    for (int i = 0; i < v.size(); i++) {
+        delete v[i];
+    }
+    v.clear();
+}
+
+
+IndexIterator* getQuoteIterator(Index *index, stringstream &ss) {
+    string s;
+    vector<TID> terms;
+    unsigned int dist = 0;
+    while (ss >> s) {
+        if (s == "\"") {
+            break;
+        }
+
+        if (s[0] == '/') {
+            dist = stoi(s.substr(1));
+        } else {
+            terms.push_back(stoi(s));
+        }
+    }
+    assert(terms.size() > 0);
+    if (terms.size() == 1) {
+        return new SimpleIterator(index, terms[0]);
+    }
+    if (dist < terms.size()) dist = terms.size();
+    return newQuoteIterator(index, terms, dist);
+}
+
+
+IndexIterator* getIteratorBoolean(Index *index, const string &expr) {
+    vector<IndexIterator*> stack;
+    stringstream ss(expr);
+    string s;
+    while (ss >> s) {
+        if (s == "!") {
+            if (stack.empty()) {
+                clearVector(stack);
+                return nullptr;
+            }
+            stack[stack.size() - 1] = new NotIterator(stack[stack.size() - 1]);
+        } else if (s == "&") {
+            if (stack.size() < 2) {
+                clearVector(stack);
+                return nullptr;
+            }
+
+            IndexIterator* a = stack.back();
+            stack.pop_back();
+
+            IndexIterator* b = stack.back();
+            stack.pop_back();
+
+            stack.push_back(new AndIterator(a, b));
+        } else if (s == "|") {
+            if (stack.size() < 2) {
+                clearVector(stack);
+                return nullptr;
+            }
+            
+            IndexIterator* a = stack.back();
+            stack.pop_back();
+            
+            IndexIterator* b = stack.back();
+            stack.pop_back();
+
+            stack.push_back(new OrIterator(a, b));
+        } else if (s == "\"") {
+            stack.push_back(getQuoteIterator(index, ss));
+        } else {
+            stack.push_back(new SimpleIterator(index, stoul(s)));
+        }
+    }
+    if (stack.size() != 1) {
+        clearVector(stack);
+        return nullptr;
+    }
+    return stack[0];
+}
+
+
+/* Boolean query is evaluated on every segment, results go segment by segment */
+IndexIterator* getIteratorBoolean(SegmentedIndex *index, const string &expr) {
+    vector<IndexIterator*> iters;
+    vector<TID> bases;
+    for (size_t i = 0; i < index->size(); i++) {
+        IndexIterator *it = getIteratorBoolean(index->segment(i), expr);
+        if (!it) {
+            clearVector(iters);
+            return nullptr;
+        }
+        iters.push_back(it);
+        bases.push_back(index->base(i));
+    }
+    if (iters.size() == 1) {
+        return iters.front();
+    }
+    return new ConcatIterator(iters, bases);
+}
+
+
+/* Ranked results of the query, the whole level is ranked unless lazy paging is asked for */
+RankDecorator* getIterator(SegmentedIndex *index, const string &expr, bool lazy = false) {
+    bool boolean = false;
+    for (char c : "&|!\"()") {
+        if (expr.find(c) != string::npos) {
+            boolean = true;
+            break;
+        }
+    }
+
+    if (boolean) {
+        auto it = getIteratorBoolean(index, expr);
+        if (it) return new RankDecorator(it, lazy);
+        return nullptr;
+    }
+
+    vector<TID> query;
+    stringstream ss(expr);
+    string s;
+    while (ss >> s) {
+        query.push_back(stoul(s));
+    }
+
+    if (query.size() == 0) return nullptr;
+    return new RankDecorator(index, query, lazy);
+}
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <ostream>
+#include <cstdint>
+
+using namespace std;
+
+
+class TracePhase;
+
+
+/*
+ * Phase timings and work counters of one query. The trace of the thread
+ * is QueryTrace::current, nullptr when the query isn't traced, so the
+ * instrumented code costs a check of the pointer otherwise.
+ *
+ * Phases nest: time of a phase is exclusive, without the phases opened
+ * inside it, so the phases of a query add up to its time.
+ */
+class QueryTrace {
+public:
+    enum Phase {
+        PARSE,
+        LOAD_POSTINGS,
+        DECODE,
+        INTERSECT,
+        TF_LOOKUP,
+        POSITIONS,
+        RANK,
+        PHASES_NUM
+    };
+
+    struct Event {
+        Phase phase;
+        double start;
+        double duration;
+    };
+
+    // Spans shorter than this are only summed, a decode of one posting
+    // is much shorter than the timer call itself
+    static constexpr double MIN_EVENT_US = 10;
+    static const size_t MAX_EVENTS = 100000;
+
+    static inline thread_local QueryTrace *current = nullptr;
+
+    double phaseUs[PHASES_NUM] = {};
+    uint64_t postingsDecoded = 0;
+    uint64_t jumps = 0;
+    uint64_t rollbacks = 0;
+    uint64_t positionsFilesOpened = 0;
+    uint64_t docsScored = 0;
+
+    bool keepEvents;
+    vector<Event> events;
+    chrono::steady_clock::time_point start;
+    TracePhase *top;
+
+    explicit QueryTrace(bool keepEvents = false) : keepEvents(keepEvents), start(chrono::steady_clock::now()), top(nullptr) {}
+
+    static const char* phaseName(Phase phase) {
+        static const char *names[PHASES_NUM] = {
+            "parse", "load_postings", "decode", "intersect", "tf_lookup", "positions", "rank"
+        };
+        return names[phase];
+    }
+
+    double totalUs() const {
+        double s = 0;
+        for (double t : phaseUs) s += t;
+        return s;
+    }
+
+    /* JSON string of s, control bytes are escaped as \u00XX */
+    static string quoted(const string &s) {
+        static const char HEX[] = "0123456789abcdef";
+        string res = "\"";
+        for (char c : s) {
+            unsigned char u = c;
+            if (c == '"' || c == '\\') {
+                res += '\\';
+                res += c;
+            } else if (u < 0x20) {
+                res += "\\u00";
+                res += HEX[u >> 4];
+                res += HEX[u & 15];
+            } else {
+                res += c;
+            }
+        }
+        return res + "\"";
+    }
+
+    /* Summary: phases in ms and counters, fields of a JSON object without the braces */
+    void writeSummary(ostream &out) const {
+        out << "\"total_ms\": " << totalUs() / 1000 << ", \"phases_ms\": {";
+        for (int p = 0; p < PHASES_NUM; p++) {
+            out << (p ? ", " : "") << "\"" << phaseName((Phase)p) << "\": " << phaseUs[p] / 1000;
+        }
+        out << "}, \"counters\": {\"postings_decoded\": " << postingsDecoded
+            << ", \"jumps\": " << jumps
+            << ", \"rollbacks\": " << rollbacks
+            << ", \"positions_files_opened\": " << positionsFilesOpened
+            << ", \"docs_scored\": " << docsScored << "}";
+    }
+
+    /* Trace event format of chrome://tracing and Perfetto */
+    void writeChrome(ostream &out, const string &name) const {
+        out << "{\"traceEvents\": [\n";
+        out << "{\"name\": " << quoted(name) << ", \"ph\": \"X\", \"pid\": 1, \"tid\": 1, \"ts\": 0, \"dur\": " << totalUs() << "}";
+        for (auto &e : events) {
+            out << ",\n{\"name\": \"" << phaseName(e.phase) << "\", \"ph\": \"X\", \"pid\": 1, \"tid\": 1, \"ts\": "
+                << e.start << ", \"dur\": " << e.duration << "}";
+        }
+        out << ",\n{\"name\": \"counters\", \"ph\": \"C\", \"pid\": 1, \"tid\": 1, \"ts\": " << totalUs() << ", \"args\": {"
+            << "\"postings_decoded\": " << postingsDecoded
+            << ", \"jumps\": " << jumps
+            << ", \"rollbacks\": " << rollbacks
+            << ", \"positions_files_opened\": " << positionsFilesOpened
+            << ", \"docs_scored\": " << docsScored << "}}";
+        out << "\n]}" << endl;
+    }
+};
+
+/* Adds the time of the scope to the phase of the current trace, if there is one */
+class TracePhase {
+private:
+    QueryTrace *trace;
+    QueryTrace::Phase phase;
+    TracePhase *parent;
+    chrono::steady_clock::time_point start;
+    double childUs;
+
+    // Out of line, so an untraced scope is only the check of the trace
+    __attribute__((noinline)) void begin() {
+        parent = trace->top;
+        trace->top = this;
+        childUs = 0;
+        start = chrono::steady_clock::now();
+    }
+
+    __attribute__((noinline)) void finish() {
+        double us = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+        trace->phaseUs[phase] += us - childUs;
+        if (parent) parent->childUs += us;
+        trace->top = parent;
+
+        if (trace->keepEvents && us >= QueryTrace::MIN_EVENT_US && trace->events.size() < QueryTrace::MAX_EVENTS) {
+            double from = chrono::duration<double, micro>(start - trace->start).count();
+            trace->events.push_back(QueryTrace::Event{phase, from, us});
+        }
+    }
+public:
+    explicit TracePhase(QueryTrace::Phase phase) : trace(QueryTrace::current), phase(phase) {
+        if (trace) begin();
+    }
+
+    ~TracePhase() {
+        if (trace) finish();
+    }
+
+    TracePhase(const TracePhase&) = delete;
+    TracePhase& operator=(const TracePhase&) = delete;
+};
+
+
+/* Increments the counter of the current trace, if there is one */
+#define TRACE_COUNT(counter, n) do { if (QueryTrace::current) QueryTrace::current->counter += (n); } while (0)
@@ -3,7 +3,17 @@
 #include <fstream>
 #include <sstream>
 #include <cassert>
-#include "index_iterator.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <thread>
+#include <cstdio>
+#include <cerrno>
+#include <list>
+#include <unordered_map>
+#include "query_parser.h"
+#include "index_snapshot.h"
+#include "metrics.h"
 
 
 using namespace std;
@@ -14,221 +24,521 @@ const char* RESPONSE_PIPE = "../pipe_B";
 
 const char NEW_REQ = 0;
 const char EXIST_REQ = 1;
+const char BATCH_REQ = 2;
+const char RELOAD_REQ = 3;
+const char GENERATION_REQ = 4;
+const char TRACE_REQ = 5;
+const char STATS_REQ = 6;
 
 const char OK = 0; 
 const char OK_PAYLOAD = 1;
 const char BAD = 2;
+const char OK_TEXT = 3;
 
 const int RESPONSE_BLOCK_SIZE = 50;
+const unsigned int BUFFER_SIZE = 1000000;
+const unsigned int MAX_BATCH_SIZE = 10000;
 
 
-char *BUFFER = new char[1000000];
-vector<RankDecorator*> requests;
+struct Session {
+    shared_ptr<IndexSnapshot> snapshot;
+    RankDecorator *iter;
 
-template<typename T>
-void clearVector(vector<T*> &v) {
-    for (int i = 0; i < v.size(); i++) {
-        delete v[i];
+    ~Session() {
+        if (iter) delete iter;
+        Metrics::addGauge(Metrics::SESSIONS, -1);
+    }
+};
+
+
+/*
+ * Open sessions by request id, ids keep growing even for bad queries.
+ * A session is closed after it sent a short page (the client sees the end
+ * of results and stops), when it is idle for ttl seconds, or when it is the
+ * least recently used one of maxSize. A closed session drops its snapshot,
+ * so an old generation is freed once its last session is closed, and a
+ * request to a closed id gets BAD.
+ */
+struct SessionTable {
+    typedef chrono::steady_clock clock;
+
+    struct Entry {
+        unsigned int id;
+        Session *session;
+        clock::time_point used;
+    };
+
+    list<Entry> lru;
+    unordered_map<unsigned int, list<Entry>::iterator> byId;
+    unsigned int nextId = 0;
+    size_t maxSize = 10000;
+    unsigned int ttl = 600;
+
+    ~SessionTable() {
+        for (auto &e : lru) delete e.session;
     }
-    v.clear();
-}
 
+    unsigned int add(Session *session) {
+        expire();
+        while (lru.size() >= maxSize) {
+            close(lru.front().id);
+        }
+        lru.push_back(Entry{nextId, session, clock::now()});
+        byId[nextId] = prev(lru.end());
+        return nextId++;
+    }
 
-IndexIterator* getQuoteIterator(stringstream &ss) {
-    string s;
-    vector<TID> terms;
-    unsigned int dist = 0;
-    while (ss >> s) {
-        if (s == "\"") {
-            break;
+    /* nullptr if the session is closed */
+    Session* get(unsigned int id) {
+        expire();
+        auto it = byId.find(id);
+        if (it == byId.end()) {
+            return nullptr;
         }
+        it->second->used = clock::now();
+        lru.splice(lru.end(), lru, it->second);
+        return it->second->session;
+    }
 
-        if (s[0] == '/') {
-            dist = stoi(s.substr(1));
-        } else {
-            terms.push_back(stoi(s));
+    void close(unsigned int id) {
+        auto it = byId.find(id);
+        if (it != byId.end()) {
+            delete it->second->session;
+            lru.erase(it->second);
+            byId.erase(it);
         }
     }
-    assert(terms.size() > 0);
-    if (terms.size() == 1) {
-        return new SimpleIterator(terms[0]);
+
+    void expire() {
+        auto deadline = clock::now() - chrono::seconds(ttl);
+        while (!lru.empty() && lru.front().used < deadline) {
+            close(lru.front().id);
+        }
     }
-    if (dist < terms.size()) dist = terms.size();
-    return new QuoteIterator(terms, dist);
+};
+
+
+char *BUFFER = new char[BUFFER_SIZE];
+SessionTable SESSIONS;
+IndexHolder *INDEX;
+string TRACE_DIR;
+string METRICS_FILE;
+unsigned int METRICS_INTERVAL = 10;
+bool LAZY_PAGING = false;
+
+
+/* Session of a bad query keeps no iterator, but still takes a request id */
+Session* newSession(const string &expr, bool valid = true) {
+    auto snapshot = INDEX->get();
+    Metrics::addGauge(Metrics::SESSIONS, 1);
+    return new Session{snapshot, valid ? getIterator(snapshot->index.get(), expr, LAZY_PAGING) : nullptr};
 }
 
 
-IndexIterator* getIteratorBoolean(const string &expr) {
-    vector<IndexIterator*> stack;
-    stringstream ss(expr);
-    string s;
-    while (ss >> s) {
-        if (s == "!") {
-            if (stack.empty()) {
-                clearVector(stack);
-                return nullptr;
-            }
-            stack[stack.size() - 1] = new NotIterator(stack[stack.size() - 1]);
-        } else if (s == "&") {
-            if (stack.size() < 2) {
-                clearVector(stack);
-                return nullptr;
-            }
+/* Reads length and string, false if it does not fit into BUFFER, then it is skipped */
+bool readString(istream &fin, string &s) {
+    unsigned int length;
+    fin.read((char*)&length, sizeof(unsigned int));
 
-            IndexIterator* a = stack.back();
-            stack.pop_back();
+    if (length >= BUFFER_SIZE) {
+        cerr << "ERROR: string of " << length << " bytes is too long" << endl;
+        fin.ignore(length);
+        s.clear();
+        return false;
+    }
 
-            IndexIterator* b = stack.back();
-            stack.pop_back();
+    fin.read(BUFFER, sizeof(char) * length);
+    BUFFER[length] = '\0';
+    s = string(BUFFER);
+    return true;
+}
 
-            stack.push_back(new AndIterator(a, b));
-        } else if (s == "|") {
-            if (stack.size() < 2) {
-                clearVector(stack);
-                return nullptr;
-            }
-            
-            IndexIterator* a = stack.back();
-            stack.pop_back();
-            
-            IndexIterator* b = stack.back();
-            stack.pop_back();
-
-            stack.push_back(new OrIterator(a, b));
-        } else if (s == "\"") {
-            stack.push_back(getQuoteIterator(ss));
-        } else {
-            stack.push_back(new SimpleIterator(stoul(s)));
-        }
+
+uint64_t elapsedUs(chrono::steady_clock::time_point start) {
+    return chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+}
+
+
+vector<TID> getNextDocIds(RankDecorator* iter) {
+    vector<TID> v;
+
+    while (!iter->end() && v.size() < RESPONSE_BLOCK_SIZE) {
+        v.push_back(iter->get());
+        iter->next();
     }
-    if (stack.size() != 1) {
-        clearVector(stack);
-        return nullptr;
+
+    return v;
+}
+
+
+/* Returns the number of sent doc ids */
+unsigned int sendNextDocId(RankDecorator* iter, ostream &fout) {
+    vector<TID> v = getNextDocIds(iter);
+
+    unsigned int n = v.size();
+
+    fout.write((char*)&OK_PAYLOAD, sizeof(char));
+    fout.write((char*)&n, sizeof(unsigned int));
+    fout.write((char*)v.data(), sizeof(TID) * n);
+
+    return n;
+}
+
+
+void processNewRequest(istream &fin, ostream &fout) {
+    string expr;
+    bool valid = readString(fin, expr);
+
+    auto start = chrono::steady_clock::now();
+    auto session = newSession(expr, valid);
+
+    unsigned int id = SESSIONS.add(session);
+
+    if (session->iter == nullptr) {
+        Metrics::add(Metrics::BAD_QUERIES);
+        fout.write((char*)&BAD, sizeof(char));
+        SESSIONS.close(id);
+    } else {
+        Metrics::observe(Metrics::queryLatency(expr), elapsedUs(start));
+        fout.write((char*)&OK, sizeof(char));
     }
-    return stack[0];
 }
 
 
-RankDecorator* getIterator(const string &expr) {
-    bool boolean = false;
-    for (char c : "&|!\"()") {
-        if (expr.find(c) != string::npos) {
-            boolean = true;
-            break;
+void processExistRequest(istream &fin, ostream &fout) {
+    unsigned int id;
+    fin.read((char*)&id, sizeof(unsigned int));
+
+    Session *session = SESSIONS.get(id);
+    if (session != nullptr && session->iter != nullptr) {
+        auto start = chrono::steady_clock::now();
+        unsigned int n = sendNextDocId(session->iter, fout);
+        Metrics::observe(Metrics::PAGE, elapsedUs(start));
+        if (n < RESPONSE_BLOCK_SIZE) {
+            SESSIONS.close(id);
         }
+    } else {
+        fout.write((char*)&BAD, sizeof(char));
     }
+}
+
 
-    if (boolean) {
-        auto it = getIteratorBoolean(expr);
-        if (it) return new RankDecorator(it);
-        return nullptr;
+struct BatchItem {
+    unsigned int tag;
+    string expr;
+    bool valid;
+    vector<TID> terms;
+};
+
+
+/*
+ * Batch frame: n, then n times (tag, length, expression).
+ * Response: OK, then one item per query, flushed as soon as the query is done:
+ * tag, code and, for OK_PAYLOAD, request id, doc ids count and doc ids.
+ * Every query gets a regular request id, so the next pages are fetched
+ * with EXIST_REQ as usual. A batch of more than MAX_BATCH_SIZE queries is
+ * answered BAD and the rest of the frame can not be trusted, so false is
+ * returned and the connection is closed.
+ */
+bool processBatchRequest(istream &fin, ostream &fout) {
+    unsigned int n = 0;
+    fin.read((char*)&n, sizeof(unsigned int));
+
+    if (!fin || n > MAX_BATCH_SIZE) {
+        cerr << "ERROR: batch of " << n << " queries, at most " << MAX_BATCH_SIZE << " are allowed" << endl;
+        fout.write((char*)&BAD, sizeof(char));
+        return false;
     }
 
-    vector<TID> query;
-    stringstream ss(expr);
-    string s;
-    while (ss >> s) {
-        query.push_back(stoul(s));
+    vector<BatchItem> batch(n);
+    for (auto &item : batch) {
+        fin.read((char*)&item.tag, sizeof(unsigned int));
+        item.valid = readString(fin, item.expr);
+
+        stringstream ss(item.expr);
+        string s;
+        while (ss >> s) {
+            if (!isdigit((unsigned char)s[0])) continue;
+            char *end;
+            errno = 0;
+            unsigned long term = strtoul(s.c_str(), &end, 10);
+            if (*end == '\0' && errno == 0) item.terms.push_back(term);
+        }
+        sort(item.terms.begin(), item.terms.end());
+    }
+
+    // Queries sharing terms go one after another, so the postings and
+    // TF blocks loaded for one of them are still hot for the next.
+    stable_sort(batch.begin(), batch.end(), [](const BatchItem &a, const BatchItem &b) {
+        return a.terms < b.terms;
+    });
+
+    fout.write((char*)&OK, sizeof(char));
+    fout.flush();
+
+    for (auto &item : batch) {
+        auto start = chrono::steady_clock::now();
+        auto session = newSession(item.expr, item.valid);
+        auto iter = session->iter;
+        unsigned int id = SESSIONS.add(session);
+
+        fout.write((char*)&item.tag, sizeof(unsigned int));
+
+        if (iter == nullptr) {
+            Metrics::add(Metrics::BAD_QUERIES);
+            fout.write((char*)&BAD, sizeof(char));
+            SESSIONS.close(id);
+        } else {
+            vector<TID> v = getNextDocIds(iter);
+            unsigned int cnt = v.size();
+            Metrics::observe(Metrics::queryLatency(item.expr), elapsedUs(start));
+
+            fout.write((char*)&OK_PAYLOAD, sizeof(char));
+            fout.write((char*)&id, sizeof(unsigned int));
+            fout.write((char*)&cnt, sizeof(unsigned int));
+            fout.write((char*)v.data(), sizeof(TID) * cnt);
+            if (cnt < RESPONSE_BLOCK_SIZE) {
+                SESSIONS.close(id);
+            }
+        }
+
+        fout.flush();
     }
 
-    if (query.size() == 0) return nullptr;
-    return new RankDecorator(query);
+    return true;
 }
 
 
-void sendNextDocId(RankDecorator* iter) {
-    vector<TID> v;
+/*
+ * Reload frame: length and index directory, empty means the current one.
+ * Response is OK if loading is started, the new generation is used by
+ * new requests once it is loaded, the open ones stay on their own.
+ * A single index directory still in use is refused with BAD, a rebuilt
+ * index is reloaded from a new directory; a segmented one from the same.
+ */
+void processReloadRequest(istream &fin, ostream &fout) {
+    cout << "Reload request" << endl;
+
+    string path;
+    if (!readString(fin, path)) {
+        fout.write((char*)&BAD, sizeof(char));
+        return;
+    }
+    if (path.empty()) {
+        path = INDEX->get()->path;
+    }
 
-    while (!iter->end() && v.size() < RESPONSE_BLOCK_SIZE) {
-        v.push_back(iter->get());
-        iter->next();
-    } 
+    cout << "PATH = " << path << endl;
+
+    if (INDEX->reload(path)) {
+        fout.write((char*)&OK, sizeof(char));
+    } else {
+        fout.write((char*)&BAD, sizeof(char));
+    }
+}
 
-    unsigned int n = v.size();
 
-    ofstream fout(RESPONSE_PIPE, ios::binary);
+/* Response payload is the active generation and 1 if reload is in progress */
+void processGenerationRequest(ostream &fout) {
+    unsigned int n = 2;
+    unsigned int generation = INDEX->generation();
+    unsigned int loading = INDEX->isLoading();
 
     fout.write((char*)&OK_PAYLOAD, sizeof(char));
     fout.write((char*)&n, sizeof(unsigned int));
-    for (TID id : v) {
-        cout << id << ' ';
-        fout.write((char*)&id, sizeof(TID));
-    }
-    cout << endl;
-
-    fout.close();
+    fout.write((char*)&generation, sizeof(unsigned int));
+    fout.write((char*)&loading, sizeof(unsigned int));
 }
 
 
-int main() {
-    cout << "Started listening to pipe..." << endl;
+/*
+ * Trace frame: length and expression, like a new request. The query runs
+ * with its trace on and gets a regular request id, its first page is in
+ * the response, the next ones are fetched with EXIST_REQ as usual.
+ * Response: OK_TEXT, length and a JSON object with the id, the doc ids,
+ * phase timings and work counters. With --trace-dir the events of the
+ * query are written there as trace_<id>.json for chrome://tracing.
+ */
+void processTraceRequest(istream &fin, ostream &fout) {
+    string expr;
+    bool valid = readString(fin, expr);
+
+    QueryTrace trace(!TRACE_DIR.empty());
+    QueryTrace::current = &trace;
+
+    Session *session;
+    {
+        TracePhase phase(QueryTrace::PARSE);
+        session = newSession(expr, valid);
+    }
+    vector<TID> v;
+    if (session->iter != nullptr) {
+        TracePhase phase(QueryTrace::RANK);
+        v = getNextDocIds(session->iter);
+    }
 
-    while (true) {
-        ifstream fin(REQUEST_PIPE, ios::binary);
+    QueryTrace::current = nullptr;
 
-        char cmd;
-        fin.read(&cmd, sizeof(char));
+    unsigned int id = SESSIONS.add(session);
 
-        if (cmd == NEW_REQ) {
-            cout << "New request" << endl;
+    if (session->iter == nullptr) {
+        Metrics::add(Metrics::BAD_QUERIES);
+        fout.write((char*)&BAD, sizeof(char));
+        SESSIONS.close(id);
+        return;
+    }
+    if (v.size() < RESPONSE_BLOCK_SIZE) {
+        SESSIONS.close(id);
+    }
 
-            unsigned int length;
-            fin.read((char*)&length, sizeof(unsigned int));
+    stringstream ss;
+    ss << "{\"id\": " << id << ", \"query\": " << QueryTrace::quoted(expr) << ", \"docs\": [";
+    for (size_t i = 0; i < v.size(); i++) {
+        ss << (i ? ", " : "") << v[i];
+    }
+    ss << "], ";
+    trace.writeSummary(ss);
+    ss << "}";
 
-            fin.read(BUFFER, sizeof(char) * length);
-            BUFFER[length] = '\0';
+    string text = ss.str();
+    unsigned int n = text.size();
+    fout.write((char*)&OK_TEXT, sizeof(char));
+    fout.write((char*)&n, sizeof(unsigned int));
+    fout.write(text.data(), n);
 
-            fin.close();
+    if (!TRACE_DIR.empty()) {
+        ofstream ftrace(TRACE_DIR + "/trace_" + to_string(id) + ".json");
+        trace.writeChrome(ftrace, expr);
+        if (!ftrace) {
+            cerr << "ERROR: Can't write trace to '" << TRACE_DIR << "'" << endl;
+        }
+    }
+}
 
-            string expr = string(BUFFER);
 
-            cout << "LEN = " << length << ", STR = " << expr << endl;
+/* Response: OK_TEXT, length and all metrics in the Prometheus text format */
+void processStatsRequest(ostream &fout) {
+    stringstream ss;
+    Metrics::writePrometheus(ss);
 
-            auto iter = getIterator(expr);
+    string text = ss.str();
+    unsigned int n = text.size();
+    fout.write((char*)&OK_TEXT, sizeof(char));
+    fout.write((char*)&n, sizeof(unsigned int));
+    fout.write(text.data(), n);
+}
 
-            ofstream fout(RESPONSE_PIPE, ios::binary);
 
-            if (iter == nullptr) {
-                fout.write((char*)&BAD, sizeof(char));
-            } else {
-                fout.write((char*)&OK, sizeof(char));
-            }
+/* Rewrites the metrics file every interval, renamed into place so a scraper never reads half of it */
+void writeMetricsLoop() {
+    string tmp = METRICS_FILE + ".tmp";
+    while (true) {
+        this_thread::sleep_for(chrono::seconds(METRICS_INTERVAL));
 
-            fout.close();
+        ofstream fout(tmp);
+        Metrics::writePrometheus(fout);
+        fout.close();
+        if (!fout || rename(tmp.c_str(), METRICS_FILE.c_str()) != 0) {
+            cerr << "ERROR: Can't write metrics to '" << METRICS_FILE << "'" << endl;
+        }
+    }
+}
 
-            requests.push_back(iter);
 
-            cout << "ID = " << requests.size() - 1 << endl;
+/*
+ * usage: search_engine [index_dir] [--trace-dir=DIR] [--metrics-file=PATH] [--metrics-interval=SEC]
+ *                      [--max-sessions=N] [--session-ttl=SEC] [--lazy-paging] [--no-verify]
+ * --lazy-paging serves pages before the level is ranked, faster for broad
+ * queries but the pages are not the exact top of the level.
+ * --no-verify skips the checksums of the index on load and reload.
+ */
+int main(int argc, char *argv[]) {
+    string indexDir = WORK_DIR;
+    bool verify = true;
+    for (int i = 1; i < argc; i++) {
+        string arg(argv[i]);
+        if (arg.compare(0, 12, "--trace-dir=") == 0) {
+            TRACE_DIR = arg.substr(12);
+        } else if (arg.compare(0, 15, "--metrics-file=") == 0) {
+            METRICS_FILE = arg.substr(15);
+        } else if (arg.compare(0, 19, "--metrics-interval=") == 0) {
+            METRICS_INTERVAL = max(1, atoi(arg.c_str() + 19));
+        } else if (arg.compare(0, 15, "--max-sessions=") == 0) {
+            SESSIONS.maxSize = max(1, atoi(arg.c_str() + 15));
+        } else if (arg.compare(0, 14, "--session-ttl=") == 0) {
+            SESSIONS.ttl = max(1, atoi(arg.c_str() + 14));
+        } else if (arg == "--lazy-paging") {
+            LAZY_PAGING = true;
+        } else if (arg == "--no-verify") {
+            verify = false;
+        } else {
+            indexDir = arg;
+        }
+    }
 
-        } else if (cmd == EXIST_REQ) {
-            cout << "Exist request" << endl;
+    INDEX = new IndexHolder(indexDir, verify);
+    if (!INDEX->get()) {
+        return 1;
+    }
 
-            unsigned int id;
-            fin.read((char*)&id, sizeof(unsigned int));
+    if (!METRICS_FILE.empty()) {
+        thread(writeMetricsLoop).detach();
+    }
 
-            cout << "ID = " << id << endl;
+    cout << "Started listening to pipe..." << endl;
 
-            fin.close();
+    while (true) {
+        // The whole request is read before the response pipe is opened,
+        // the client writes it before it reads the response, so a frame
+        // larger than the pipe buffer would block both sides otherwise.
+        // Closing the request pipe first also keeps the next client from
+        // writing into it after it gets this response, so no frame is lost.
+        stringstream fin;
+        {
+            ifstream request(REQUEST_PIPE, ios::binary);
+            fin << request.rdbuf();
+        }
 
-            if (id < requests.size()) {
-                sendNextDocId(requests[id]);
+        char cmd;
+        if (!fin.read(&cmd, sizeof(char))) {
+            continue;
+        }
+
+        INDEX->refresh();
+
+        // Client may pipeline several frames into one write. Responses go
+        // into one write as well, in the same order as the frames.
+        ofstream fout(RESPONSE_PIPE, ios::binary);
+
+        do {
+            if (cmd == NEW_REQ) {
+                processNewRequest(fin, fout);
+            } else if (cmd == EXIST_REQ) {
+                processExistRequest(fin, fout);
+            } else if (cmd == BATCH_REQ) {
+                if (!processBatchRequest(fin, fout)) {
+                    break;
+                }
+            } else if (cmd == RELOAD_REQ) {
+                processReloadRequest(fin, fout);
+            } else if (cmd == GENERATION_REQ) {
+                processGenerationRequest(fout);
+            } else if (cmd == TRACE_REQ) {
+                processTraceRequest(fin, fout);
+            } else if (cmd == STATS_REQ) {
+                processStatsRequest(fout);
             } else {
-                ofstream fout(RESPONSE_PIPE, ios::binary);
+                cerr << "Get bad command '" << cmd << "' with code " << ((int)cmd) << endl;
                 fout.write((char*)&BAD, sizeof(char));
-                fout.close();
+                break;
             }
-        } else {
-            cerr << "Get bad command '" << cmd << "' with code " << ((int)cmd) << endl;
-            fin.close();
+        } while (fin.read(&cmd, sizeof(char)));
 
-            ofstream fout(RESPONSE_PIPE, ios::binary);
-            fout.write((char*)&BAD, sizeof(char));
-            fout.close();
-        }
+        fout.close();
     }
 
-    clearVector(requests);
+    delete INDEX;
     delete[] BUFFER;
 
     return 0;
-}
\ No newline at end of file
+}
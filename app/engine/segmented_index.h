@@ -0,0 +1,126 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <tuple>
+#include <iostream>
+#include <sys/stat.h>
+#include "index_loader.h"
+#include "../../index_segments.h"
+
+using namespace std;
+
+
+/*
+ * Segments of the index with the doc id bases. A directory without
+ * the segments list is the single segment. Unless verify is off, every
+ * segment is checked against its manifest checksums and a mismatch fails
+ * the load.
+ */
+class SegmentedIndex {
+private:
+    // inode, size and modification time of a deletions file, zeros if there is none
+    using Stamp = tuple<ino_t, off_t, time_t, long>;
+
+    vector<unique_ptr<Index>> segments;
+    vector<TID> bases;
+    vector<string> paths;
+    vector<Stamp> stamps;
+    vector<int> dirLocks;
+    bool loaded;
+    bool segmented;
+
+    static Stamp deletionsStamp(const string &path) {
+        struct stat st;
+        if (stat((path + Deletions::FILE_PATH).c_str(), &st) != 0) {
+            return Stamp(0, 0, 0, 0);
+        }
+        return Stamp(st.st_ino, st.st_size, st.st_mtim.tv_sec, st.st_mtim.tv_nsec);
+    }
+
+    bool add(const string &path, bool verify) {
+        // taken before the index reads the file, a replacement in between is seen as a change
+        paths.push_back(path);
+        stamps.push_back(deletionsStamp(path));
+        unique_ptr<Index> index(new Index(path));
+        if (!index->isLoaded() || (verify && !index->verify())) {
+            return false;
+        }
+        bases.push_back(bases.empty() ? 0 : bases.back() + segments.back()->getMaxDocId() + 1);
+        segments.push_back(move(index));
+        return true;
+    }
+public:
+    SegmentedIndex(const string &workDir, bool verify = true) {
+        loaded = false;
+        segmented = false;
+
+        vector<string> names;
+        int listLock = Segments::lock(workDir + Segments::LOCK_FILE_PATH, LOCK_SH);
+        if (!Segments::read(workDir + Segments::FILE_PATH, names)) {
+            // it may become the base segment of the directory, gc keeps it then
+            dirLocks.push_back(Segments::lock(workDir, LOCK_SH));
+            Segments::unlock(listLock);
+            loaded = add(workDir, verify);
+            return;
+        }
+        segmented = true;
+
+        // Segment directories stay locked while the index lives, so gc
+        // keeps them for the sessions of this generation
+        for (auto &name : names) {
+            dirLocks.push_back(Segments::lock(workDir + "/" + name, LOCK_SH));
+        }
+        Segments::unlock(listLock);
+
+        for (auto &name : names) {
+            if (!add(workDir + "/" + name, verify)) {
+                cerr << "ERROR: Can't load segment '" << name << "' of '" << workDir << "'" << endl;
+                return;
+            }
+        }
+
+        loaded = !segments.empty();
+    }
+
+    ~SegmentedIndex() {
+        for (int fd : dirLocks) {
+            Segments::unlock(fd);
+        }
+    }
+
+    SegmentedIndex(const SegmentedIndex&) = delete;
+    SegmentedIndex& operator=(const SegmentedIndex&) = delete;
+
+    size_t size() {
+        return segments.size();
+    }
+
+    Index* segment(size_t i) {
+        return segments[i].get();
+    }
+
+    TID base(size_t i) {
+        return bases[i];
+    }
+
+    bool isLoaded() {
+        return loaded;
+    }
+
+    /* True if a deletions file of a segment was replaced since it was loaded */
+    bool deletionsChanged() {
+        for (size_t i = 0; i < paths.size(); i++) {
+            if (deletionsStamp(paths[i]) != stamps[i]) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /* False for a single index directory, its files may be rebuilt in place */
+    bool isSegmented() {
+        return segmented;
+    }
+};
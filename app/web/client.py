@@ -1,5 +1,6 @@
 # -*- coding: utf-8 -*-
 
+import json
 import struct
 import input_parser
 
@@ -10,11 +11,17 @@ RESPONSE_PIPE = '../pipe_B'
 
 NEW_REQ = bytes(chr(0), encoding='ascii')
 EXIST_REQ = bytes(chr(1), encoding='ascii')
+BATCH_REQ = bytes(chr(2), encoding='ascii')
+RELOAD_REQ = bytes(chr(3), encoding='ascii')
+GENERATION_REQ = bytes(chr(4), encoding='ascii')
+TRACE_REQ = bytes(chr(5), encoding='ascii')
+STATS_REQ = bytes(chr(6), encoding='ascii')
 
 
 OK = bytes(chr(0), encoding='ascii')
 OK_PAYLOAD = bytes(chr(1), encoding='ascii')
 BAD = bytes(chr(2), encoding='ascii')
+OK_TEXT = bytes(chr(3), encoding='ascii')
 
 
 MAX_CNT_REQUEST_VAR = 20
@@ -24,11 +31,9 @@ REQ_ID = dict()
 NEXT_ID = 0
 
 
-def get_response():
-    fin = open(RESPONSE_PIPE, 'rb')
-
-    buffer = fin.read()
-    code = struct.unpack_from('c', buffer)[0]
+def _parse_response(buffer, offset=0):
+    code = struct.unpack_from('c', buffer, offset)[0]
+    offset += 1
 
     return_payload = None
     if code == OK:
@@ -37,40 +42,201 @@ def get_response():
     elif code == OK_PAYLOAD:
         print('OK_PAYLOAD')
         size = struct.calcsize('=I')
-        l = struct.unpack_from('=I', buffer, 1)[0]
-        docId = [struct.unpack_from('=I', buffer, 1 + (i + 1) * size)[0] for i in range(l)]
+        l = struct.unpack_from('=I', buffer, offset)[0]
+        docId = [struct.unpack_from('=I', buffer, offset + (i + 1) * size)[0] for i in range(l)]
+        offset += (l + 1) * size
         return_payload = docId
     elif code == BAD:
         print('BAD')
     else:
         print("Bad response code '{}'".format(code))
-    
+
+    return return_payload, offset
+
+
+def get_response():
+    fin = open(RESPONSE_PIPE, 'rb')
+
+    buffer = fin.read()
+    return_payload, _ = _parse_response(buffer)
+
     fin.close()
 
     return return_payload
 
 
+def get_pipelined_responses(n):
+    """Responses to the n requests sent by do_pipelined_requests, in order."""
+    fin = open(RESPONSE_PIPE, 'rb')
+    buffer = fin.read()
+    fin.close()
+
+    result = []
+    offset = 0
+    for _ in range(n):
+        return_payload, offset = _parse_response(buffer, offset)
+        result.append(return_payload)
+
+    return result
+
+
+def _pack_request(s):
+    global REQ_ID, NEXT_ID
+
+    if s in REQ_ID:
+        id = REQ_ID[s]
+        return struct.pack('=cI', EXIST_REQ, id)
+
+    REQ_ID[s] = NEXT_ID
+    NEXT_ID += 1
+    s = bytes(s, encoding='utf-8')
+    return struct.pack('=cI{}s'.format(len(s)), NEW_REQ, len(s), s)
+
+
 def do_request(s):
     if len(s) == 0:
         print('Empty string')
         return False
 
+    data = _pack_request(s)
+
+    fout = open(REQUEST_PIPE, 'wb')
+    fout.write(data)
+    fout.close()
+
+    return True
+
+
+def request(s):
+    """do_request and get_response in one call, None for a bad or empty query."""
+    if not do_request(s):
+        return None
+    return get_response()
+
+
+def do_pipelined_requests(strings):
+    """Send several requests in one write, responses are read by get_pipelined_responses."""
+    strings = [s for s in strings if len(s)]
+    if len(strings) == 0:
+        return 0
+
+    data = b''.join(_pack_request(s) for s in strings)
+
+    fout = open(REQUEST_PIPE, 'wb')
+    fout.write(data)
+    fout.close()
+
+    return len(strings)
+
+
+def do_batch_request(strings):
+    """
+    Send all queries in one batch frame, tag of the query is its index in strings.
+    Yields (tag, doc ids of the first page) as the engine finishes them,
+    doc ids is None for a bad query. Next pages are available via do_request.
+    """
     global REQ_ID, NEXT_ID
 
-    if s in REQ_ID:
-        id = REQ_ID[s]
-        data = struct.pack('=cI', EXIST_REQ, id)
-    else:
-        REQ_ID[s] = NEXT_ID
-        NEXT_ID += 1
+    data = [struct.pack('=cI', BATCH_REQ, len(strings))]
+    for tag, s in enumerate(strings):
         s = bytes(s, encoding='utf-8')
-        data = struct.pack('=cI{}s'.format(len(s)), NEW_REQ, len(s), s)
+        data.append(struct.pack('=II{}s'.format(len(s)), tag, len(s), s))
 
     fout = open(REQUEST_PIPE, 'wb')
-    fout.write(data)
+    fout.write(b''.join(data))
     fout.close()
 
-    return True
+    fin = open(RESPONSE_PIPE, 'rb')
+
+    code = fin.read(1)
+    if code != OK:
+        print("Bad batch response code '{}'".format(code))
+        fin.close()
+        return
+
+    size = struct.calcsize('=I')
+    for _ in range(len(strings)):
+        tag, code = struct.unpack('=Ic', fin.read(size + 1))
+        if code != OK_PAYLOAD:
+            # engine still allocates a request id for a bad query
+            NEXT_ID += 1
+            yield tag, None
+            continue
+
+        id, l = struct.unpack('=II', fin.read(2 * size))
+        docId = list(struct.unpack('={}I'.format(l), fin.read(l * size)))
+
+        REQ_ID[strings[tag]] = id
+        NEXT_ID = max(NEXT_ID, id + 1)
+        yield tag, docId
+
+    fin.close()
+
+
+def do_reload(path=''):
+    """Asks the engine to load index from path (current one if empty) in background."""
+    path = bytes(path, encoding='utf-8')
+    fout = open(REQUEST_PIPE, 'wb')
+    fout.write(struct.pack('=cI{}s'.format(len(path)), RELOAD_REQ, len(path), path))
+    fout.close()
+
+    return get_response() is not None
+
+
+def do_trace(s):
+    """
+    Runs the query with its trace on. Returns the trace as a dict: request id,
+    doc ids of the first page, phase timings in ms and work counters; None for
+    a bad query. Next pages are fetched by EXIST_REQ of the id.
+    """
+    global NEXT_ID
+
+    data = bytes(s, encoding='utf-8')
+    fout = open(REQUEST_PIPE, 'wb')
+    fout.write(struct.pack('=cI{}s'.format(len(data)), TRACE_REQ, len(data), data))
+    fout.close()
+
+    fin = open(RESPONSE_PIPE, 'rb')
+    buffer = fin.read()
+    fin.close()
+
+    if buffer[:1] != OK_TEXT:
+        # engine still allocates a request id for a bad query
+        NEXT_ID += 1
+        return None
+
+    l = struct.unpack_from('=I', buffer, 1)[0]
+    trace = json.loads(buffer[5:5 + l].decode('utf-8'))
+    NEXT_ID = max(NEXT_ID, trace['id'] + 1)
+    return trace
+
+
+def get_generation():
+    """Returns (active index generation, True if reload is in progress)."""
+    fout = open(REQUEST_PIPE, 'wb')
+    fout.write(GENERATION_REQ)
+    fout.close()
+
+    res = get_response()
+    if res is None:
+        return None
+    return res[0], bool(res[1])
+
+
+def get_stats():
+    """Returns the engine metrics in the Prometheus text format."""
+    fout = open(REQUEST_PIPE, 'wb')
+    fout.write(STATS_REQ)
+    fout.close()
+
+    fin = open(RESPONSE_PIPE, 'rb')
+    buffer = fin.read()
+    fin.close()
+
+    if buffer[:1] != OK_TEXT:
+        return None
+    l = struct.unpack_from('=I', buffer, 1)[0]
+    return buffer[5:5 + l].decode('utf-8')
 
 
 if __name__ == '__main__':
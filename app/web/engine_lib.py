@@ -0,0 +1,130 @@
+# -*- coding: utf-8 -*-
+
+"""
+In-process replacement of client.py: the same request interface on top of
+libsearch.so loaded with ctypes, no pipes involved. ctypes releases the GIL
+during the calls, so it is safe to use from several threads: the library
+serializes the calls on the index and CURSORS is guarded by CURSORS_LOCK.
+
+Cursors are closed like the engine sessions: after a short page, when idle
+for CURSOR_TTL seconds or when least recently used of MAX_CURSORS. A query
+whose cursor is closed after its last page gets None, like BAD of the engine.
+"""
+
+import ctypes
+import threading
+import time
+from collections import OrderedDict
+from client import MAX_CNT_REQUEST_VAR
+
+
+RESPONSE_BLOCK_SIZE = 50
+MAX_CURSORS = 10000
+CURSOR_TTL = 600
+
+
+LIB = None
+INDEX = None
+
+# query -> [cursor, last use time], cursor is None once it is closed
+CURSORS = OrderedDict()
+CURSORS_LOCK = threading.Lock()
+
+
+def init(lib_path, index_path):
+    global LIB, INDEX
+
+    LIB = ctypes.CDLL(lib_path)
+
+    LIB.search_open.restype = ctypes.c_void_p
+    LIB.search_open.argtypes = [ctypes.c_char_p]
+    LIB.search_close.argtypes = [ctypes.c_void_p]
+    LIB.search_cursor_open.restype = ctypes.c_void_p
+    LIB.search_cursor_open.argtypes = [ctypes.c_void_p, ctypes.c_char_p]
+    LIB.search_cursor_next.restype = ctypes.c_int
+    LIB.search_cursor_next.argtypes = [ctypes.c_void_p, ctypes.c_uint, ctypes.POINTER(ctypes.c_uint)]
+    LIB.search_cursor_close.argtypes = [ctypes.c_void_p]
+    LIB.search_reload.restype = ctypes.c_int
+    LIB.search_reload.argtypes = [ctypes.c_void_p, ctypes.c_char_p]
+    LIB.search_generation.restype = ctypes.c_uint
+    LIB.search_generation.argtypes = [ctypes.c_void_p]
+    LIB.search_is_reloading.restype = ctypes.c_int
+    LIB.search_is_reloading.argtypes = [ctypes.c_void_p]
+
+    INDEX = LIB.search_open(bytes(index_path, encoding='utf-8'))
+    if not INDEX:
+        raise RuntimeError("Can't open index '{}'".format(index_path))
+
+
+def _close_cursor(s):
+    cursor = CURSORS[s][0]
+    if cursor:
+        LIB.search_cursor_close(cursor)
+    CURSORS[s][0] = None
+
+
+def _expire(keep):
+    """Drops the idle cursors and the least recently used ones above keep."""
+    deadline = time.monotonic() - CURSOR_TTL
+    while CURSORS:
+        s, (cursor, used) = next(iter(CURSORS.items()))
+        if used >= deadline and len(CURSORS) <= keep:
+            break
+        _close_cursor(s)
+        del CURSORS[s]
+
+
+def request(s):
+    """
+    The first request of s opens its cursor and returns [], the next ones
+    return the next pages of doc ids. None for a bad or empty query and
+    once the last page of s was returned.
+    """
+    if len(s) == 0:
+        print('Empty string')
+        return None
+
+    # The cursor is used under the lock, so it can't be closed by another
+    # thread meanwhile; the library serializes the calls anyway.
+    with CURSORS_LOCK:
+        _expire(MAX_CURSORS)
+        if s not in CURSORS:
+            _expire(MAX_CURSORS - 1)
+            cursor = LIB.search_cursor_open(INDEX, bytes(s, encoding='utf-8'))
+            CURSORS[s] = [cursor, time.monotonic()]
+            return [] if cursor else None
+
+        CURSORS.move_to_end(s)
+        entry = CURSORS[s]
+        entry[1] = time.monotonic()
+        if entry[0] is None:
+            return None
+
+        buffer = (ctypes.c_uint * RESPONSE_BLOCK_SIZE)()
+        n = LIB.search_cursor_next(entry[0], RESPONSE_BLOCK_SIZE, buffer)
+        if n < RESPONSE_BLOCK_SIZE:
+            _close_cursor(s)
+        if n < 0:
+            return None
+        return list(buffer[:n])
+
+
+def do_reload(path=''):
+    return LIB.search_reload(INDEX, bytes(path, encoding='utf-8')) == 0
+
+
+def get_generation():
+    return LIB.search_generation(INDEX), bool(LIB.search_is_reloading(INDEX))
+
+
+def close():
+    global INDEX
+
+    with CURSORS_LOCK:
+        for s in CURSORS:
+            _close_cursor(s)
+        CURSORS.clear()
+
+    if INDEX:
+        LIB.search_close(INDEX)
+        INDEX = None
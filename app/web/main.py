@@ -8,7 +8,6 @@ from flask import Flask, request, render_template
 import unicodedata
 import pymorphy2
 
-import client
 import input_parser
 from snippets import get_snippet
 
@@ -23,6 +22,16 @@ TERMS_FILE = WORK_DIR + 'terms'
 TOKENS_DICT_FILE = WORK_DIR + 'dict'
 TOKEN_LEMS_DICT_FILE = WORK_DIR + 'lemms_dict'
 
+# path to libsearch.so, if set the engine runs in-process instead of behind the pipes
+SEARCH_LIB = os.environ.get('SEARCH_LIB')
+
+
+if SEARCH_LIB:
+    import engine_lib as client
+    client.init(SEARCH_LIB, WORK_DIR)
+else:
+    import client
+
 
 TERM_TO_ID = dict()
 DOCS_META = dict()
@@ -186,8 +195,7 @@ def search():
             p = int(p)
 
         if text not in DOC_ID:
-            client.do_request(text)
-            client.get_response()
+            client.request(text)
             DOC_ID[text] = []
 
         l = DOC_ID[text]
@@ -199,8 +207,7 @@ def search():
                 return render_template('search.html', error='Ничего не найдено (＞﹏＜)', time=timing())
 
             for _ in range(max_p + 1, p + 1):
-                client.do_request(text)
-                res = client.get_response()
+                res = client.request(text)
 
                 if res is None:
                     break
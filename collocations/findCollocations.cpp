@@ -1,124 +1,924 @@
 #include <bits/stdc++.h>
 #include <experimental/filesystem>
 
+#include "../token_map.h"
+
 using namespace std;
 
 #define forn(i, n) for (int i = 0; i < n; ++i)
 #define all(x) (x).begin(), (x).end()
 
-#define mp(a, b) make_pair(a, b)
-
 using ll = long long;
-using TCollocation = pair<string, string>;
+using TID = uint32_t;
 
 namespace fs = std::experimental::filesystem;
 
 
-void doTtest(ll total, ll docs, map<TCollocation, ll> &both, map<string, ll> &single, vector<pair<double, TCollocation>> &result) {
-    for (auto &i : both) {
-        double mean_1 = (static_cast<double>(single[i.first.first]) / total) * (static_cast<double>(single[i.first.second]) / total);
-        double mean_2 = static_cast<double>(i.second) / (total - docs);
+/* Bigram of token ids packed in 64 bits */
+inline uint64_t bigramKey(TID a, TID b) {
+    return (uint64_t)a << 32 | b;
+}
+
+
+/*
+ * Bigram counts in an open addressing table with linear probing, keys and
+ * counts are separate arrays. It starts small: a worker has a table per
+ * shard, so (threads + 1) * threads of them, and most shards of a worker
+ * get few bigrams.
+ */
+class BigramCounter {
+private:
+    static constexpr uint64_t EMPTY = -1;
+    static const size_t INITIAL_SLOTS = 1 << 10;
+
+    vector<uint64_t> keys;
+    vector<uint32_t> counts;
+    size_t used;
+
+    static size_t slotOf(uint64_t key, size_t mask) {
+        key *= 0x9E3779B97F4A7C15ULL;
+        return (key ^ (key >> 32)) & mask;
+    }
+
+    void grow() {
+        vector<uint64_t> oldKeys(keys.size() * 2, EMPTY);
+        vector<uint32_t> oldCounts(counts.size() * 2, 0);
+        oldKeys.swap(keys);
+        oldCounts.swap(counts);
+
+        size_t mask = keys.size() - 1;
+        forn(i, (int)oldKeys.size()) {
+            if (oldKeys[i] == EMPTY) continue;
+            size_t j = slotOf(oldKeys[i], mask);
+            while (keys[j] != EMPTY) j = (j + 1) & mask;
+            keys[j] = oldKeys[i];
+            counts[j] = oldCounts[i];
+        }
+    }
+public:
+    BigramCounter() : keys(INITIAL_SLOTS, EMPTY), counts(INITIAL_SLOTS, 0), used(0) {}
+
+    void add(uint64_t key, uint32_t count = 1) {
+        size_t mask = keys.size() - 1;
+        size_t i = slotOf(key, mask);
+        while (keys[i] != EMPTY) {
+            if (keys[i] == key) {
+                counts[i] += count;
+                return;
+            }
+            i = (i + 1) & mask;
+        }
+
+        keys[i] = key;
+        counts[i] = count;
+        if (++used * 10 > keys.size() * 7) grow();
+    }
+
+    /* Grows the table for n keys at once, merging a table in its slot order into a small one would make long clusters */
+    void reserve(size_t n) {
+        while (n * 10 > keys.size() * 7) grow();
+    }
+
+    template<typename F>
+    void forEach(F f) const {
+        forn(i, (int)keys.size()) {
+            if (keys[i] != EMPTY) f(keys[i], counts[i]);
+        }
+    }
+
+    size_t size() const {
+        return used;
+    }
+};
+
+
+/*
+ * Bigram counts of a worker split into shards by the high bits of the
+ * hash, the last table keeps bigrams with tokens out of the dictionary,
+ * their ids are local to the worker until the merge.
+ */
+class ShardedBigrams {
+private:
+    size_t dictSize;
+public:
+    vector<BigramCounter> shards;
+
+    ShardedBigrams(size_t shardsNum, size_t dictSize) : dictSize(dictSize), shards(shardsNum + 1) {}
+
+    static size_t shardOf(uint64_t key, size_t shardsNum) {
+        return ((key * 0x9E3779B97F4A7C15ULL) >> 40) % shardsNum;
+    }
+
+    void add(uint64_t key) {
+        size_t shardsNum = shards.size() - 1;
+        if ((key >> 32) < dictSize && (TID)key < dictSize) {
+            shards[shardOf(key, shardsNum)].add(key);
+        } else {
+            shards[shardsNum].add(key);
+        }
+    }
+};
+
+
+/*
+ * Conservative update count-min sketch: a bigram increments only the
+ * counters of its DEPTH rows that are equal to the minimum of them, so
+ * the estimate, the minimum, is never below the true count.
+ */
+class CountMinSketch {
+private:
+    static const unsigned int DEPTH = 4;
+
+    size_t width;
+    vector<uint32_t> counters;
+
+    size_t column(uint64_t key, unsigned int row) const {
+        key = (key + row) * 0x9E3779B97F4A7C15ULL;
+        key ^= key >> 31;
+        key *= 0xBF58476D1CE4E5B9ULL;
+        return (key ^ (key >> 29)) % width;
+    }
+public:
+    CountMinSketch(size_t bytes) : width(max<size_t>(bytes / DEPTH / sizeof(uint32_t), 1)), counters(width * DEPTH, 0) {}
+
+    /* Adds the bigram, returns its new estimate */
+    uint32_t add(uint64_t key) {
+        size_t cols[DEPTH];
+        uint32_t estimate = UINT32_MAX;
+        forn(r, (int)DEPTH) {
+            cols[r] = r * width + column(key, r);
+            estimate = min(estimate, counters[cols[r]]);
+        }
+        estimate++;
+        forn(r, (int)DEPTH) {
+            counters[cols[r]] = max(counters[cols[r]], estimate);
+        }
+        return estimate;
+    }
+};
+
+
+/*
+ * SpaceSaving heavy hitters: the capacity most frequent bigrams with
+ * overestimated counts, a new bigram replaces the one with the minimal
+ * count. Every bigram more frequent than the minimal count is kept.
+ * Counts are in a min-heap, keys are found by a linear probing table of
+ * entry numbers. Estimates of the sketch are used as the counts of new
+ * bigrams, a bigram not above the minimum doesn't replace anything.
+ */
+class HeavyHitters {
+public:
+    static constexpr uint32_t NO_ENTRY = -1;
+private:
+    struct Entry {
+        uint64_t key;
+        uint32_t count;
+        uint32_t heapPos;
+    };
+
+    size_t capacity;
+    vector<Entry> entries;
+    vector<uint32_t> heap;
+    vector<uint32_t> slots;
+    size_t mask;
+
+    size_t slotOf(uint64_t key) const {
+        key *= 0x9E3779B97F4A7C15ULL;
+        return (key ^ (key >> 32)) & mask;
+    }
+
+    void swapHeap(size_t i, size_t j) {
+        swap(heap[i], heap[j]);
+        entries[heap[i]].heapPos = i;
+        entries[heap[j]].heapPos = j;
+    }
+
+    void siftDown(size_t i) {
+        while (true) {
+            size_t m = i;
+            size_t l = 2 * i + 1, r = 2 * i + 2;
+            if (l < heap.size() && entries[heap[l]].count < entries[heap[m]].count) m = l;
+            if (r < heap.size() && entries[heap[r]].count < entries[heap[m]].count) m = r;
+            if (m == i) return;
+            swapHeap(i, m);
+            i = m;
+        }
+    }
+
+    void siftUp(size_t i) {
+        while (i > 0 && entries[heap[i]].count < entries[heap[(i - 1) / 2]].count) {
+            swapHeap(i, (i - 1) / 2);
+            i = (i - 1) / 2;
+        }
+    }
+
+    void insertSlot(uint64_t key, uint32_t e) {
+        size_t i = slotOf(key);
+        while (slots[i] != NO_ENTRY) i = (i + 1) & mask;
+        slots[i] = e;
+    }
+
+    /* Backward shift deletion, so probing needs no tombstones */
+    void eraseSlot(uint64_t key) {
+        size_t i = slotOf(key);
+        while (entries[slots[i]].key != key) i = (i + 1) & mask;
+
+        size_t j = i;
+        while (true) {
+            j = (j + 1) & mask;
+            if (slots[j] == NO_ENTRY) break;
+            size_t home = slotOf(entries[slots[j]].key);
+            if (((j - home) & mask) >= ((j - i) & mask)) {
+                slots[i] = slots[j];
+                i = j;
+            }
+        }
+        slots[i] = NO_ENTRY;
+    }
+public:
+    static const size_t BYTES_PER_ENTRY = sizeof(Entry) + sizeof(uint32_t) + 2 * sizeof(uint32_t);
+
+    HeavyHitters(size_t bytes) : capacity(max<size_t>(bytes / BYTES_PER_ENTRY, 1)) {
+        size_t slotsNum = 1;
+        while (slotsNum < capacity * 2) slotsNum *= 2;
+        slots.assign(slotsNum, NO_ENTRY);
+        mask = slotsNum - 1;
+        entries.reserve(capacity);
+        heap.reserve(capacity);
+    }
+
+    uint32_t find(uint64_t key) const {
+        size_t i = slotOf(key);
+        while (slots[i] != NO_ENTRY) {
+            if (entries[slots[i]].key == key) return slots[i];
+            i = (i + 1) & mask;
+        }
+        return NO_ENTRY;
+    }
+
+    void add(uint64_t key, uint32_t estimate) {
+        uint32_t e = find(key);
+        if (e != NO_ENTRY) {
+            entries[e].count++;
+            siftDown(entries[e].heapPos);
+            return;
+        }
+
+        if (entries.size() < capacity) {
+            e = entries.size();
+            entries.push_back(Entry{key, estimate, (uint32_t)heap.size()});
+            heap.push_back(e);
+            insertSlot(key, e);
+            siftUp(heap.size() - 1);
+            return;
+        }
+
+        e = heap[0];
+        if (estimate <= entries[e].count) return;
+
+        eraseSlot(entries[e].key);
+        entries[e].key = key;
+        entries[e].count = estimate;
+        insertSlot(key, e);
+        siftDown(0);
+    }
+
+    size_t size() const {
+        return entries.size();
+    }
+
+    size_t maxSize() const {
+        return capacity;
+    }
+
+    /* Count of the least kept bigram, every bigram not kept occurred at most so many times */
+    uint32_t minCount() const {
+        return entries.size() < capacity ? 0 : entries[heap[0]].count;
+    }
+
+    /* Exact count of the entry found by the second pass, the heap is not used after it */
+    void setCount(uint32_t e, uint32_t count) {
+        entries[e].count = count;
+    }
+
+    template<typename F>
+    void forEach(F f) const {
+        for (auto &e : entries) f(e.key, e.count);
+    }
+};
+
+
+/*
+ * Tokens get ids of the dictionary of make_dictionary, tokens out of it
+ * get the next ids. Unigram counts are kept with the counts of the first
+ * and the last tokens of documents: a token is the first word of a bigram
+ * everywhere but at the end of a document and the second one everywhere
+ * but at the beginning.
+ */
+class Counts {
+private:
+    const TokenMap &tokenMap;
+    unordered_map<string, TID> extraIds;
+    vector<string> extraTokens;
+public:
+    ll docs = 0;
+    ll total = 0;
+    vector<ll> single;
+    vector<ll> first;
+    vector<ll> last;
+
+    Counts(const TokenMap &tokenMap) :
+        tokenMap(tokenMap),
+        single(tokenMap.termsNum(), 0), first(tokenMap.termsNum(), 0), last(tokenMap.termsNum(), 0) {}
+
+    TID id(const char *s, size_t n) {
+        TID id = tokenMap.find(s, n);
+        if (id != TokenMap::NO_TERM) return id;
+
+        string token(s, n);
+        auto it = extraIds.find(token);
+        if (it != extraIds.end()) return it->second;
+
+        id = tokenMap.termsNum() + extraTokens.size();
+        extraIds[token] = id;
+        extraTokens.push_back(token);
+        single.push_back(0);
+        first.push_back(0);
+        last.push_back(0);
+        return id;
+    }
+
+    string token(TID id) const {
+        return id < tokenMap.termsNum() ? tokenMap.term(id) : extraTokens[id - tokenMap.termsNum()];
+    }
+
+    ll firstWord(TID id) const {
+        return single[id] - last[id];
+    }
+
+    ll secondWord(TID id) const {
+        return single[id] - first[id];
+    }
+
+    const vector<string>& extras() const {
+        return extraTokens;
+    }
+
+    /* Adds the unigram counts of other, remap gives ids of its tokens here */
+    void merge(const Counts &other, const vector<TID> &remap) {
+        docs += other.docs;
+        total += other.total;
+        forn(i, (int)other.single.size()) {
+            single[remap[i]] += other.single[i];
+            first[remap[i]] += other.first[i];
+            last[remap[i]] += other.last[i];
+        }
+    }
+
+    /* Calls f(id) for the tokens of the document */
+    template<typename F>
+    void forEachToken(const string &text, F f) {
+        size_t i = 0;
+        while (i < text.size()) {
+            while (i < text.size() && isspace((unsigned char)text[i])) i++;
+            size_t start = i;
+            while (i < text.size() && !isspace((unsigned char)text[i])) i++;
+            if (start == i) break;
+
+            f(id(text.data() + start, i - start));
+        }
+    }
+
+    /* Counts unigrams of the document, bigrams go to addBigram(key) */
+    template<typename F>
+    void addDocument(const string &text, F addBigram) {
+        docs++;
+        // An empty document counts as one token like before, so total - docs stays the number of bigrams
+        total++;
+
+        bool started = false;
+        TID a = 0;
+        forEachToken(text, [&](TID b) {
+            single[b]++;
+            if (!started) {
+                first[b]++;
+                started = true;
+            } else {
+                total++;
+                addBigram(bigramKey(a, b));
+            }
+            a = b;
+        });
+
+        if (started) last[a]++;
+    }
+};
+
+
+using TResult = vector<pair<double, uint64_t>>;
+
+
+const int TOP_SIZE = 150;
+const double T_MIN_SCORE = 3.291;
+const ll CHI_MIN_COUNT = 50;
+
+
+/* The first TOP_SIZE by the score, then by the words like pairs of strings */
+void topResult(const Counts &counts, TResult &result) {
+    auto cmp = [&](const pair<double, uint64_t> &x, const pair<double, uint64_t> &y) {
+        if (x.first != y.first) return x.first < y.first;
+        string x1 = counts.token(x.second >> 32), y1 = counts.token(y.second >> 32);
+        if (x1 != y1) return x1 < y1;
+        return counts.token((TID)x.second) < counts.token((TID)y.second);
+    };
+    size_t n = min((size_t)TOP_SIZE, result.size());
+    partial_sort(result.begin(), result.begin() + n, result.end(), cmp);
+    result.resize(n);
+}
+
+
+template<typename TBigrams>
+void doTtest(const Counts &counts, const TBigrams &both, TResult &result) {
+    ll total = counts.total;
+    ll docs = counts.docs;
+    both.forEach([&](uint64_t key, uint32_t n) {
+        double mean_1 = (static_cast<double>(counts.single[key >> 32]) / total) * (static_cast<double>(counts.single[(TID)key]) / total);
+        double mean_2 = static_cast<double>(n) / (total - docs);
         double S = mean_2 * (1.0 - mean_2);
         double t = (mean_2 - mean_1) / sqrt(S / (total - docs));
-        if (t > 3.291) {
-            result.emplace_back(-t, i.first);
+        if (t > T_MIN_SCORE) {
+            result.emplace_back(-t, key);
         }
-    }
+    });
 }
 
 
-void doChiTest(
-    ll total,
-    ll docs,
-    map<TCollocation, ll> &both,
-    map<string, ll> &firstWord,
-    map<string, ll> &secondWord,
-    vector<pair<double, TCollocation>> &result)
-{
-    for (auto &i : both) {
+template<typename TBigrams>
+void doChiTest(const Counts &counts, const TBigrams &both, TResult &result) {
+    ll total = counts.total;
+    ll docs = counts.docs;
+    both.forEach([&](uint64_t key, uint32_t n) {
         double a11, a12, a21, a22;
-        a11 = i.second;
-        a12 = firstWord[i.first.first] - a11;
-        a21 = secondWord[i.first.second] - a11;
+        a11 = n;
+        a12 = counts.firstWord(key >> 32) - a11;
+        a21 = counts.secondWord((TID)key) - a11;
         a22 = total - docs - a12 - a21 + a11;
         double x = (total - docs) * pow(a11 * a22 - a12 * a21, 2.0);
         x /= (a11 + a12) * (a11 + a21) * (a12 + a22) * (a21 + a22);
         if (x > 10.83) {
-            if (a11 > 50 && a12 > 20 && a21 > 20)
-                result.emplace_back(-x, i.first);
+            if (a11 > CHI_MIN_COUNT && a12 > 20 && a21 > 20)
+                result.emplace_back(-x, key);
         }
+    });
+}
+
+
+void printTop(const Counts &counts, const TResult &result) {
+    forn(i, min(TOP_SIZE, (int)result.size())) {
+        cout << counts.token(result[i].second >> 32) << ' ' << counts.token((TID)result[i].second) << endl;
     }
 }
 
 
-int main(int argc, char *argv[]) {
-    ios_base::sync_with_stdio(false);
-    cin.tie(0);
+/* Size like '512M' in bytes, 0 if it can't be parsed */
+size_t parseSize(const string &s) {
+    size_t pos;
+    size_t size;
+    try {
+        size = stoull(s, &pos);
+    } catch (...) {
+        return 0;
+    }
 
-    ll docs = 0;
-    ll total = 0;
-    map<TCollocation, ll> both;
-    map<string, ll> single;
-    map<string, ll> firstWord;
-    map<string, ll> secondWord;
+    string suffix = s.substr(pos);
+    if (suffix == "K" || suffix == "k") return size << 10;
+    if (suffix == "M" || suffix == "m") return size << 20;
+    if (suffix == "G" || suffix == "g") return size << 30;
+    return suffix.empty() ? size : 0;
+}
 
-    if (argc < 2) return 1;
 
-    for (int i = 1; i < argc; i++) {
-        cerr << "Processing '" << argv[i] << "'..." << endl;
-        for (auto& p: fs::recursive_directory_iterator(argv[i])) {
+vector<fs::path> listFiles(char *paths[], int pathsNum) {
+    vector<fs::path> files;
+    forn(i, pathsNum) {
+        cerr << "Listing '" << paths[i] << "'..." << endl;
+        for (auto& p: fs::recursive_directory_iterator(paths[i])) {
             if (fs::is_directory(p)) continue;
+            files.push_back(p.path());
+        }
+    }
+    return files;
+}
 
-            docs++;
 
-            ifstream fin(p.path());
-            
-            string a;
-            string b;
-            fin >> a;
-            single[a]++;
-            total++;
+/* Calls f(worker, text) for every file, files are taken by threadsNum workers */
+template<typename F>
+void forEachDocument(const vector<fs::path> &files, unsigned int threadsNum, F f) {
+    atomic<size_t> nextFile(0);
+    vector<thread> workers;
+    forn(t, (int)threadsNum) {
+        workers.emplace_back([&, t]() {
+            string text;
+            size_t i;
+            while ((i = nextFile++) < files.size()) {
+                ifstream fin(files[i], ios_base::binary);
+                text.assign(istreambuf_iterator<char>(fin), istreambuf_iterator<char>());
+                fin.close();
 
-            while (fin >> b) {
-                total++;
-                both[mp(a, b)]++;
-                firstWord[a]++;
-                secondWord[b]++;
-                single[b]++;
-                a = b;
+                f(t, text);
             }
+        });
+    }
+    for (auto &w : workers) {
+        w.join();
+    }
+}
 
-            fin.close();
-        }
+
+/* Scores tables in parallel, every one keeps its top, then the tops are merged */
+template<typename TBigrams, typename F>
+size_t score(const Counts &counts, const vector<const TBigrams*> &tables, F test, TResult &result) {
+    vector<TResult> tops(tables.size());
+    vector<size_t> accepted(tables.size());
+    vector<thread> workers;
+    forn(i, (int)tables.size()) {
+        workers.emplace_back([&, i]() {
+            test(counts, *tables[i], tops[i]);
+            accepted[i] = tops[i].size();
+            topResult(counts, tops[i]);
+        });
+    }
+    for (auto &w : workers) {
+        w.join();
+    }
+
+    result.clear();
+    for (auto &top : tops) {
+        result.insert(result.end(), all(top));
     }
+    topResult(counts, result);
+    return accumulate(all(accepted), (size_t)0);
+}
 
-    vector<pair<double, TCollocation>> result;
 
-    doTtest(total, docs, both, single, result);
-    sort(all(result));
-    
-    cout << "Number of processed documents: " << docs << endl;
-    cout << "Total bigrams: " << total - docs << endl << endl;
+template<typename TBigrams>
+void printResults(const Counts &counts, const vector<const TBigrams*> &tables) {
+    TResult result;
+    size_t accepted = score(counts, tables, doTtest<TBigrams>, result);
+
+    cout << "Number of processed documents: " << counts.docs << endl;
+    cout << "Total bigrams: " << counts.total - counts.docs << endl << endl;
 
     cout << "---- T test ----" << endl;
-    cout << "Accepted: " << result.size() << endl;
+    cout << "Accepted: " << accepted << endl;
     cout << "TOP 150 collocations:\n" << endl;
-    forn(i, min(150, (int)result.size())) {
-        // cout << result[i].second.first << ' ' << result[i].second.second << '\t' << -result[i].first << endl;
-        cout << result[i].second.first << ' ' << result[i].second.second << endl;
-    }
+    printTop(counts, result);
 
-    result.clear();
-
-    doChiTest(total, docs, both, firstWord, secondWord, result);
-    sort(all(result));
+    accepted = score(counts, tables, doChiTest<TBigrams>, result);
 
     cout << "\n---- Chi test ----" << endl;
-    cout << "Accepted: " << result.size() << endl;
+    cout << "Accepted: " << accepted << endl;
     cout << "TOP 150 collocations:\n" << endl;
-    forn(i, min(150, (int)result.size())) {
-        // cout << result[i].second.first << ' ' << result[i].second.second << '\t' << -result[i].first << endl;
-        cout << result[i].second.first << ' ' << result[i].second.second << endl;
+    printTop(counts, result);
+}
+
+
+/*
+ * Unigram counts of the workers are added to counts and deleted. Tokens out
+ * of the dictionary get ids in the sorted order, so they don't depend on
+ * threads. Returns the ids in counts of the worker ids.
+ */
+vector<vector<TID>> mergeCounts(const TokenMap &tokenMap, const vector<Counts*> &partial, Counts &counts) {
+    vector<string> extras;
+    for (auto p : partial) {
+        extras.insert(extras.end(), all(p->extras()));
+    }
+    sort(all(extras));
+    extras.erase(unique(all(extras)), extras.end());
+    for (auto &e : extras) {
+        counts.id(e.data(), e.size());
+    }
+
+    vector<vector<TID>> remap(partial.size());
+    forn(t, (int)partial.size()) {
+        remap[t].resize(tokenMap.termsNum());
+        iota(all(remap[t]), 0);
+        for (auto &e : partial[t]->extras()) {
+            remap[t].push_back(counts.id(e.data(), e.size()));
+        }
+        counts.merge(*partial[t], remap[t]);
+        delete partial[t];
+    }
+    return remap;
+}
+
+
+/*
+ * Workers count their files into their own Counts and ShardedBigrams.
+ * Tokens out of the dictionary get ids in the sorted order at the merge,
+ * shard s of all workers is merged by thread s, so the result doesn't
+ * depend on threads and the order files are taken.
+ */
+void findExact(const TokenMap &tokenMap, const vector<fs::path> &files, unsigned int threadsNum) {
+    vector<Counts*> partial;
+    vector<ShardedBigrams*> partialBigrams;
+    forn(t, (int)threadsNum) {
+        partial.push_back(new Counts(tokenMap));
+        partialBigrams.push_back(new ShardedBigrams(threadsNum, tokenMap.termsNum()));
+    }
+
+    forEachDocument(files, threadsNum, [&](int t, const string &text) {
+        partial[t]->addDocument(text, [&](uint64_t key) { partialBigrams[t]->add(key); });
+    });
+
+    Counts counts(tokenMap);
+    vector<vector<TID>> remap = mergeCounts(tokenMap, partial, counts);
+
+    vector<BigramCounter> shards(threadsNum);
+    vector<thread> workers;
+    forn(s, (int)threadsNum) {
+        workers.emplace_back([&, s]() {
+            size_t size = 0;
+            for (auto p : partialBigrams) {
+                size += p->shards[s].size();
+            }
+            shards[s].reserve(size);
+            for (auto p : partialBigrams) {
+                p->shards[s].forEach([&](uint64_t key, uint32_t n) { shards[s].add(key, n); });
+                p->shards[s] = BigramCounter();
+            }
+        });
+    }
+    for (auto &w : workers) {
+        w.join();
+    }
+
+    forn(t, (int)threadsNum) {
+        partialBigrams[t]->shards[threadsNum].forEach([&](uint64_t key, uint32_t n) {
+            key = bigramKey(remap[t][key >> 32], remap[t][(TID)key]);
+            shards[ShardedBigrams::shardOf(key, threadsNum)].add(key, n);
+        });
+        delete partialBigrams[t];
+    }
+
+    vector<const BigramCounter*> tables;
+    for (auto &shard : shards) {
+        tables.push_back(&shard);
+    }
+    printResults(counts, tables);
+}
+
+
+/*
+ * A bigram occurring n times in N bigrams has the t score at most
+ * sqrt(n / (1 - n / N)), and the chi test takes only bigrams occurring
+ * more than CHI_MIN_COUNT times. So if the bigrams up to `complete`
+ * occurrences may be missed, both tops are stable when `complete` is not
+ * above CHI_MIN_COUNT and its t bound is below the last t score of the top.
+ * Otherwise a warning tells the budget needed, about inversely proportional
+ * to `complete` for the Zipf law.
+ */
+template<typename TBigrams>
+void checkStableTop(const Counts &counts, const vector<const TBigrams*> &tables, uint64_t complete, size_t bytes) {
+    TResult top;
+    score(counts, tables, doTtest<TBigrams>, top);
+
+    double bigrams = counts.total - counts.docs;
+    double tBound = complete < bigrams ? sqrt(complete / (1 - complete / bigrams)) : INFINITY;
+    double lastT = top.size() == TOP_SIZE ? -top.back().first : T_MIN_SCORE;
+
+    // the largest `complete` for both tests
+    uint64_t limit = CHI_MIN_COUNT;
+    while (limit > 0 && sqrt(limit / (1 - limit / bigrams)) >= lastT) limit--;
+
+    if (complete > limit) {
+        // a top that isn't full yet says nothing of its last score, the estimate is for the chi test
+        uint64_t target = top.size() == TOP_SIZE ? max<uint64_t>(limit, 1) : CHI_MIN_COUNT;
+        size_t needed = (bytes * (complete + 1) / target + (1 << 10) - 1) >> 10;
+        cerr << "WARNING: the budget is too small for a stable top " << TOP_SIZE
+             << ": bigrams occurring up to " << complete << " times may be missed, only up to "
+             << limit << " are allowed (t bound " << tBound << ", last t score " << lastT << ")."
+             << " Try --approximate=" << needed << "K or more" << endl;
+    }
+}
+
+
+/*
+ * Ids of the tokens out of the dictionary shared by the workers of the first
+ * pass, so a bigram has the same key in every worker. A worker asks for the
+ * id once per token, the ids of its Counts stay local.
+ */
+class SharedIds {
+private:
+    mutex m;
+    TID first;
+    unordered_map<string, TID> ids;
+    vector<string> tokens;
+public:
+    SharedIds(TID first) : first(first) {}
+
+    TID id(const string &token) {
+        lock_guard<mutex> lock(m);
+        auto it = ids.find(token);
+        if (it != ids.end()) return it->second;
+        TID id = first + tokens.size();
+        ids[token] = id;
+        tokens.push_back(token);
+        return id;
+    }
+
+    /* Ids in counts of the shared ids of the tokens out of the dictionary */
+    vector<TID> remap(Counts &counts) {
+        vector<TID> r(first);
+        iota(all(r), 0);
+        for (auto &t : tokens) {
+            r.push_back(counts.id(t.data(), t.size()));
+        }
+        return r;
+    }
+};
+
+
+/*
+ * Sketch and SpaceSaving table of the bigrams of one shard, the workers
+ * hand them their bigrams by batches.
+ */
+struct HeavyShard {
+    mutex m;
+    CountMinSketch sketch;
+    HeavyHitters heavy;
+
+    HeavyShard(size_t bytes) : sketch(bytes / 2), heavy(bytes / 2) {}
+
+    void add(const vector<uint64_t> &keys) {
+        lock_guard<mutex> lock(m);
+        for (uint64_t key : keys) {
+            heavy.add(key, sketch.add(key));
+        }
+    }
+};
+
+
+/*
+ * First pass: bigrams are split into shards by key, every shard finds its
+ * heavy hitters with a sketch and SpaceSaving table in its part of the
+ * budget. Workers collect bigrams of their files by shard and hand over
+ * full batches. A bigram missing in the table of its shard occurred at most
+ * minCount of the shard times, so every bigram occurring more than
+ * `complete`, the largest minCount, is in the tables, and the budget doesn't
+ * depend on threads. Second pass: the bigrams of the tables are counted
+ * exactly in one array, it sees only known tokens, so ids are only read by
+ * workers. With a budget too small for a stable top the candidates depend
+ * on the order batches reach the shards.
+ */
+void findApproximate(const TokenMap &tokenMap, const vector<fs::path> &files, unsigned int threadsNum, size_t bytes) {
+    const size_t BATCH_SIZE = 1 << 10;
+    TID dictSize = tokenMap.termsNum();
+
+    vector<HeavyShard*> shards;
+    forn(s, (int)threadsNum) {
+        shards.push_back(new HeavyShard(bytes / threadsNum));
+    }
+
+    SharedIds sharedIds(dictSize);
+    vector<Counts*> partial;
+    // shared ids of the local ids out of the dictionary, batches by shard
+    vector<vector<TID>> shared(threadsNum);
+    vector<vector<vector<uint64_t>>> batches(threadsNum, vector<vector<uint64_t>>(threadsNum));
+    forn(t, (int)threadsNum) {
+        partial.push_back(new Counts(tokenMap));
+    }
+
+    forEachDocument(files, threadsNum, [&](int t, const string &text) {
+        auto sharedId = [&](TID id) {
+            if (id < dictSize) return id;
+            while (shared[t].size() <= id - dictSize) {
+                shared[t].push_back(sharedIds.id(partial[t]->token(dictSize + shared[t].size())));
+            }
+            return shared[t][id - dictSize];
+        };
+        partial[t]->addDocument(text, [&](uint64_t key) {
+            key = bigramKey(sharedId(key >> 32), sharedId((TID)key));
+            auto &batch = batches[t][ShardedBigrams::shardOf(key, threadsNum)];
+            batch.push_back(key);
+            if (batch.size() == BATCH_SIZE) {
+                shards[ShardedBigrams::shardOf(key, threadsNum)]->add(batch);
+                batch.clear();
+            }
+        });
+    });
+    forn(t, (int)threadsNum) {
+        forn(s, (int)threadsNum) {
+            shards[s]->add(batches[t][s]);
+        }
+    }
+    batches = vector<vector<vector<uint64_t>>>();
+
+    // the sketches are done, their half of the budget goes to the second pass
+    for (auto shard : shards) {
+        shard->sketch = CountMinSketch(0);
+    }
+
+    Counts counts(tokenMap);
+    mergeCounts(tokenMap, partial, counts);
+    vector<TID> remap = sharedIds.remap(counts);
+
+    HeavyHitters heavy(bytes / 2);
+    uint64_t complete = 0;
+    for (auto shard : shards) {
+        complete = max<uint64_t>(complete, shard->heavy.minCount());
+        shard->heavy.forEach([&](uint64_t key, uint32_t n) {
+            heavy.add(bigramKey(remap[key >> 32], remap[(TID)key]), n);
+        });
+        delete shard;
+    }
+    cerr << "Counting " << heavy.size() << " heavy hitters exactly, every bigram occurring more than "
+         << complete << " times is among them..." << endl;
+
+    vector<atomic<uint32_t>> exact(heavy.size());
+    forEachDocument(files, threadsNum, [&](int t, const string &text) {
+        bool started = false;
+        TID a = 0;
+        counts.forEachToken(text, [&](TID b) {
+            if (started) {
+                uint32_t e = heavy.find(bigramKey(a, b));
+                if (e != HeavyHitters::NO_ENTRY) exact[e].fetch_add(1, memory_order_relaxed);
+            }
+            started = true;
+            a = b;
+        });
+    });
+    forn(e, (int)heavy.size()) {
+        heavy.setCount(e, exact[e]);
+    }
+
+    vector<const HeavyHitters*> tables = {&heavy};
+    checkStableTop(counts, tables, complete, bytes);
+    printResults(counts, tables);
+}
+
+
+/*
+ * options:
+ * --threads=N, all cores by default
+ * --approximate=N[K|M|G] keeps bigrams in N bytes: the first pass finds
+ * heavy hitters with a count-min sketch and SpaceSaving in halves of N,
+ * split by key between the shards, the second one counts them exactly. Unigram
+ * counts are always exact. Only bigrams more frequent than the least kept
+ * one are scored, so the accepted numbers get smaller. The top lists stay
+ * if every bigram occurring more than 50 times (the chi test minimum) is
+ * kept, otherwise a warning tells the budget needed, see checkStableTop.
+ */
+int main(int argc, char *argv[]) {
+    ios_base::sync_with_stdio(false);
+    cin.tie(0);
+
+    size_t approximate = 0;
+    unsigned int threadsNum = thread::hardware_concurrency();
+    int n = 0;
+    forn(i, argc) {
+        string arg(argv[i]);
+        if (arg.compare(0, 14, "--approximate=") == 0) {
+            approximate = parseSize(arg.substr(14));
+            if (approximate == 0) {
+                cerr << "ERROR: bad memory size " << arg.substr(14) << endl;
+                return 1;
+            }
+        } else if (arg.compare(0, 10, "--threads=") == 0) {
+            threadsNum = stoul(arg.substr(10));
+        } else {
+            argv[n++] = argv[i];
+        }
+    }
+    argc = n;
+    if (threadsNum == 0) threadsNum = 1;
+
+    if (argc < 3) {
+        cerr << "usage: findCollocations [--threads=N] [--approximate=N[K|M|G]] dict.txt paths_to_directories_with_docs..." << endl;
+        return 1;
+    }
+
+    // Every token of dict.txt is its own term, so term ids are token ids
+    vector<pair<string, TID>> tokens;
+    vector<string> terms;
+    vector<char> data;
+    TokenMap tokenMap;
+    if (!TokenMap::readText(argv[1], argv[1], tokens, terms) ||
+        !TokenMap::build(tokens, terms, data) ||
+        !tokenMap.assign(move(data)))
+    {
+        cerr << "ERROR: Can't load the dictionary " << argv[1] << endl;
+        return 1;
+    }
+    tokens.clear();
+    terms.clear();
+
+    vector<fs::path> files = listFiles(argv + 2, argc - 2);
+
+    if (approximate == 0) {
+        findExact(tokenMap, files, threadsNum);
+    } else {
+        findApproximate(tokenMap, files, threadsNum, approximate);
     }
 
     return 0;
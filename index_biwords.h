@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <utility>
+
+
+/*
+ * Biwords of an index: pairs of terms that have their own postings and TF,
+ * a document is in the postings of (a, b) if a is right before b in it.
+ * File: id of the first biword, their number, then pairs of term ids,
+ * the biword i has the term id firstId + i.
+ */
+namespace Biwords {
+    const std::string FILE_PATH = "/biwords";
+
+    inline uint64_t key(uint32_t a, uint32_t b) {
+        return (uint64_t)a << 32 | b;
+    }
+
+    inline bool read(const std::string &path, uint32_t &firstId, std::vector<std::pair<uint32_t, uint32_t>> &pairs) {
+        FILE *fin = fopen(path.c_str(), "rb");
+        if (!fin) return false;
+
+        uint32_t n;
+        bool ok = fread(&firstId, sizeof(uint32_t), 1, fin) == 1 && fread(&n, sizeof(uint32_t), 1, fin) == 1;
+        if (ok) {
+            pairs.resize(n);
+            ok = fread(pairs.data(), sizeof(pairs[0]), n, fin) == n;
+        }
+        fclose(fin);
+        return ok;
+    }
+
+    inline bool write(const std::string &path, uint32_t firstId, const std::vector<std::pair<uint32_t, uint32_t>> &pairs) {
+        FILE *fout = fopen(path.c_str(), "wb");
+        if (!fout) return false;
+
+        uint32_t n = pairs.size();
+        bool ok =
+            fwrite(&firstId, sizeof(uint32_t), 1, fout) == 1 &&
+            fwrite(&n, sizeof(uint32_t), 1, fout) == 1 &&
+            fwrite(pairs.data(), sizeof(pairs[0]), n, fout) == n;
+        return fclose(fout) == 0 && ok;
+    }
+};
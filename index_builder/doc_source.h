@@ -0,0 +1,91 @@
+#pragma once
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cctype>
+
+
+using namespace std;
+
+
+/*
+ * Document of the input: a whole file of text_cleaner tokens, or the text
+ * of <doc id="" url="" title="">...</doc> inside a raw wiki dump file.
+ */
+struct DocSource {
+    static const size_t WHOLE_FILE = -1;
+
+    string path;
+    size_t offset;
+    size_t size;
+    string name;
+    string url;
+    string title;
+
+    bool raw() const {
+        return size != WHOLE_FILE;
+    }
+
+    void read(string &text) const {
+        ifstream fin(path, ios_base::binary);
+        if (raw()) {
+            text.resize(size);
+            fin.seekg(offset);
+            fin.read(&text[0], size);
+        } else {
+            text.assign(istreambuf_iterator<char>(fin), istreambuf_iterator<char>());
+        }
+    }
+};
+
+
+namespace Dump {
+    /* Value of 'name="value"' at text[pos], pos is moved past it, false if there is no such attribute */
+    bool readAttribute(const string &text, size_t &pos, const string &name, string &value) {
+        while (pos < text.size() && isspace((unsigned char)text[pos])) pos++;
+        if (text.compare(pos, name.size() + 2, name + "=\"") != 0) return false;
+        pos += name.size() + 2;
+
+        // The title is the last one and may contain quotes, it ends with '">'
+        size_t end = name == "title" ? text.find("\">", pos) : text.find('"', pos);
+        if (end == string::npos || end == pos) return false;
+
+        value = text.substr(pos, end - pos);
+        pos = end + 1;
+        return true;
+    }
+
+
+    /* Appends documents of the dump file as make_tokens.py splits it */
+    void scan(const string &path, vector<DocSource> &docs) {
+        ifstream fin(path, ios_base::binary);
+        string text((istreambuf_iterator<char>(fin)), istreambuf_iterator<char>());
+
+        size_t pos = 0;
+        while ((pos = text.find("<doc", pos)) != string::npos) {
+            DocSource doc;
+            doc.path = path;
+
+            size_t cur = pos + 4;
+            if (!isspace((unsigned char)text[cur]) ||
+                !readAttribute(text, cur, "id", doc.name) ||
+                doc.name.find_first_not_of("0123456789") != string::npos ||
+                !readAttribute(text, cur, "url", doc.url) ||
+                !readAttribute(text, cur, "title", doc.title))
+            {
+                pos += 4;
+                continue;
+            }
+
+            size_t end = text.find("</doc>", cur + 2);
+            if (end == string::npos) break;
+
+            doc.offset = cur + 1;
+            doc.size = end - doc.offset;
+            docs.push_back(doc);
+            pos = end + 6;
+        }
+    }
+};
@@ -0,0 +1,5361 @@
+#pragma once
+
+#include <cstdint>
+
+
+/* Generated by make_fold_table.py from Unicode 14.0.0, do not edit */
+namespace FoldTable {
+    const uint32_t IDENTITY = 0x40000000;
+    const uint32_t EXPANSION = 0x80000000;
+    const uint32_t SEPARATOR = 0xC0000000;
+    const uint32_t CASED = 0x20000000;
+    const uint32_t CASE_IGNORABLE = 0x10000000;
+    const uint32_t SIGMA = 0x08000000;
+    const uint32_t KIND_MASK = 0xC0000000;
+    const uint32_t VALUE_MASK = 0x07FFFFFF;
+
+    const uint32_t HANGUL_FIRST = 0xAC00;
+    const uint32_t HANGUL_LAST = 0xD7A3;
+    const uint32_t CODE_POINTS = 0x110000;
+
+    const uint16_t STAGE1[4352] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+        16, 17, 18, 19, 20, 17, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+        31, 32, 33, 33, 34, 33, 33, 35, 33, 33, 33, 33, 36, 37, 38, 39,
+        40, 41, 42, 43, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 44, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        45, 17, 17, 17, 46, 17, 47, 48, 49, 50, 51, 52, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 53, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 54, 55, 56, 57, 58, 59, 60,
+        61, 62, 63, 64, 65, 66, 17, 67, 68, 69, 70, 71, 72, 73, 74, 75,
+        76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 33, 87, 88, 89, 90,
+        17, 17, 17, 91, 92, 93, 33, 33, 33, 33, 33, 33, 33, 33, 33, 94,
+        17, 17, 17, 17, 95, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 17, 17, 96, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 17, 17, 97, 98, 33, 33, 99, 100,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 101, 17, 17, 17, 17, 102, 103, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 104,
+        17, 105, 106, 33, 33, 33, 33, 33, 33, 33, 33, 33, 107, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 108, 109, 110, 111, 112, 113, 114, 33, 33, 33, 33, 33, 33, 33, 115,
+        116, 117, 118, 33, 33, 33, 33, 119, 120, 121, 33, 33, 122, 123, 124, 33,
+        33, 125, 126, 33, 33, 33, 33, 33, 33, 33, 33, 127, 33, 33, 33, 33,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 128, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 129, 130, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 131, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 132, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 133, 134, 135, 33, 33, 33, 33, 33,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 136, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+        33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    };
+
+    const uint32_t STAGE2[137][256] = {
+        {
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0x20000061, 0x20000062, 0x20000063, 0x20000064, 0x20000065, 0x20000066, 0x20000067,
+            0x20000068, 0x20000069, 0x2000006A, 0x2000006B, 0x2000006C, 0x2000006D, 0x2000006E, 0x2000006F,
+            0x20000070, 0x20000071, 0x20000072, 0x20000073, 0x20000074, 0x20000075, 0x20000076, 0x20000077,
+            0x20000078, 0x20000079, 0x2000007A, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x20000061, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x32, 0x33, 0xC0000000, 0x200003BC, 0xC0000000, 0xC0000000,
+            0xC0000000, 0x31, 0x2000006F, 0xC0000000, 0x80000000, 0x80000004, 0x80000008, 0xC0000000,
+            0x20000061, 0x20000061, 0x20000061, 0x20000061, 0x20000061, 0x20000061, 0x200000E6, 0x20000063,
+            0x20000065, 0x20000065, 0x20000065, 0x20000065, 0x20000069, 0x20000069, 0x20000069, 0x20000069,
+            0x200000F0, 0x2000006E, 0x2000006F, 0x2000006F, 0x2000006F, 0x2000006F, 0x2000006F, 0xC0000000,
+            0x200000F8, 0x20000075, 0x20000075, 0x20000075, 0x20000075, 0x20000079, 0x200000FE, 0x60000000,
+            0x20000061, 0x20000061, 0x20000061, 0x20000061, 0x20000061, 0x20000061, 0x60000000, 0x20000063,
+            0x20000065, 0x20000065, 0x20000065, 0x20000065, 0x20000069, 0x20000069, 0x20000069, 0x20000069,
+            0x60000000, 0x2000006E, 0x2000006F, 0x2000006F, 0x2000006F, 0x2000006F, 0x2000006F, 0xC0000000,
+            0x60000000, 0x20000075, 0x20000075, 0x20000075, 0x20000075, 0x20000079, 0x60000000, 0x20000079,
+        },
+        {
+            0x20000061, 0x20000061, 0x20000061, 0x20000061, 0x20000061, 0x20000061, 0x20000063, 0x20000063,
+            0x20000063, 0x20000063, 0x20000063, 0x20000063, 0x20000063, 0x20000063, 0x20000064, 0x20000064,
+            0x20000111, 0x60000000, 0x20000065, 0x20000065, 0x20000065, 0x20000065, 0x20000065, 0x20000065,
+            0x20000065, 0x20000065, 0x20000065, 0x20000065, 0x20000067, 0x20000067, 0x20000067, 0x20000067,
+            0x20000067, 0x20000067, 0x20000067, 0x20000067, 0x20000068, 0x20000068, 0x20000127, 0x60000000,
+            0x20000069, 0x20000069, 0x20000069, 0x20000069, 0x20000069, 0x20000069, 0x20000069, 0x20000069,
+            0x20000069, 0x60000000, 0xA000000C, 0xA000000F, 0x2000006A, 0x2000006A, 0x2000006B, 0x2000006B,
+            0x60000000, 0x2000006C, 0x2000006C, 0x2000006C, 0x2000006C, 0x2000006C, 0x2000006C, 0xA0000012,
+            0xA0000015, 0x20000142, 0x60000000, 0x2000006E, 0x2000006E, 0x2000006E, 0x2000006E, 0x2000006E,
+            0x2000006E, 0xA0000018, 0x2000014B, 0x60000000, 0x2000006F, 0x2000006F, 0x2000006F, 0x2000006F,
+            0x2000006F, 0x2000006F, 0x20000153, 0x60000000, 0x20000072, 0x20000072, 0x20000072, 0x20000072,
+            0x20000072, 0x20000072, 0x20000073, 0x20000073, 0x20000073, 0x20000073, 0x20000073, 0x20000073,
+            0x20000073, 0x20000073, 0x20000074, 0x20000074, 0x20000074, 0x20000074, 0x20000167, 0x60000000,
+            0x20000075, 0x20000075, 0x20000075, 0x20000075, 0x20000075, 0x20000075, 0x20000075, 0x20000075,
+            0x20000075, 0x20000075, 0x20000075, 0x20000075, 0x20000077, 0x20000077, 0x20000079, 0x20000079,
+            0x20000079, 0x2000007A, 0x2000007A, 0x2000007A, 0x2000007A, 0x2000007A, 0x2000007A, 0x20000073,
+            0x60000000, 0x20000253, 0x20000183, 0x60000000, 0x20000185, 0x60000000, 0x20000254, 0x20000188,
+            0x60000000, 0x20000256, 0x20000257, 0x2000018C, 0x60000000, 0x60000000, 0x200001DD, 0x20000259,
+            0x2000025B, 0x20000192, 0x60000000, 0x20000260, 0x20000263, 0x60000000, 0x20000269, 0x20000268,
+            0x20000199, 0x60000000, 0x60000000, 0x60000000, 0x2000026F, 0x20000272, 0x60000000, 0x20000275,
+            0x2000006F, 0x2000006F, 0x200001A3, 0x60000000, 0x200001A5, 0x60000000, 0x20000280, 0x200001A8,
+            0x60000000, 0x20000283, 0x60000000, 0x60000000, 0x200001AD, 0x60000000, 0x20000288, 0x20000075,
+            0x20000075, 0x2000028A, 0x2000028B, 0x200001B4, 0x60000000, 0x200001B6, 0x60000000, 0x20000292,
+            0x200001B9, 0x60000000, 0x60000000, 0x40000000, 0x200001BD, 0x60000000, 0x60000000, 0x60000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xA000001B, 0xA000001E, 0xA0000021, 0xA0000024,
+            0xA0000027, 0xA000002A, 0xA000002D, 0xA0000030, 0xA0000033, 0x20000061, 0x20000061, 0x20000069,
+            0x20000069, 0x2000006F, 0x2000006F, 0x20000075, 0x20000075, 0x20000075, 0x20000075, 0x20000075,
+            0x20000075, 0x20000075, 0x20000075, 0x20000075, 0x20000075, 0x60000000, 0x20000061, 0x20000061,
+            0x20000061, 0x20000061, 0x200000E6, 0x200000E6, 0x200001E5, 0x60000000, 0x20000067, 0x20000067,
+            0x2000006B, 0x2000006B, 0x2000006F, 0x2000006F, 0x2000006F, 0x2000006F, 0x20000292, 0x20000292,
+            0x2000006A, 0xA0000036, 0xA0000039, 0xA000003C, 0x20000067, 0x20000067, 0x20000195, 0x200001BF,
+            0x2000006E, 0x2000006E, 0x20000061, 0x20000061, 0x200000E6, 0x200000E6, 0x200000F8, 0x200000F8,
+        },
+        {
+            0x20000061, 0x20000061, 0x20000061, 0x20000061, 0x20000065, 0x20000065, 0x20000065, 0x20000065,
+            0x20000069, 0x20000069, 0x20000069, 0x20000069, 0x2000006F, 0x2000006F, 0x2000006F, 0x2000006F,
+            0x20000072, 0x20000072, 0x20000072, 0x20000072, 0x20000075, 0x20000075, 0x20000075, 0x20000075,
+            0x20000073, 0x20000073, 0x20000074, 0x20000074, 0x2000021D, 0x60000000, 0x20000068, 0x20000068,
+            0x2000019E, 0x60000000, 0x20000223, 0x60000000, 0x20000225, 0x60000000, 0x20000061, 0x20000061,
+            0x20000065, 0x20000065, 0x2000006F, 0x2000006F, 0x2000006F, 0x2000006F, 0x2000006F, 0x2000006F,
+            0x2000006F, 0x2000006F, 0x20000079, 0x20000079, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x20002C65, 0x2000023C, 0x60000000, 0x2000019A, 0x20002C66, 0x60000000,
+            0x60000000, 0x20000242, 0x60000000, 0x20000180, 0x20000289, 0x2000028C, 0x20000247, 0x60000000,
+            0x20000249, 0x60000000, 0x2000024B, 0x60000000, 0x2000024D, 0x60000000, 0x2000024F, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x40000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x20000068, 0x20000266, 0x2000006A, 0x20000072, 0x20000279, 0x2000027B, 0x20000281, 0x20000077,
+            0x20000079, 0x50000000, 0x50000000, 0x50000000, 0x50000000, 0x50000000, 0x50000000, 0x50000000,
+            0x50000000, 0x50000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x50000000, 0x50000000,
+            0x50000000, 0x50000000, 0x50000000, 0x50000000, 0x50000000, 0x50000000, 0x50000000, 0x50000000,
+            0x50000000, 0x50000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x20000263, 0x2000006C, 0x20000073, 0x20000078, 0x20000295, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x50000000, 0xC0000000, 0x50000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x8000003F, 0x80000040, 0x80000041, 0x80000042, 0x80000043, 0x80000044, 0x80000045, 0x80000046,
+            0x80000047, 0x80000048, 0x80000049, 0x8000004A, 0x8000004B, 0x8000004C, 0x8000004D, 0x8000004E,
+            0x8000004F, 0x80000050, 0x80000051, 0x80000052, 0x80000053, 0x80000054, 0x80000055, 0x80000056,
+            0x80000057, 0x80000058, 0x80000059, 0x8000005A, 0x8000005B, 0x8000005C, 0x8000005D, 0x8000005E,
+            0x8000005F, 0x80000060, 0x80000061, 0x80000062, 0x80000063, 0x80000064, 0x80000065, 0x80000066,
+            0x80000067, 0x80000068, 0x80000069, 0x8000006A, 0x8000006B, 0x8000006C, 0x8000006D, 0x8000006E,
+            0x8000006F, 0x80000070, 0x80000071, 0x80000072, 0x80000073, 0x80000074, 0x80000075, 0x80000076,
+            0x80000077, 0x80000078, 0x80000079, 0x8000007A, 0x8000007B, 0x8000007C, 0x8000007D, 0x8000007E,
+            0x8000007F, 0x80000080, 0x80000081, 0x80000082, 0x80000083, 0x80000084, 0x80000085, 0x80000086,
+            0x80000087, 0x80000088, 0x80000089, 0x8000008A, 0x8000008B, 0x8000008C, 0x8000008D, 0xC0000000,
+            0x8000008E, 0x8000008F, 0x80000090, 0x80000091, 0x80000092, 0x80000093, 0x80000094, 0x80000095,
+            0x80000096, 0x80000097, 0x80000098, 0x80000099, 0x8000009A, 0x8000009B, 0x8000009C, 0x8000009D,
+            0x8000009E, 0x8000009F, 0x800000A0, 0x800000A1, 0x800000A2, 0x800000A3, 0x800000A4, 0x800000A5,
+            0x800000A6, 0x800000A7, 0x800000A8, 0x800000A9, 0x800000AA, 0x800000AB, 0x800000AC, 0x800000AD,
+            0x20000371, 0x60000000, 0x20000373, 0x60000000, 0x100002B9, 0xC0000000, 0x20000377, 0x60000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0x60000000, 0x60000000, 0x60000000, 0xC0000000, 0x200003F3,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x200003B1, 0xC0000000,
+            0x200003B5, 0x200003B7, 0x200003B9, 0xC0000000, 0x200003BF, 0xC0000000, 0x200003C5, 0x200003C9,
+            0x200003B9, 0x200003B1, 0x200003B2, 0x200003B3, 0x200003B4, 0x200003B5, 0x200003B6, 0x200003B7,
+            0x200003B8, 0x200003B9, 0x200003BA, 0x200003BB, 0x200003BC, 0x200003BD, 0x200003BE, 0x200003BF,
+            0x200003C0, 0x200003C1, 0xC0000000, 0x280003C3, 0x200003C4, 0x200003C5, 0x200003C6, 0x200003C7,
+            0x200003C8, 0x200003C9, 0x200003B9, 0x200003C5, 0x200003B1, 0x200003B5, 0x200003B7, 0x200003B9,
+            0x200003C5, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x200003B9, 0x200003C5, 0x200003BF, 0x200003C5, 0x200003C9, 0x200003D7,
+            0x200003B2, 0x200003B8, 0x200003C5, 0x200003C5, 0x200003C5, 0x200003C6, 0x200003C0, 0x60000000,
+            0x200003D9, 0x60000000, 0x200003DB, 0x60000000, 0x200003DD, 0x60000000, 0x200003DF, 0x60000000,
+            0x200003E1, 0x60000000, 0x200003E3, 0x60000000, 0x200003E5, 0x60000000, 0x200003E7, 0x60000000,
+            0x200003E9, 0x60000000, 0x200003EB, 0x60000000, 0x200003ED, 0x60000000, 0x200003EF, 0x60000000,
+            0x200003BA, 0x200003C1, 0x200003C2, 0x60000000, 0x200003B8, 0x200003B5, 0xC0000000, 0x200003F8,
+            0x60000000, 0x280003C3, 0x200003FB, 0x60000000, 0x60000000, 0x2000037B, 0x2000037C, 0x2000037D,
+        },
+        {
+            0x20000435, 0x20000435, 0x20000452, 0x20000433, 0x20000454, 0x20000455, 0x20000456, 0x20000456,
+            0x20000458, 0x20000459, 0x2000045A, 0x2000045B, 0x2000043A, 0x20000438, 0x20000443, 0x2000045F,
+            0x20000430, 0x20000431, 0x20000432, 0x20000433, 0x20000434, 0x20000435, 0x20000436, 0x20000437,
+            0x20000438, 0x20000438, 0x2000043A, 0x2000043B, 0x2000043C, 0x2000043D, 0x2000043E, 0x2000043F,
+            0x20000440, 0x20000441, 0x20000442, 0x20000443, 0x20000444, 0x20000445, 0x20000446, 0x20000447,
+            0x20000448, 0x20000449, 0x2000044A, 0x2000044B, 0x2000044C, 0x2000044D, 0x2000044E, 0x2000044F,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x20000438, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x20000435, 0x20000435, 0x60000000, 0x20000433, 0x60000000, 0x60000000, 0x60000000, 0x20000456,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x2000043A, 0x20000438, 0x20000443, 0x60000000,
+            0x20000461, 0x60000000, 0x20000463, 0x60000000, 0x20000465, 0x60000000, 0x20000467, 0x60000000,
+            0x20000469, 0x60000000, 0x2000046B, 0x60000000, 0x2000046D, 0x60000000, 0x2000046F, 0x60000000,
+            0x20000471, 0x60000000, 0x20000473, 0x60000000, 0x20000475, 0x60000000, 0x20000475, 0x20000475,
+            0x20000479, 0x60000000, 0x2000047B, 0x60000000, 0x2000047D, 0x60000000, 0x2000047F, 0x60000000,
+            0x20000481, 0x60000000, 0xC0000000, 0x800000AE, 0x800000AF, 0x800000B0, 0x800000B1, 0x800000B2,
+            0xC0000000, 0xC0000000, 0x2000048B, 0x60000000, 0x2000048D, 0x60000000, 0x2000048F, 0x60000000,
+            0x20000491, 0x60000000, 0x20000493, 0x60000000, 0x20000495, 0x60000000, 0x20000497, 0x60000000,
+            0x20000499, 0x60000000, 0x2000049B, 0x60000000, 0x2000049D, 0x60000000, 0x2000049F, 0x60000000,
+            0x200004A1, 0x60000000, 0x200004A3, 0x60000000, 0x200004A5, 0x60000000, 0x200004A7, 0x60000000,
+            0x200004A9, 0x60000000, 0x200004AB, 0x60000000, 0x200004AD, 0x60000000, 0x200004AF, 0x60000000,
+            0x200004B1, 0x60000000, 0x200004B3, 0x60000000, 0x200004B5, 0x60000000, 0x200004B7, 0x60000000,
+            0x200004B9, 0x60000000, 0x200004BB, 0x60000000, 0x200004BD, 0x60000000, 0x200004BF, 0x60000000,
+            0x200004CF, 0x20000436, 0x20000436, 0x200004C4, 0x60000000, 0x200004C6, 0x60000000, 0x200004C8,
+            0x60000000, 0x200004CA, 0x60000000, 0x200004CC, 0x60000000, 0x200004CE, 0x60000000, 0x60000000,
+            0x20000430, 0x20000430, 0x20000430, 0x20000430, 0x200004D5, 0x60000000, 0x20000435, 0x20000435,
+            0x200004D9, 0x60000000, 0x200004D9, 0x200004D9, 0x20000436, 0x20000436, 0x20000437, 0x20000437,
+            0x200004E1, 0x60000000, 0x20000438, 0x20000438, 0x20000438, 0x20000438, 0x2000043E, 0x2000043E,
+            0x200004E9, 0x60000000, 0x200004E9, 0x200004E9, 0x2000044D, 0x2000044D, 0x20000443, 0x20000443,
+            0x20000443, 0x20000443, 0x20000443, 0x20000443, 0x20000447, 0x20000447, 0x200004F7, 0x60000000,
+            0x2000044B, 0x2000044B, 0x200004FB, 0x60000000, 0x200004FD, 0x60000000, 0x200004FF, 0x60000000,
+        },
+        {
+            0x20000501, 0x60000000, 0x20000503, 0x60000000, 0x20000505, 0x60000000, 0x20000507, 0x60000000,
+            0x20000509, 0x60000000, 0x2000050B, 0x60000000, 0x2000050D, 0x60000000, 0x2000050F, 0x60000000,
+            0x20000511, 0x60000000, 0x20000513, 0x60000000, 0x20000515, 0x60000000, 0x20000517, 0x60000000,
+            0x20000519, 0x60000000, 0x2000051B, 0x60000000, 0x2000051D, 0x60000000, 0x2000051F, 0x60000000,
+            0x20000521, 0x60000000, 0x20000523, 0x60000000, 0x20000525, 0x60000000, 0x20000527, 0x60000000,
+            0x20000529, 0x60000000, 0x2000052B, 0x60000000, 0x2000052D, 0x60000000, 0x2000052F, 0x60000000,
+            0xC0000000, 0x20000561, 0x20000562, 0x20000563, 0x20000564, 0x20000565, 0x20000566, 0x20000567,
+            0x20000568, 0x20000569, 0x2000056A, 0x2000056B, 0x2000056C, 0x2000056D, 0x2000056E, 0x2000056F,
+            0x20000570, 0x20000571, 0x20000572, 0x20000573, 0x20000574, 0x20000575, 0x20000576, 0x20000577,
+            0x20000578, 0x20000579, 0x2000057A, 0x2000057B, 0x2000057C, 0x2000057D, 0x2000057E, 0x2000057F,
+            0x20000580, 0x20000581, 0x20000582, 0x20000583, 0x20000584, 0x20000585, 0x20000586, 0xC0000000,
+            0xC0000000, 0x50000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0xA00000B3,
+            0x60000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0x800000B6, 0x800000B7, 0x800000B8, 0x800000B9, 0x800000BA, 0x800000BB, 0x800000BC,
+            0x800000BD, 0x800000BE, 0x800000BF, 0x800000C0, 0x800000C1, 0x800000C2, 0x800000C3, 0x800000C4,
+            0x800000C5, 0x800000C6, 0x800000C7, 0x800000C8, 0x800000C9, 0x800000CA, 0x800000CB, 0x800000CC,
+            0x800000CD, 0x800000CE, 0x800000CF, 0x800000D0, 0x800000D1, 0x800000D2, 0x800000D3, 0x800000D4,
+            0x800000D5, 0x800000D6, 0x800000D7, 0x800000D8, 0x800000D9, 0x800000DA, 0x800000DB, 0x800000DC,
+            0x800000DD, 0x800000DE, 0x800000DF, 0x800000E0, 0x800000E1, 0x800000E2, 0xC0000000, 0x800000E3,
+            0xC0000000, 0x800000E4, 0x800000E5, 0xC0000000, 0x800000E6, 0x800000E7, 0xC0000000, 0x800000E8,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x800000E9, 0x800000EA, 0x800000EB, 0x800000EC, 0x800000ED, 0x800000EE, 0x800000EF, 0x800000F0,
+            0x800000F1, 0x800000F2, 0x800000F3, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x627, 0x627, 0x648, 0x627, 0x64A, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x50000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x800000F4, 0x800000F5, 0x800000F6, 0x800000F7, 0x800000F8,
+            0x800000F9, 0x800000FA, 0x800000FB, 0x800000FC, 0x800000FD, 0x800000FE, 0x800000FF, 0x80000100,
+            0x80000101, 0x80000102, 0x80000103, 0x80000104, 0x80000105, 0x80000106, 0x80000107, 0x80000108,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000,
+            0x80000109, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x8000010A, 0x8000010D, 0x80000110,
+            0x80000113, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x6D5, 0x40000000, 0x6C1, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x6D2, 0xC0000000, 0x40000000, 0x80000116, 0x80000117,
+            0x80000118, 0x80000119, 0x8000011A, 0x8000011B, 0x8000011C, 0xC0000000, 0xC0000000, 0x8000011D,
+            0x8000011E, 0x8000011F, 0x80000120, 0x80000121, 0x80000122, 0x50000000, 0x50000000, 0x80000123,
+            0x80000124, 0xC0000000, 0x80000125, 0x80000126, 0x80000127, 0x80000128, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0x40000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x80000129, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x8000012A, 0x8000012B, 0x8000012C, 0x8000012D, 0x8000012E, 0x8000012F, 0x80000130, 0x80000131,
+            0x80000132, 0x80000133, 0x80000134, 0x80000135, 0x80000136, 0x80000137, 0x80000138, 0x80000139,
+            0x8000013A, 0x8000013B, 0x8000013C, 0x8000013D, 0x8000013E, 0x8000013F, 0x80000140, 0x80000141,
+            0x80000142, 0x80000143, 0x80000144, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x80000145, 0x80000146, 0x80000147, 0x80000148, 0x80000149,
+            0x8000014A, 0x8000014B, 0x8000014C, 0x8000014D, 0x50000000, 0x50000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x50000000, 0xC0000000, 0xC0000000, 0x8000014E, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x8000014F, 0x80000150,
+            0x80000151, 0x80000152, 0x50000000, 0x80000153, 0x80000154, 0x80000155, 0x80000156, 0x80000157,
+            0x80000158, 0x80000159, 0x8000015A, 0x8000015B, 0x50000000, 0x8000015C, 0x8000015D, 0x8000015E,
+            0x50000000, 0x8000015F, 0x80000160, 0x80000161, 0x80000162, 0x80000163, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x80000164, 0x80000165, 0x80000166, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x80000167, 0x80000168, 0x80000169, 0x8000016A, 0x8000016B, 0x8000016C, 0x8000016D, 0x8000016E,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x50000000, 0x8000016F, 0x80000170, 0x80000171, 0x80000172, 0x80000173, 0x80000174,
+            0x80000175, 0x80000176, 0x80000177, 0x80000178, 0x80000179, 0x8000017A, 0x8000017B, 0x8000017C,
+            0x8000017D, 0x8000017E, 0x8000017F, 0x80000180, 0x80000181, 0x80000182, 0x80000183, 0x80000184,
+            0x80000185, 0x80000186, 0xC0000000, 0x80000187, 0x80000188, 0x80000189, 0x8000018A, 0x8000018B,
+            0x8000018C, 0x8000018D, 0x8000018E, 0x8000018F, 0x80000190, 0x80000191, 0x80000192, 0x80000193,
+            0x80000194, 0x80000195, 0x80000196, 0x80000197, 0x80000198, 0x80000199, 0x8000019A, 0x8000019B,
+            0x8000019C, 0x8000019D, 0x8000019E, 0x8000019F, 0x800001A0, 0x800001A1, 0x800001A2, 0x800001A3,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x928, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x930, 0x40000000, 0x40000000, 0x933, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0x800001A4, 0x40000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x800001A5, 0xC0000000, 0xC0000000,
+            0x40000000, 0x800001A6, 0x800001A7, 0x800001A8, 0x800001A9, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x915, 0x916, 0x917, 0x91C, 0x921, 0x922, 0x92B, 0x92F,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0x50000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0x800001AA, 0x40000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x800001AB, 0x40000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x9A1, 0x9A2, 0xC0000000, 0x9AF,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0x40000000, 0xC0000000, 0x800001AC, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0x40000000, 0xA32, 0xC0000000, 0x40000000, 0xA38, 0xC0000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0x800001AD, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x800001AE, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xA16, 0xA17, 0xA1C, 0x40000000, 0xC0000000, 0xA2B, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0x800001AF, 0x40000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x800001B0, 0xC0000000, 0xC0000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0x800001B1, 0x40000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x800001B2, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xB21, 0xB22, 0xC0000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x800001B3, 0x40000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x800001B6, 0xC0000000, 0xC0000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0x800001B7, 0x40000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x800001B8, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x800001B9, 0x800001BA, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0x800001BB, 0x40000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x800001BC, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0xC0000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x800001BD, 0x800001BE, 0x40000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x800001BF, 0x40000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x800001C0, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0x40000000, 0x800001C1, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x800001C4, 0x800001C5, 0x800001C6, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x50000000, 0xC0000000,
+            0x800001C7, 0x800001C8, 0x800001C9, 0x800001CA, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0xC0000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0x40000000, 0x800001CB, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x800001CE, 0x800001CF, 0x800001D0, 0xC0000000, 0xC0000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x50000000, 0xC0000000,
+            0x800001D1, 0x800001D2, 0x800001D3, 0x800001D4, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0x800001D5, 0x800001D8, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x800001DB, 0x800001DC, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x800001DD, 0xC0000000, 0x800001DE,
+            0xC0000000, 0x800001DF, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x800001E0, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x800001E3, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x800001E6, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x800001E9,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x800001EC, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x800001EF, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0x800001F2, 0x800001F3, 0x800001F4, 0x800001F5, 0x800001F6, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x800001F7, 0x800001F8, 0x800001F9, 0x800001FA, 0xC0000000, 0xC0000000,
+            0x800001FB, 0x800001FC, 0x800001FD, 0x800001FE, 0x800001FF, 0xC0000000, 0x80000200, 0x80000201,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x80000202, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x80000203, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x80000206,
+            0xC0000000, 0x80000207, 0x80000208, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x80000209, 0x40000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x20002D00, 0x20002D01, 0x20002D02, 0x20002D03, 0x20002D04, 0x20002D05, 0x20002D06, 0x20002D07,
+            0x20002D08, 0x20002D09, 0x20002D0A, 0x20002D0B, 0x20002D0C, 0x20002D0D, 0x20002D0E, 0x20002D0F,
+            0x20002D10, 0x20002D11, 0x20002D12, 0x20002D13, 0x20002D14, 0x20002D15, 0x20002D16, 0x20002D17,
+            0x20002D18, 0x20002D19, 0x20002D1A, 0x20002D1B, 0x20002D1C, 0x20002D1D, 0x20002D1E, 0x20002D1F,
+            0x20002D20, 0x20002D21, 0x20002D22, 0x20002D23, 0x20002D24, 0x20002D25, 0xC0000000, 0x20002D27,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x20002D2D, 0xC0000000, 0xC0000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0xC0000000, 0x200010DC, 0x60000000, 0x60000000, 0x60000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0x8000020A, 0x8000020B, 0x8000020C,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x2000AB70, 0x2000AB71, 0x2000AB72, 0x2000AB73, 0x2000AB74, 0x2000AB75, 0x2000AB76, 0x2000AB77,
+            0x2000AB78, 0x2000AB79, 0x2000AB7A, 0x2000AB7B, 0x2000AB7C, 0x2000AB7D, 0x2000AB7E, 0x2000AB7F,
+            0x2000AB80, 0x2000AB81, 0x2000AB82, 0x2000AB83, 0x2000AB84, 0x2000AB85, 0x2000AB86, 0x2000AB87,
+            0x2000AB88, 0x2000AB89, 0x2000AB8A, 0x2000AB8B, 0x2000AB8C, 0x2000AB8D, 0x2000AB8E, 0x2000AB8F,
+            0x2000AB90, 0x2000AB91, 0x2000AB92, 0x2000AB93, 0x2000AB94, 0x2000AB95, 0x2000AB96, 0x2000AB97,
+            0x2000AB98, 0x2000AB99, 0x2000AB9A, 0x2000AB9B, 0x2000AB9C, 0x2000AB9D, 0x2000AB9E, 0x2000AB9F,
+            0x2000ABA0, 0x2000ABA1, 0x2000ABA2, 0x2000ABA3, 0x2000ABA4, 0x2000ABA5, 0x2000ABA6, 0x2000ABA7,
+            0x2000ABA8, 0x2000ABA9, 0x2000ABAA, 0x2000ABAB, 0x2000ABAC, 0x2000ABAD, 0x2000ABAE, 0x2000ABAF,
+            0x2000ABB0, 0x2000ABB1, 0x2000ABB2, 0x2000ABB3, 0x2000ABB4, 0x2000ABB5, 0x2000ABB6, 0x2000ABB7,
+            0x2000ABB8, 0x2000ABB9, 0x2000ABBA, 0x2000ABBB, 0x2000ABBC, 0x2000ABBD, 0x2000ABBE, 0x2000ABBF,
+            0x200013F8, 0x200013F9, 0x200013FA, 0x200013FB, 0x200013FC, 0x200013FD, 0xC0000000, 0xC0000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0x8000020D, 0x8000020E, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0x8000020F, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x80000210, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x50000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x80000211, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x50000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x80000212, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0x80000213, 0x80000214, 0x80000215, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x80000216,
+            0x80000217, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x80000218, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x80000219, 0x8000021A, 0x8000021B,
+            0x8000021C, 0x8000021D, 0x8000021E, 0x8000021F, 0x80000220, 0xC0000000, 0xC0000000, 0x80000221,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x50000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x80000222, 0x80000223, 0x80000224, 0x80000225, 0x80000226, 0x80000227, 0x80000228, 0x80000229,
+            0x8000022A, 0x8000022B, 0x8000022C, 0x8000022D, 0x8000022E, 0x8000022F, 0xC0000000, 0x80000230,
+            0x80000231, 0x80000232, 0x80000233, 0x80000234, 0x80000235, 0x80000236, 0x80000237, 0x80000238,
+            0x80000239, 0x8000023A, 0x8000023B, 0x8000023C, 0x8000023D, 0x8000023E, 0x8000023F, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x80000240, 0x40000000,
+            0x80000243, 0x40000000, 0x80000246, 0x40000000, 0x80000249, 0x40000000, 0x8000024C, 0x40000000,
+            0x40000000, 0x40000000, 0x8000024F, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x80000252, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x80000253, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0x80000254, 0x80000255, 0x80000256, 0x80000257, 0x80000258,
+            0x80000259, 0x8000025A, 0x8000025B, 0x8000025C, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x8000025D, 0x8000025E, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x8000025F, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x80000260, 0x80000261, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x80000262,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x50000000, 0x50000000, 0x50000000, 0x50000000, 0x50000000, 0x50000000, 0xC0000000, 0xC0000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x200010D0, 0x200010D1, 0x200010D2, 0x200010D3, 0x200010D4, 0x200010D5, 0x200010D6, 0x200010D7,
+            0x200010D8, 0x200010D9, 0x200010DA, 0x200010DB, 0x200010DC, 0x200010DD, 0x200010DE, 0x200010DF,
+            0x200010E0, 0x200010E1, 0x200010E2, 0x200010E3, 0x200010E4, 0x200010E5, 0x200010E6, 0x200010E7,
+            0x200010E8, 0x200010E9, 0x200010EA, 0x200010EB, 0x200010EC, 0x200010ED, 0x200010EE, 0x200010EF,
+            0x200010F0, 0x200010F1, 0x200010F2, 0x200010F3, 0x200010F4, 0x200010F5, 0x200010F6, 0x200010F7,
+            0x200010F8, 0x200010F9, 0x200010FA, 0xC0000000, 0xC0000000, 0x200010FD, 0x200010FE, 0x200010FF,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x80000263, 0x80000264, 0x80000265, 0xC0000000, 0x80000266, 0x80000267, 0x80000268, 0x80000269,
+            0x8000026A, 0x8000026B, 0x8000026C, 0x8000026D, 0x8000026E, 0x8000026F, 0x80000270, 0x80000271,
+            0x80000272, 0xC0000000, 0x80000273, 0x80000274, 0x80000275, 0x80000276, 0x80000277, 0x80000278,
+            0x80000279, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x8000027A, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x8000027B, 0x40000000, 0x40000000, 0xC0000000,
+            0x8000027C, 0x8000027D, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x20000061, 0x200000E6, 0x20000062, 0x50000000,
+            0x20000064, 0x20000065, 0x200001DD, 0x20000067, 0x20000068, 0x20000069, 0x2000006A, 0x2000006B,
+            0x2000006C, 0x2000006D, 0x2000006E, 0x50000000, 0x2000006F, 0x20000223, 0x20000070, 0x20000072,
+            0x20000074, 0x20000075, 0x20000077, 0x20000061, 0x20000250, 0x20000251, 0x20001D02, 0x20000062,
+            0x20000064, 0x20000065, 0x20000259, 0x2000025B, 0x2000025C, 0x20000067, 0x50000000, 0x2000006B,
+            0x2000006D, 0x2000014B, 0x2000006F, 0x20000254, 0x20001D16, 0x20001D17, 0x20000070, 0x20000074,
+            0x20000075, 0x20001D1D, 0x2000026F, 0x20000076, 0x20001D25, 0x200003B2, 0x200003B3, 0x200003B4,
+            0x200003C6, 0x200003C7, 0x20000069, 0x20000072, 0x20000075, 0x20000076, 0x200003B2, 0x200003B3,
+            0x200003C1, 0x200003C6, 0x200003C7, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x2000043D, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x20000252, 0x20000063, 0x20000255, 0x200000F0, 0x2000025C,
+            0x20000066, 0x2000025F, 0x20000261, 0x20000265, 0x20000268, 0x20000269, 0x2000026A, 0x20001D7B,
+            0x2000029D, 0x2000026D, 0x20001D85, 0x2000029F, 0x20000271, 0x20000270, 0x20000272, 0x20000273,
+            0x20000274, 0x20000275, 0x20000278, 0x20000282, 0x20000283, 0x200001AB, 0x20000289, 0x2000028A,
+            0x20001D1C, 0x2000028B, 0x2000028C, 0x2000007A, 0x20000290, 0x20000291, 0x20000292, 0x200003B8,
+            0x8000027E, 0x8000027F, 0x80000280, 0x80000281, 0x80000282, 0x80000283, 0x80000284, 0x80000285,
+            0x80000286, 0x80000287, 0x80000288, 0x80000289, 0x8000028A, 0x8000028B, 0x8000028C, 0x8000028D,
+            0x8000028E, 0x8000028F, 0x80000290, 0x80000291, 0x80000292, 0x80000293, 0x80000294, 0x80000295,
+            0x80000296, 0x80000297, 0x80000298, 0x80000299, 0x8000029A, 0x8000029B, 0x8000029C, 0x8000029D,
+            0x8000029E, 0x8000029F, 0x800002A0, 0x800002A1, 0x800002A2, 0x800002A3, 0x800002A4, 0x800002A5,
+            0x800002A6, 0x800002A7, 0x800002A8, 0x800002A9, 0x800002AA, 0x800002AB, 0x800002AC, 0x800002AD,
+            0x800002AE, 0x800002AF, 0x800002B0, 0x800002B1, 0x800002B2, 0x800002B3, 0x800002B4, 0x800002B5,
+            0x800002B6, 0x800002B7, 0x800002B8, 0x800002B9, 0x800002BA, 0x800002BB, 0x800002BC, 0x800002BD,
+        },
+        {
+            0x20000061, 0x20000061, 0x20000062, 0x20000062, 0x20000062, 0x20000062, 0x20000062, 0x20000062,
+            0x20000063, 0x20000063, 0x20000064, 0x20000064, 0x20000064, 0x20000064, 0x20000064, 0x20000064,
+            0x20000064, 0x20000064, 0x20000064, 0x20000064, 0x20000065, 0x20000065, 0x20000065, 0x20000065,
+            0x20000065, 0x20000065, 0x20000065, 0x20000065, 0x20000065, 0x20000065, 0x20000066, 0x20000066,
+            0x20000067, 0x20000067, 0x20000068, 0x20000068, 0x20000068, 0x20000068, 0x20000068, 0x20000068,
+            0x20000068, 0x20000068, 0x20000068, 0x20000068, 0x20000069, 0x20000069, 0x20000069, 0x20000069,
+            0x2000006B, 0x2000006B, 0x2000006B, 0x2000006B, 0x2000006B, 0x2000006B, 0x2000006C, 0x2000006C,
+            0x2000006C, 0x2000006C, 0x2000006C, 0x2000006C, 0x2000006C, 0x2000006C, 0x2000006D, 0x2000006D,
+            0x2000006D, 0x2000006D, 0x2000006D, 0x2000006D, 0x2000006E, 0x2000006E, 0x2000006E, 0x2000006E,
+            0x2000006E, 0x2000006E, 0x2000006E, 0x2000006E, 0x2000006F, 0x2000006F, 0x2000006F, 0x2000006F,
+            0x2000006F, 0x2000006F, 0x2000006F, 0x2000006F, 0x20000070, 0x20000070, 0x20000070, 0x20000070,
+            0x20000072, 0x20000072, 0x20000072, 0x20000072, 0x20000072, 0x20000072, 0x20000072, 0x20000072,
+            0x20000073, 0x20000073, 0x20000073, 0x20000073, 0x20000073, 0x20000073, 0x20000073, 0x20000073,
+            0x20000073, 0x20000073, 0x20000074, 0x20000074, 0x20000074, 0x20000074, 0x20000074, 0x20000074,
+            0x20000074, 0x20000074, 0x20000075, 0x20000075, 0x20000075, 0x20000075, 0x20000075, 0x20000075,
+            0x20000075, 0x20000075, 0x20000075, 0x20000075, 0x20000076, 0x20000076, 0x20000076, 0x20000076,
+            0x20000077, 0x20000077, 0x20000077, 0x20000077, 0x20000077, 0x20000077, 0x20000077, 0x20000077,
+            0x20000077, 0x20000077, 0x20000078, 0x20000078, 0x20000078, 0x20000078, 0x20000079, 0x20000079,
+            0x2000007A, 0x2000007A, 0x2000007A, 0x2000007A, 0x2000007A, 0x2000007A, 0x20000068, 0x20000074,
+            0x20000077, 0x20000079, 0xA00002BE, 0x20000073, 0x60000000, 0x60000000, 0x200000DF, 0x60000000,
+            0x20000061, 0x20000061, 0x20000061, 0x20000061, 0x20000061, 0x20000061, 0x20000061, 0x20000061,
+            0x20000061, 0x20000061, 0x20000061, 0x20000061, 0x20000061, 0x20000061, 0x20000061, 0x20000061,
+            0x20000061, 0x20000061, 0x20000061, 0x20000061, 0x20000061, 0x20000061, 0x20000061, 0x20000061,
+            0x20000065, 0x20000065, 0x20000065, 0x20000065, 0x20000065, 0x20000065, 0x20000065, 0x20000065,
+            0x20000065, 0x20000065, 0x20000065, 0x20000065, 0x20000065, 0x20000065, 0x20000065, 0x20000065,
+            0x20000069, 0x20000069, 0x20000069, 0x20000069, 0x2000006F, 0x2000006F, 0x2000006F, 0x2000006F,
+            0x2000006F, 0x2000006F, 0x2000006F, 0x2000006F, 0x2000006F, 0x2000006F, 0x2000006F, 0x2000006F,
+            0x2000006F, 0x2000006F, 0x2000006F, 0x2000006F, 0x2000006F, 0x2000006F, 0x2000006F, 0x2000006F,
+            0x2000006F, 0x2000006F, 0x2000006F, 0x2000006F, 0x20000075, 0x20000075, 0x20000075, 0x20000075,
+            0x20000075, 0x20000075, 0x20000075, 0x20000075, 0x20000075, 0x20000075, 0x20000075, 0x20000075,
+            0x20000075, 0x20000075, 0x20000079, 0x20000079, 0x20000079, 0x20000079, 0x20000079, 0x20000079,
+            0x20000079, 0x20000079, 0x20001EFB, 0x60000000, 0x20001EFD, 0x60000000, 0x20001EFF, 0x60000000,
+        },
+        {
+            0x200003B1, 0x200003B1, 0x200003B1, 0x200003B1, 0x200003B1, 0x200003B1, 0x200003B1, 0x200003B1,
+            0x200003B1, 0x200003B1, 0x200003B1, 0x200003B1, 0x200003B1, 0x200003B1, 0x200003B1, 0x200003B1,
+            0x200003B5, 0x200003B5, 0x200003B5, 0x200003B5, 0x200003B5, 0x200003B5, 0xC0000000, 0xC0000000,
+            0x200003B5, 0x200003B5, 0x200003B5, 0x200003B5, 0x200003B5, 0x200003B5, 0xC0000000, 0xC0000000,
+            0x200003B7, 0x200003B7, 0x200003B7, 0x200003B7, 0x200003B7, 0x200003B7, 0x200003B7, 0x200003B7,
+            0x200003B7, 0x200003B7, 0x200003B7, 0x200003B7, 0x200003B7, 0x200003B7, 0x200003B7, 0x200003B7,
+            0x200003B9, 0x200003B9, 0x200003B9, 0x200003B9, 0x200003B9, 0x200003B9, 0x200003B9, 0x200003B9,
+            0x200003B9, 0x200003B9, 0x200003B9, 0x200003B9, 0x200003B9, 0x200003B9, 0x200003B9, 0x200003B9,
+            0x200003BF, 0x200003BF, 0x200003BF, 0x200003BF, 0x200003BF, 0x200003BF, 0xC0000000, 0xC0000000,
+            0x200003BF, 0x200003BF, 0x200003BF, 0x200003BF, 0x200003BF, 0x200003BF, 0xC0000000, 0xC0000000,
+            0x200003C5, 0x200003C5, 0x200003C5, 0x200003C5, 0x200003C5, 0x200003C5, 0x200003C5, 0x200003C5,
+            0xC0000000, 0x200003C5, 0xC0000000, 0x200003C5, 0xC0000000, 0x200003C5, 0xC0000000, 0x200003C5,
+            0x200003C9, 0x200003C9, 0x200003C9, 0x200003C9, 0x200003C9, 0x200003C9, 0x200003C9, 0x200003C9,
+            0x200003C9, 0x200003C9, 0x200003C9, 0x200003C9, 0x200003C9, 0x200003C9, 0x200003C9, 0x200003C9,
+            0x200003B1, 0x200003B1, 0x200003B5, 0x200003B5, 0x200003B7, 0x200003B7, 0x200003B9, 0x200003B9,
+            0x200003BF, 0x200003BF, 0x200003C5, 0x200003C5, 0x200003C9, 0x200003C9, 0xC0000000, 0xC0000000,
+            0x200003B1, 0x200003B1, 0x200003B1, 0x200003B1, 0x200003B1, 0x200003B1, 0x200003B1, 0x200003B1,
+            0x200003B1, 0x200003B1, 0x200003B1, 0x200003B1, 0x200003B1, 0x200003B1, 0x200003B1, 0x200003B1,
+            0x200003B7, 0x200003B7, 0x200003B7, 0x200003B7, 0x200003B7, 0x200003B7, 0x200003B7, 0x200003B7,
+            0x200003B7, 0x200003B7, 0x200003B7, 0x200003B7, 0x200003B7, 0x200003B7, 0x200003B7, 0x200003B7,
+            0x200003C9, 0x200003C9, 0x200003C9, 0x200003C9, 0x200003C9, 0x200003C9, 0x200003C9, 0x200003C9,
+            0x200003C9, 0x200003C9, 0x200003C9, 0x200003C9, 0x200003C9, 0x200003C9, 0x200003C9, 0x200003C9,
+            0x200003B1, 0x200003B1, 0x200003B1, 0x200003B1, 0x200003B1, 0xC0000000, 0x200003B1, 0x200003B1,
+            0x200003B1, 0x200003B1, 0x200003B1, 0x200003B1, 0x200003B1, 0xC0000000, 0x200003B9, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x200003B7, 0x200003B7, 0x200003B7, 0xC0000000, 0x200003B7, 0x200003B7,
+            0x200003B5, 0x200003B5, 0x200003B7, 0x200003B7, 0x200003B7, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x200003B9, 0x200003B9, 0x200003B9, 0x200003B9, 0xC0000000, 0xC0000000, 0x200003B9, 0x200003B9,
+            0x200003B9, 0x200003B9, 0x200003B9, 0x200003B9, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x200003C5, 0x200003C5, 0x200003C5, 0x200003C5, 0x200003C1, 0x200003C1, 0x200003C5, 0x200003C5,
+            0x200003C5, 0x200003C5, 0x200003C5, 0x200003C5, 0x200003C1, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x200003C9, 0x200003C9, 0x200003C9, 0xC0000000, 0x200003C9, 0x200003C9,
+            0x200003BF, 0x200003BF, 0x200003C9, 0x200003C9, 0x200003C9, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x30, 0x20000069, 0xC0000000, 0xC0000000, 0x34, 0x35, 0x36, 0x37,
+            0x38, 0x39, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x2000006E,
+            0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+            0x38, 0x39, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x20000061, 0x20000065, 0x2000006F, 0x20000078, 0x20000259, 0x20000068, 0x2000006B, 0x2000006C,
+            0x2000006D, 0x2000006E, 0x20000070, 0x20000073, 0x20000074, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xA00002C1, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x800002C4, 0x800002C5, 0x800002C6, 0x800002C7, 0x800002C8, 0x800002C9, 0x800002CA, 0x800002CB,
+            0x800002CC, 0x800002CD, 0x800002CE, 0x800002CF, 0x800002D0, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0x800002D1, 0xC0000000, 0xC0000000, 0xC0000000, 0x800002D2, 0x800002D3, 0x800002D4,
+            0x800002D5, 0x800002D6, 0x800002D7, 0x800002D8, 0x800002D9, 0x800002DA, 0x800002DB, 0x800002DC,
+            0x800002DD, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xA00002DE, 0xA00002E2, 0x20000063, 0xA00002E6, 0xC0000000, 0xA00002E9, 0xA00002ED, 0x2000025B,
+            0xC0000000, 0xA00002F1, 0x20000067, 0x20000068, 0x20000068, 0x20000068, 0x20000068, 0x20000127,
+            0x20000069, 0x20000069, 0x2000006C, 0x2000006C, 0xC0000000, 0x2000006E, 0xA00002F4, 0xC0000000,
+            0xC0000000, 0x20000070, 0x20000071, 0x20000072, 0x20000072, 0x20000072, 0xC0000000, 0xC0000000,
+            0xA00002F7, 0xA00002FA, 0xA00002FE, 0xC0000000, 0x2000007A, 0xC0000000, 0x200003C9, 0xC0000000,
+            0x2000007A, 0xC0000000, 0x2000006B, 0x20000061, 0x20000062, 0x20000063, 0xC0000000, 0x20000065,
+            0x20000065, 0x20000066, 0x2000214E, 0x2000006D, 0x2000006F, 0x5D0, 0x5D1, 0x5D2,
+            0x5D3, 0x20000069, 0xC0000000, 0xA0000301, 0x200003C0, 0x200003B3, 0x200003B3, 0x200003C0,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x20000064, 0x20000064, 0x20000065,
+            0x20000069, 0x2000006A, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x60000000, 0xC0000000,
+            0x80000305, 0x80000309, 0x8000030D, 0x80000312, 0x80000316, 0x8000031A, 0x8000031E, 0x80000322,
+            0x80000326, 0x8000032A, 0x8000032E, 0x80000332, 0x80000336, 0x8000033A, 0x8000033E, 0x80000342,
+            0x20000069, 0xA0000345, 0xA0000348, 0xA000034C, 0x20000076, 0xA000034F, 0xA0000352, 0xA0000356,
+            0xA000035B, 0x20000078, 0xA000035E, 0xA0000361, 0x2000006C, 0x20000063, 0x20000064, 0x2000006D,
+            0x20000069, 0xA0000365, 0xA0000368, 0xA000036C, 0x20000076, 0xA000036F, 0xA0000372, 0xA0000376,
+            0xA000037B, 0x20000078, 0xA000037E, 0xA0000381, 0x2000006C, 0x20000063, 0x20000064, 0x2000006D,
+            0x40000000, 0x40000000, 0x40000000, 0x20002184, 0x60000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x80000385, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+            0x39, 0x80000389, 0x8000038C, 0x8000038F, 0x80000392, 0x80000395, 0x80000398, 0x8000039B,
+            0x8000039E, 0x800003A1, 0x800003A4, 0x800003A7, 0x800003AA, 0x800003AE, 0x800003B2, 0x800003B6,
+            0x800003BA, 0x800003BE, 0x800003C2, 0x800003C6, 0x800003CA, 0x800003CE, 0x800003D3, 0x800003D8,
+            0x800003DD, 0x800003E2, 0x800003E7, 0x800003EC, 0x800003F1, 0x800003F6, 0x800003FB, 0x80000400,
+            0x80000405, 0x80000408, 0x8000040B, 0x8000040E, 0x80000411, 0x80000414, 0x80000417, 0x8000041A,
+            0x8000041D, 0x80000420, 0x80000424, 0x80000428, 0x8000042C, 0x80000430, 0x80000434, 0x80000438,
+            0x8000043C, 0x80000440, 0x80000444, 0x80000448, 0xA000044C, 0xA0000450, 0xA0000454, 0xA0000458,
+            0xA000045C, 0xA0000460, 0xA0000464, 0xA0000468, 0xA000046C, 0xA0000470, 0xA0000474, 0xA0000478,
+            0xA000047C, 0xA0000480, 0xA0000484, 0xA0000488, 0xA000048C, 0xA0000490, 0xA0000494, 0xA0000498,
+            0xA000049C, 0xA00004A0, 0xA00004A4, 0xA00004A8, 0xA00004AC, 0xA00004B0, 0x20000061, 0x20000062,
+            0x20000063, 0x20000064, 0x20000065, 0x20000066, 0x20000067, 0x20000068, 0x20000069, 0x2000006A,
+            0x2000006B, 0x2000006C, 0x2000006D, 0x2000006E, 0x2000006F, 0x20000070, 0x20000071, 0x20000072,
+            0x20000073, 0x20000074, 0x20000075, 0x20000076, 0x20000077, 0x20000078, 0x20000079, 0x2000007A,
+            0x20000061, 0x20000062, 0x20000063, 0x20000064, 0x20000065, 0x20000066, 0x20000067, 0x20000068,
+            0x20000069, 0x2000006A, 0x2000006B, 0x2000006C, 0x2000006D, 0x2000006E, 0x2000006F, 0x20000070,
+            0x20000071, 0x20000072, 0x20000073, 0x20000074, 0x20000075, 0x20000076, 0x20000077, 0x20000078,
+            0x20000079, 0x2000007A, 0x30, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x20002C30, 0x20002C31, 0x20002C32, 0x20002C33, 0x20002C34, 0x20002C35, 0x20002C36, 0x20002C37,
+            0x20002C38, 0x20002C39, 0x20002C3A, 0x20002C3B, 0x20002C3C, 0x20002C3D, 0x20002C3E, 0x20002C3F,
+            0x20002C40, 0x20002C41, 0x20002C42, 0x20002C43, 0x20002C44, 0x20002C45, 0x20002C46, 0x20002C47,
+            0x20002C48, 0x20002C49, 0x20002C4A, 0x20002C4B, 0x20002C4C, 0x20002C4D, 0x20002C4E, 0x20002C4F,
+            0x20002C50, 0x20002C51, 0x20002C52, 0x20002C53, 0x20002C54, 0x20002C55, 0x20002C56, 0x20002C57,
+            0x20002C58, 0x20002C59, 0x20002C5A, 0x20002C5B, 0x20002C5C, 0x20002C5D, 0x20002C5E, 0x20002C5F,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x20002C61, 0x60000000, 0x2000026B, 0x20001D7D, 0x2000027D, 0x60000000, 0x60000000, 0x20002C68,
+            0x60000000, 0x20002C6A, 0x60000000, 0x20002C6C, 0x60000000, 0x20000251, 0x20000271, 0x20000250,
+            0x20000252, 0x60000000, 0x20002C73, 0x60000000, 0x60000000, 0x20002C76, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x2000006A, 0x20000076, 0x2000023F, 0x20000240,
+            0x20002C81, 0x60000000, 0x20002C83, 0x60000000, 0x20002C85, 0x60000000, 0x20002C87, 0x60000000,
+            0x20002C89, 0x60000000, 0x20002C8B, 0x60000000, 0x20002C8D, 0x60000000, 0x20002C8F, 0x60000000,
+            0x20002C91, 0x60000000, 0x20002C93, 0x60000000, 0x20002C95, 0x60000000, 0x20002C97, 0x60000000,
+            0x20002C99, 0x60000000, 0x20002C9B, 0x60000000, 0x20002C9D, 0x60000000, 0x20002C9F, 0x60000000,
+            0x20002CA1, 0x60000000, 0x20002CA3, 0x60000000, 0x20002CA5, 0x60000000, 0x20002CA7, 0x60000000,
+            0x20002CA9, 0x60000000, 0x20002CAB, 0x60000000, 0x20002CAD, 0x60000000, 0x20002CAF, 0x60000000,
+            0x20002CB1, 0x60000000, 0x20002CB3, 0x60000000, 0x20002CB5, 0x60000000, 0x20002CB7, 0x60000000,
+            0x20002CB9, 0x60000000, 0x20002CBB, 0x60000000, 0x20002CBD, 0x60000000, 0x20002CBF, 0x60000000,
+            0x20002CC1, 0x60000000, 0x20002CC3, 0x60000000, 0x20002CC5, 0x60000000, 0x20002CC7, 0x60000000,
+            0x20002CC9, 0x60000000, 0x20002CCB, 0x60000000, 0x20002CCD, 0x60000000, 0x20002CCF, 0x60000000,
+            0x20002CD1, 0x60000000, 0x20002CD3, 0x60000000, 0x20002CD5, 0x60000000, 0x20002CD7, 0x60000000,
+            0x20002CD9, 0x60000000, 0x20002CDB, 0x60000000, 0x20002CDD, 0x60000000, 0x20002CDF, 0x60000000,
+            0x20002CE1, 0x60000000, 0x20002CE3, 0x60000000, 0x60000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0x20002CEC, 0x60000000, 0x20002CEE, 0x60000000, 0x800004B4,
+            0x800004B5, 0x800004B6, 0x20002CF3, 0x60000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0xC0000000, 0x60000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x60000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x2D61,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x800004B7,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0x800004B8, 0x800004B9, 0x800004BA, 0x800004BB, 0x800004BC, 0x800004BD, 0x800004BE, 0x800004BF,
+            0x800004C0, 0x800004C1, 0x800004C2, 0x800004C3, 0x800004C4, 0x800004C5, 0x800004C6, 0x800004C7,
+            0x800004C8, 0x800004C9, 0x800004CA, 0x800004CB, 0x800004CC, 0x800004CD, 0x800004CE, 0x800004CF,
+            0x800004D0, 0x800004D1, 0x800004D2, 0x800004D3, 0x800004D4, 0x800004D5, 0x800004D6, 0x800004D7,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x50000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x6BCD,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0x9F9F, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x4E00, 0x4E28, 0x4E36, 0x4E3F, 0x4E59, 0x4E85, 0x4E8C, 0x4EA0,
+            0x4EBA, 0x513F, 0x5165, 0x516B, 0x5182, 0x5196, 0x51AB, 0x51E0,
+            0x51F5, 0x5200, 0x529B, 0x52F9, 0x5315, 0x531A, 0x5338, 0x5341,
+            0x535C, 0x5369, 0x5382, 0x53B6, 0x53C8, 0x53E3, 0x56D7, 0x571F,
+            0x58EB, 0x5902, 0x590A, 0x5915, 0x5927, 0x5973, 0x5B50, 0x5B80,
+            0x5BF8, 0x5C0F, 0x5C22, 0x5C38, 0x5C6E, 0x5C71, 0x5DDB, 0x5DE5,
+            0x5DF1, 0x5DFE, 0x5E72, 0x5E7A, 0x5E7F, 0x5EF4, 0x5EFE, 0x5F0B,
+            0x5F13, 0x5F50, 0x5F61, 0x5F73, 0x5FC3, 0x6208, 0x6236, 0x624B,
+            0x652F, 0x6534, 0x6587, 0x6597, 0x65A4, 0x65B9, 0x65E0, 0x65E5,
+            0x66F0, 0x6708, 0x6728, 0x6B20, 0x6B62, 0x6B79, 0x6BB3, 0x6BCB,
+            0x6BD4, 0x6BDB, 0x6C0F, 0x6C14, 0x6C34, 0x706B, 0x722A, 0x7236,
+            0x723B, 0x723F, 0x7247, 0x7259, 0x725B, 0x72AC, 0x7384, 0x7389,
+            0x74DC, 0x74E6, 0x7518, 0x751F, 0x7528, 0x7530, 0x758B, 0x7592,
+            0x7676, 0x767D, 0x76AE, 0x76BF, 0x76EE, 0x77DB, 0x77E2, 0x77F3,
+            0x793A, 0x79B8, 0x79BE, 0x7A74, 0x7ACB, 0x7AF9, 0x7C73, 0x7CF8,
+            0x7F36, 0x7F51, 0x7F8A, 0x7FBD, 0x8001, 0x800C, 0x8012, 0x8033,
+            0x807F, 0x8089, 0x81E3, 0x81EA, 0x81F3, 0x81FC, 0x820C, 0x821B,
+            0x821F, 0x826E, 0x8272, 0x8278, 0x864D, 0x866B, 0x8840, 0x884C,
+            0x8863, 0x897E, 0x898B, 0x89D2, 0x8A00, 0x8C37, 0x8C46, 0x8C55,
+            0x8C78, 0x8C9D, 0x8D64, 0x8D70, 0x8DB3, 0x8EAB, 0x8ECA, 0x8F9B,
+            0x8FB0, 0x8FB5, 0x9091, 0x9149, 0x91C6, 0x91CC, 0x91D1, 0x9577,
+            0x9580, 0x961C, 0x96B6, 0x96B9, 0x96E8, 0x9751, 0x975E, 0x9762,
+            0x9769, 0x97CB, 0x97ED, 0x97F3, 0x9801, 0x98A8, 0x98DB, 0x98DF,
+            0x9996, 0x9999, 0x99AC, 0x9AA8, 0x9AD8, 0x9ADF, 0x9B25, 0x9B2F,
+            0x9B32, 0x9B3C, 0x9B5A, 0x9CE5, 0x9E75, 0x9E7F, 0x9EA5, 0x9EBB,
+            0x9EC3, 0x9ECD, 0x9ED1, 0x9EF9, 0x9EFD, 0x9F0E, 0x9F13, 0x9F20,
+            0x9F3B, 0x9F4A, 0x9F52, 0x9F8D, 0x9F9C, 0x9FA0, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x50000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x800004D8, 0x800004D9, 0x800004DA, 0x800004DB, 0x800004DC, 0x800004DD,
+            0xC0000000, 0x50000000, 0x50000000, 0x50000000, 0x50000000, 0x50000000, 0xC0000000, 0xC0000000,
+            0x5341, 0x5344, 0x5345, 0x50000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x304B, 0x40000000, 0x304D, 0x40000000,
+            0x304F, 0x40000000, 0x3051, 0x40000000, 0x3053, 0x40000000, 0x3055, 0x40000000,
+            0x3057, 0x40000000, 0x3059, 0x40000000, 0x305B, 0x40000000, 0x305D, 0x40000000,
+            0x305F, 0x40000000, 0x3061, 0x40000000, 0x40000000, 0x3064, 0x40000000, 0x3066,
+            0x40000000, 0x3068, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x306F, 0x306F, 0x40000000, 0x3072, 0x3072, 0x40000000, 0x3075, 0x3075,
+            0x40000000, 0x3078, 0x3078, 0x40000000, 0x307B, 0x307B, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x3046, 0x40000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0x800004DE, 0x800004DF, 0xC0000000, 0xC0000000, 0x50000000, 0x1000309D, 0x800004E0,
+            0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x30AB, 0x40000000, 0x30AD, 0x40000000,
+            0x30AF, 0x40000000, 0x30B1, 0x40000000, 0x30B3, 0x40000000, 0x30B5, 0x40000000,
+            0x30B7, 0x40000000, 0x30B9, 0x40000000, 0x30BB, 0x40000000, 0x30BD, 0x40000000,
+            0x30BF, 0x40000000, 0x30C1, 0x40000000, 0x40000000, 0x30C4, 0x40000000, 0x30C6,
+            0x40000000, 0x30C8, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x30CF, 0x30CF, 0x40000000, 0x30D2, 0x30D2, 0x40000000, 0x30D5, 0x30D5,
+            0x40000000, 0x30D8, 0x30D8, 0x40000000, 0x30DB, 0x30DB, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x30A6, 0x40000000, 0x40000000, 0x30EF,
+            0x30F0, 0x30F1, 0x30F2, 0xC0000000, 0x50000000, 0x50000000, 0x100030FD, 0x800004E3,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0x1100, 0x1101, 0x11AA, 0x1102, 0x11AC, 0x11AD, 0x1103,
+            0x1104, 0x1105, 0x11B0, 0x11B1, 0x11B2, 0x11B3, 0x11B4, 0x11B5,
+            0x111A, 0x1106, 0x1107, 0x1108, 0x1121, 0x1109, 0x110A, 0x110B,
+            0x110C, 0x110D, 0x110E, 0x110F, 0x1110, 0x1111, 0x1112, 0x1161,
+            0x1162, 0x1163, 0x1164, 0x1165, 0x1166, 0x1167, 0x1168, 0x1169,
+            0x116A, 0x116B, 0x116C, 0x116D, 0x116E, 0x116F, 0x1170, 0x1171,
+            0x1172, 0x1173, 0x1174, 0x1175, 0x1160, 0x1114, 0x1115, 0x11C7,
+            0x11C8, 0x11CC, 0x11CE, 0x11D3, 0x11D7, 0x11D9, 0x111C, 0x11DD,
+            0x11DF, 0x111D, 0x111E, 0x1120, 0x1122, 0x1123, 0x1127, 0x1129,
+            0x112B, 0x112C, 0x112D, 0x112E, 0x112F, 0x1132, 0x1136, 0x1140,
+            0x1147, 0x114C, 0x11F1, 0x11F2, 0x1157, 0x1158, 0x1159, 0x1184,
+            0x1185, 0x1188, 0x1191, 0x1192, 0x1194, 0x119E, 0x11A1, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x4E00, 0x4E8C, 0x4E09, 0x56DB, 0x4E0A, 0x4E2D,
+            0x4E0B, 0x7532, 0x4E59, 0x4E19, 0x4E01, 0x5929, 0x5730, 0x4EBA,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+        },
+        {
+            0x800004E6, 0x800004EA, 0x800004EE, 0x800004F2, 0x800004F6, 0x800004FA, 0x800004FE, 0x80000502,
+            0x80000506, 0x8000050A, 0x8000050E, 0x80000512, 0x80000516, 0x8000051A, 0x8000051E, 0x80000523,
+            0x80000528, 0x8000052D, 0x80000532, 0x80000537, 0x8000053C, 0x80000541, 0x80000546, 0x8000054B,
+            0x80000550, 0x80000555, 0x8000055A, 0x8000055F, 0x80000564, 0x80000569, 0x80000571, 0xC0000000,
+            0x80000578, 0x8000057C, 0x80000580, 0x80000584, 0x80000588, 0x8000058C, 0x80000590, 0x80000594,
+            0x80000598, 0x8000059C, 0x800005A0, 0x800005A4, 0x800005A8, 0x800005AC, 0x800005B0, 0x800005B4,
+            0x800005B8, 0x800005BC, 0x800005C0, 0x800005C4, 0x800005C8, 0x800005CC, 0x800005D0, 0x800005D4,
+            0x800005D8, 0x800005DC, 0x800005E0, 0x800005E4, 0x800005E8, 0x800005EC, 0x800005F0, 0x800005F4,
+            0x800005F8, 0x800005FC, 0x80000600, 0x80000604, 0x554F, 0x5E7C, 0x6587, 0x7B8F,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xA0000608, 0x8000060C, 0x8000060F, 0x80000612, 0x80000615, 0x80000618, 0x8000061B, 0x8000061E,
+            0x80000621, 0x80000624, 0x80000627, 0x8000062A, 0x8000062D, 0x80000630, 0x80000633, 0x80000636,
+            0x1100, 0x1102, 0x1103, 0x1105, 0x1106, 0x1107, 0x1109, 0x110B,
+            0x110C, 0x110E, 0x110F, 0x1110, 0x1111, 0x1112, 0x80000639, 0x8000063C,
+            0x8000063F, 0x80000642, 0x80000645, 0x80000648, 0x8000064B, 0x8000064E, 0x80000651, 0x80000654,
+            0x80000657, 0x8000065A, 0x8000065D, 0x80000660, 0x80000663, 0x80000669, 0x8000066E, 0xC0000000,
+            0x4E00, 0x4E8C, 0x4E09, 0x56DB, 0x4E94, 0x516D, 0x4E03, 0x516B,
+            0x4E5D, 0x5341, 0x6708, 0x706B, 0x6C34, 0x6728, 0x91D1, 0x571F,
+            0x65E5, 0x682A, 0x6709, 0x793E, 0x540D, 0x7279, 0x8CA1, 0x795D,
+            0x52B4, 0x79D8, 0x7537, 0x5973, 0x9069, 0x512A, 0x5370, 0x6CE8,
+            0x9805, 0x4F11, 0x5199, 0x6B63, 0x4E0A, 0x4E2D, 0x4E0B, 0x5DE6,
+            0x53F3, 0x533B, 0x5B97, 0x5B66, 0x76E3, 0x4F01, 0x8CC7, 0x5354,
+            0x591C, 0x80000671, 0x80000674, 0x80000677, 0x8000067A, 0x8000067D, 0x80000680, 0x80000683,
+            0x80000686, 0x80000689, 0x8000068C, 0x8000068F, 0x80000692, 0x80000695, 0x80000698, 0x8000069B,
+            0x8000069E, 0x800006A1, 0x800006A4, 0x800006A7, 0x800006AA, 0x800006AD, 0x800006B0, 0x800006B3,
+            0x800006B6, 0x800006B9, 0x800006BD, 0x800006C1, 0xA00006C5, 0xA00006C8, 0xA00006CC, 0xA00006CF,
+            0x30A2, 0x30A4, 0x30A6, 0x30A8, 0x30AA, 0x30AB, 0x30AD, 0x30AF,
+            0x30B1, 0x30B3, 0x30B5, 0x30B7, 0x30B9, 0x30BB, 0x30BD, 0x30BF,
+            0x30C1, 0x30C4, 0x30C6, 0x30C8, 0x30CA, 0x30CB, 0x30CC, 0x30CD,
+            0x30CE, 0x30CF, 0x30D2, 0x30D5, 0x30D8, 0x30DB, 0x30DE, 0x30DF,
+            0x30E0, 0x30E1, 0x30E2, 0x30E4, 0x30E6, 0x30E8, 0x30E9, 0x30EA,
+            0x30EB, 0x30EC, 0x30ED, 0x30EF, 0x30F0, 0x30F1, 0x30F2, 0x800006D3,
+        },
+        {
+            0x800006D6, 0x800006DB, 0x800006E0, 0x800006E5, 0x800006E9, 0x800006EE, 0x800006F2, 0x800006F6,
+            0x800006FC, 0x80000701, 0x80000705, 0x80000709, 0x8000070D, 0x80000712, 0x80000717, 0x8000071B,
+            0x8000071F, 0x80000722, 0x80000726, 0x8000072B, 0x80000730, 0x80000733, 0x80000739, 0x80000740,
+            0x80000746, 0x8000074A, 0x80000750, 0x80000756, 0x8000075B, 0x8000075F, 0x80000763, 0x80000767,
+            0x8000076C, 0x80000772, 0x80000777, 0x8000077B, 0x8000077F, 0x80000783, 0x80000786, 0x80000789,
+            0x8000078C, 0x8000078F, 0x80000793, 0x80000797, 0x8000079D, 0x800007A1, 0x800007A6, 0x800007AC,
+            0x800007B0, 0x800007B3, 0x800007B6, 0x800007BC, 0x800007C1, 0x800007C7, 0x800007CB, 0x800007D1,
+            0x800007D4, 0x800007D8, 0x800007DC, 0x800007E0, 0x800007E4, 0x800007E8, 0x800007ED, 0x800007F1,
+            0x800007F4, 0x800007F8, 0x800007FC, 0x80000800, 0x80000805, 0x80000809, 0x8000080D, 0x80000811,
+            0x80000817, 0x8000081C, 0x8000081F, 0x80000825, 0x80000828, 0x8000082D, 0x80000832, 0x80000836,
+            0x8000083A, 0x8000083E, 0x80000843, 0x80000846, 0x8000084A, 0x8000084F, 0x80000852, 0x80000858,
+            0x8000085C, 0x8000085F, 0x80000862, 0x80000865, 0x80000868, 0x8000086B, 0x8000086E, 0x80000871,
+            0x80000874, 0x80000877, 0x8000087A, 0x8000087E, 0x80000882, 0x80000886, 0x8000088A, 0x8000088E,
+            0x80000892, 0x80000896, 0x8000089A, 0x8000089E, 0x800008A2, 0x800008A6, 0x800008AA, 0x800008AE,
+            0x800008B2, 0xA00008B6, 0xA00008BA, 0xA00008BD, 0xA00008C0, 0xA00008C4, 0xA00008C7, 0xA00008CA,
+            0xA00008CD, 0xA00008D1, 0xA00008D5, 0x800008D8, 0x800008DB, 0x800008DE, 0x800008E1, 0x800008E4,
+            0xA00008E9, 0xA00008EC, 0xA00008EF, 0xA00008F2, 0xA00008F5, 0xA00008F8, 0xA00008FB, 0xA00008FE,
+            0xA0000901, 0xA0000905, 0xA000090A, 0xA000090D, 0xA0000910, 0xA0000913, 0xA0000916, 0xA0000919,
+            0xA000091C, 0xA000091F, 0xA0000923, 0xA0000927, 0xA000092B, 0xA000092F, 0xA0000932, 0xA0000935,
+            0xA0000938, 0xA000093B, 0xA000093E, 0xA0000941, 0xA0000944, 0xA0000947, 0xA000094A, 0xA000094D,
+            0xA0000951, 0xA0000955, 0xA0000958, 0xA000095C, 0xA0000960, 0xA0000964, 0xA0000967, 0xA000096B,
+            0xA000096F, 0xA0000974, 0xA0000977, 0xA000097B, 0xA000097F, 0xA0000983, 0xA0000987, 0xA000098D,
+            0xA0000994, 0xA0000997, 0xA000099A, 0xA000099D, 0xA00009A0, 0xA00009A3, 0xA00009A6, 0xA00009A9,
+            0xA00009AC, 0xA00009AF, 0xA00009B2, 0xA00009B5, 0xA00009B8, 0xA00009BB, 0xA00009BE, 0xA00009C1,
+            0xA00009C4, 0xA00009C7, 0xA00009CA, 0xA00009CF, 0xA00009D2, 0xA00009D5, 0xA00009D8, 0xA00009DD,
+            0xA00009E1, 0xA00009E4, 0xA00009E7, 0xA00009EA, 0xA00009ED, 0xA00009F0, 0xA00009F3, 0xA00009F6,
+            0xA00009F9, 0xA00009FC, 0xA00009FF, 0xA0000A03, 0xA0000A06, 0xA0000A09, 0xA0000A0D, 0xA0000A11,
+            0xA0000A14, 0xA0000A19, 0xA0000A1D, 0xA0000A20, 0xA0000A23, 0xA0000A26, 0xA0000A29, 0xA0000A2D,
+            0x80000A31, 0x80000A34, 0x80000A37, 0x80000A3A, 0x80000A3D, 0x80000A40, 0x80000A43, 0x80000A46,
+            0x80000A49, 0x80000A4C, 0x80000A50, 0x80000A54, 0x80000A58, 0x80000A5C, 0x80000A60, 0x80000A64,
+            0x80000A68, 0x80000A6C, 0x80000A70, 0x80000A74, 0x80000A78, 0x80000A7C, 0x80000A80, 0x80000A84,
+            0x80000A88, 0x80000A8C, 0x80000A90, 0x80000A94, 0x80000A98, 0x80000A9C, 0x80000AA0, 0xA0000AA4,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x50000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x50000000, 0x50000000, 0x50000000, 0x50000000, 0x50000000, 0x50000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x50000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x2000A641, 0x60000000, 0x2000A643, 0x60000000, 0x2000A645, 0x60000000, 0x2000A647, 0x60000000,
+            0x2000A649, 0x60000000, 0x2000A64B, 0x60000000, 0x2000A64D, 0x60000000, 0x2000A64F, 0x60000000,
+            0x2000A651, 0x60000000, 0x2000A653, 0x60000000, 0x2000A655, 0x60000000, 0x2000A657, 0x60000000,
+            0x2000A659, 0x60000000, 0x2000A65B, 0x60000000, 0x2000A65D, 0x60000000, 0x2000A65F, 0x60000000,
+            0x2000A661, 0x60000000, 0x2000A663, 0x60000000, 0x2000A665, 0x60000000, 0x2000A667, 0x60000000,
+            0x2000A669, 0x60000000, 0x2000A66B, 0x60000000, 0x2000A66D, 0x60000000, 0x40000000, 0x80000AA8,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x80000AA9, 0x80000AAA, 0x80000AAB, 0x80000AAC,
+            0x80000AAD, 0x80000AAE, 0x80000AAF, 0x80000AB0, 0x80000AB1, 0x80000AB2, 0xC0000000, 0x50000000,
+            0x2000A681, 0x60000000, 0x2000A683, 0x60000000, 0x2000A685, 0x60000000, 0x2000A687, 0x60000000,
+            0x2000A689, 0x60000000, 0x2000A68B, 0x60000000, 0x2000A68D, 0x60000000, 0x2000A68F, 0x60000000,
+            0x2000A691, 0x60000000, 0x2000A693, 0x60000000, 0x2000A695, 0x60000000, 0x2000A697, 0x60000000,
+            0x2000A699, 0x60000000, 0x2000A69B, 0x60000000, 0x2000044A, 0x2000044C, 0x80000AB3, 0x80000AB4,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x80000AB5, 0x80000AB6, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x50000000,
+            0x50000000, 0x50000000, 0x50000000, 0x50000000, 0x50000000, 0x50000000, 0x50000000, 0x50000000,
+            0xC0000000, 0xC0000000, 0x2000A723, 0x60000000, 0x2000A725, 0x60000000, 0x2000A727, 0x60000000,
+            0x2000A729, 0x60000000, 0x2000A72B, 0x60000000, 0x2000A72D, 0x60000000, 0x2000A72F, 0x60000000,
+            0x60000000, 0x60000000, 0x2000A733, 0x60000000, 0x2000A735, 0x60000000, 0x2000A737, 0x60000000,
+            0x2000A739, 0x60000000, 0x2000A73B, 0x60000000, 0x2000A73D, 0x60000000, 0x2000A73F, 0x60000000,
+            0x2000A741, 0x60000000, 0x2000A743, 0x60000000, 0x2000A745, 0x60000000, 0x2000A747, 0x60000000,
+            0x2000A749, 0x60000000, 0x2000A74B, 0x60000000, 0x2000A74D, 0x60000000, 0x2000A74F, 0x60000000,
+            0x2000A751, 0x60000000, 0x2000A753, 0x60000000, 0x2000A755, 0x60000000, 0x2000A757, 0x60000000,
+            0x2000A759, 0x60000000, 0x2000A75B, 0x60000000, 0x2000A75D, 0x60000000, 0x2000A75F, 0x60000000,
+            0x2000A761, 0x60000000, 0x2000A763, 0x60000000, 0x2000A765, 0x60000000, 0x2000A767, 0x60000000,
+            0x2000A769, 0x60000000, 0x2000A76B, 0x60000000, 0x2000A76D, 0x60000000, 0x2000A76F, 0x60000000,
+            0x2000A76F, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x2000A77A, 0x60000000, 0x2000A77C, 0x60000000, 0x20001D79, 0x2000A77F, 0x60000000,
+            0x2000A781, 0x60000000, 0x2000A783, 0x60000000, 0x2000A785, 0x60000000, 0x2000A787, 0x60000000,
+            0x50000000, 0xC0000000, 0xC0000000, 0x2000A78C, 0x60000000, 0x20000265, 0x60000000, 0x40000000,
+            0x2000A791, 0x60000000, 0x2000A793, 0x60000000, 0x60000000, 0x60000000, 0x2000A797, 0x60000000,
+            0x2000A799, 0x60000000, 0x2000A79B, 0x60000000, 0x2000A79D, 0x60000000, 0x2000A79F, 0x60000000,
+            0x2000A7A1, 0x60000000, 0x2000A7A3, 0x60000000, 0x2000A7A5, 0x60000000, 0x2000A7A7, 0x60000000,
+            0x2000A7A9, 0x60000000, 0x20000266, 0x2000025C, 0x20000261, 0x2000026C, 0x2000026A, 0x60000000,
+            0x2000029E, 0x20000287, 0x2000029D, 0x2000AB53, 0x2000A7B5, 0x60000000, 0x2000A7B7, 0x60000000,
+            0x2000A7B9, 0x60000000, 0x2000A7BB, 0x60000000, 0x2000A7BD, 0x60000000, 0x2000A7BF, 0x60000000,
+            0x2000A7C1, 0x60000000, 0x2000A7C3, 0x60000000, 0x2000A794, 0x20000282, 0x20001D8E, 0x2000A7C8,
+            0x60000000, 0x2000A7CA, 0x60000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x2000A7D1, 0x60000000, 0xC0000000, 0x60000000, 0xC0000000, 0x60000000, 0x2000A7D7, 0x60000000,
+            0x2000A7D9, 0x60000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x20000063, 0x20000066, 0x20000071, 0x2000A7F6, 0x60000000, 0x40000000,
+            0x20000127, 0x20000153, 0x60000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+        },
+        {
+            0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x80000AB7, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x80000AB8, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x80000AB9, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x80000ABA, 0x80000ABB, 0x80000ABC, 0x80000ABD, 0x80000ABE, 0x80000ABF, 0x80000AC0, 0x80000AC1,
+            0x80000AC2, 0x80000AC3, 0x80000AC4, 0x80000AC5, 0x80000AC6, 0x80000AC7, 0x80000AC8, 0x80000AC9,
+            0x80000ACA, 0x80000ACB, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0x80000ACC, 0x80000ACD, 0x80000ACE, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0x80000ACF, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x80000AD0, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x80000AD1, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x50000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x50000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x50000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x80000AD2, 0x40000000, 0x80000AD3, 0x80000AD4, 0x80000AD5, 0x40000000, 0x40000000, 0x80000AD6,
+            0x80000AD7, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x80000AD8, 0x80000AD9,
+            0x40000000, 0x80000ADA, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x50000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x40000000, 0x50000000, 0x50000000, 0xC0000000, 0x80000ADB, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0xC0000000, 0x2000A727, 0x2000AB37, 0x2000026B, 0x2000AB52,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x2000028D, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x80000ADC, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x8C48, 0x66F4, 0x8ECA, 0x8CC8, 0x6ED1, 0x4E32, 0x53E5, 0x9F9C,
+            0x9F9C, 0x5951, 0x91D1, 0x5587, 0x5948, 0x61F6, 0x7669, 0x7F85,
+            0x863F, 0x87BA, 0x88F8, 0x908F, 0x6A02, 0x6D1B, 0x70D9, 0x73DE,
+            0x843D, 0x916A, 0x99F1, 0x4E82, 0x5375, 0x6B04, 0x721B, 0x862D,
+            0x9E1E, 0x5D50, 0x6FEB, 0x85CD, 0x8964, 0x62C9, 0x81D8, 0x881F,
+            0x5ECA, 0x6717, 0x6D6A, 0x72FC, 0x90CE, 0x4F86, 0x51B7, 0x52DE,
+            0x64C4, 0x6AD3, 0x7210, 0x76E7, 0x8001, 0x8606, 0x865C, 0x8DEF,
+            0x9732, 0x9B6F, 0x9DFA, 0x788C, 0x797F, 0x7DA0, 0x83C9, 0x9304,
+            0x9E7F, 0x8AD6, 0x58DF, 0x5F04, 0x7C60, 0x807E, 0x7262, 0x78CA,
+            0x8CC2, 0x96F7, 0x58D8, 0x5C62, 0x6A13, 0x6DDA, 0x6F0F, 0x7D2F,
+            0x7E37, 0x964B, 0x52D2, 0x808B, 0x51DC, 0x51CC, 0x7A1C, 0x7DBE,
+            0x83F1, 0x9675, 0x8B80, 0x62CF, 0x6A02, 0x8AFE, 0x4E39, 0x5BE7,
+            0x6012, 0x7387, 0x7570, 0x5317, 0x78FB, 0x4FBF, 0x5FA9, 0x4E0D,
+            0x6CCC, 0x6578, 0x7D22, 0x53C3, 0x585E, 0x7701, 0x8449, 0x8AAA,
+            0x6BBA, 0x8FB0, 0x6C88, 0x62FE, 0x82E5, 0x63A0, 0x7565, 0x4EAE,
+            0x5169, 0x51C9, 0x6881, 0x7CE7, 0x826F, 0x8AD2, 0x91CF, 0x52F5,
+            0x5442, 0x5973, 0x5EEC, 0x65C5, 0x6FFE, 0x792A, 0x95AD, 0x9A6A,
+            0x9E97, 0x9ECE, 0x529B, 0x66C6, 0x6B77, 0x8F62, 0x5E74, 0x6190,
+            0x6200, 0x649A, 0x6F23, 0x7149, 0x7489, 0x79CA, 0x7DF4, 0x806F,
+            0x8F26, 0x84EE, 0x9023, 0x934A, 0x5217, 0x52A3, 0x54BD, 0x70C8,
+            0x88C2, 0x8AAA, 0x5EC9, 0x5FF5, 0x637B, 0x6BAE, 0x7C3E, 0x7375,
+            0x4EE4, 0x56F9, 0x5BE7, 0x5DBA, 0x601C, 0x73B2, 0x7469, 0x7F9A,
+            0x8046, 0x9234, 0x96F6, 0x9748, 0x9818, 0x4F8B, 0x79AE, 0x91B4,
+            0x96B8, 0x60E1, 0x4E86, 0x50DA, 0x5BEE, 0x5C3F, 0x6599, 0x6A02,
+            0x71CE, 0x7642, 0x84FC, 0x907C, 0x9F8D, 0x6688, 0x962E, 0x5289,
+            0x677B, 0x67F3, 0x6D41, 0x6E9C, 0x7409, 0x7559, 0x786B, 0x7D10,
+            0x985E, 0x516D, 0x622E, 0x9678, 0x502B, 0x5D19, 0x6DEA, 0x8F2A,
+            0x5F8B, 0x6144, 0x6817, 0x7387, 0x9686, 0x5229, 0x540F, 0x5C65,
+            0x6613, 0x674E, 0x68A8, 0x6CE5, 0x7406, 0x75E2, 0x7F79, 0x88CF,
+            0x88E1, 0x91CC, 0x96E2, 0x533F, 0x6EBA, 0x541D, 0x71D0, 0x7498,
+            0x85FA, 0x96A3, 0x9C57, 0x9E9F, 0x6797, 0x6DCB, 0x81E8, 0x7ACB,
+            0x7B20, 0x7C92, 0x72C0, 0x7099, 0x8B58, 0x4EC0, 0x8336, 0x523A,
+        },
+        {
+            0x5207, 0x5EA6, 0x62D3, 0x7CD6, 0x5B85, 0x6D1E, 0x66B4, 0x8F3B,
+            0x884C, 0x964D, 0x898B, 0x5ED3, 0x5140, 0x55C0, 0x40000000, 0x40000000,
+            0x585A, 0x40000000, 0x6674, 0x40000000, 0x40000000, 0x51DE, 0x732A, 0x76CA,
+            0x793C, 0x795E, 0x7965, 0x798F, 0x9756, 0x7CBE, 0x7FBD, 0x40000000,
+            0x8612, 0x40000000, 0x8AF8, 0x40000000, 0x40000000, 0x9038, 0x90FD, 0x40000000,
+            0x40000000, 0x40000000, 0x98EF, 0x98FC, 0x9928, 0x9DB4, 0x90DE, 0x96B7,
+            0x4FAE, 0x50E7, 0x514D, 0x52C9, 0x52E4, 0x5351, 0x559D, 0x5606,
+            0x5668, 0x5840, 0x58A8, 0x5C64, 0x5C6E, 0x6094, 0x6168, 0x618E,
+            0x61F2, 0x654F, 0x65E2, 0x6691, 0x6885, 0x6D77, 0x6E1A, 0x6F22,
+            0x716E, 0x722B, 0x7422, 0x7891, 0x793E, 0x7949, 0x7948, 0x7950,
+            0x7956, 0x795D, 0x798D, 0x798E, 0x7A40, 0x7A81, 0x7BC0, 0x7DF4,
+            0x7E09, 0x7E41, 0x7F72, 0x8005, 0x81ED, 0x8279, 0x8279, 0x8457,
+            0x8910, 0x8996, 0x8B01, 0x8B39, 0x8CD3, 0x8D08, 0x8FB6, 0x9038,
+            0x96E3, 0x97FF, 0x983B, 0x6075, 0x242EE, 0x8218, 0xC0000000, 0xC0000000,
+            0x4E26, 0x51B5, 0x5168, 0x4F80, 0x5145, 0x5180, 0x52C7, 0x52FA,
+            0x559D, 0x5555, 0x5599, 0x55E2, 0x585A, 0x58B3, 0x5944, 0x5954,
+            0x5A62, 0x5B28, 0x5ED2, 0x5ED9, 0x5F69, 0x5FAD, 0x60D8, 0x614E,
+            0x6108, 0x618E, 0x6160, 0x61F2, 0x6234, 0x63C4, 0x641C, 0x6452,
+            0x6556, 0x6674, 0x6717, 0x671B, 0x6756, 0x6B79, 0x6BBA, 0x6D41,
+            0x6EDB, 0x6ECB, 0x6F22, 0x701E, 0x716E, 0x77A7, 0x7235, 0x72AF,
+            0x732A, 0x7471, 0x7506, 0x753B, 0x761D, 0x761F, 0x76CA, 0x76DB,
+            0x76F4, 0x774A, 0x7740, 0x78CC, 0x7AB1, 0x7BC0, 0x7C7B, 0x7D5B,
+            0x7DF4, 0x7F3E, 0x8005, 0x8352, 0x83EF, 0x8779, 0x8941, 0x8986,
+            0x8996, 0x8ABF, 0x8AF8, 0x8ACB, 0x8B01, 0x8AFE, 0x8AED, 0x8B39,
+            0x8B8A, 0x8D08, 0x8F38, 0x9072, 0x9199, 0x9276, 0x967C, 0x96E3,
+            0x9756, 0x97DB, 0x97FF, 0x980B, 0x983B, 0x9B12, 0x9F9C, 0x2284A,
+            0x22844, 0x233D5, 0x3B9D, 0x4018, 0x4039, 0x25249, 0x25CD0, 0x27ED3,
+            0x9F43, 0x9F8E, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xA0000ADD, 0xA0000AE0, 0xA0000AE3, 0xA0000AE6, 0xA0000AEA, 0xA0000AEE, 0xA0000AF1, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xA0000AF4, 0xA0000AF7, 0xA0000AFA, 0xA0000AFD, 0xA0000B00,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x5D9, 0x80000B03, 0x5F2,
+            0x5E2, 0x5D0, 0x5D3, 0x5D4, 0x5DB, 0x5DC, 0x5DD, 0x5E8,
+            0x5EA, 0xC0000000, 0x5E9, 0x5E9, 0x5E9, 0x5E9, 0x5D0, 0x5D0,
+            0x5D0, 0x5D1, 0x5D2, 0x5D3, 0x5D4, 0x5D5, 0x5D6, 0xC0000000,
+            0x5D8, 0x5D9, 0x5DA, 0x5DB, 0x5DC, 0xC0000000, 0x5DE, 0xC0000000,
+            0x5E0, 0x5E1, 0xC0000000, 0x5E3, 0x5E4, 0xC0000000, 0x5E6, 0x5E7,
+            0x5E8, 0x5E9, 0x5EA, 0x5D5, 0x5D1, 0x5DB, 0x5E4, 0x80000B04,
+            0x671, 0x671, 0x67B, 0x67B, 0x67B, 0x67B, 0x67E, 0x67E,
+            0x67E, 0x67E, 0x680, 0x680, 0x680, 0x680, 0x67A, 0x67A,
+            0x67A, 0x67A, 0x67F, 0x67F, 0x67F, 0x67F, 0x679, 0x679,
+            0x679, 0x679, 0x6A4, 0x6A4, 0x6A4, 0x6A4, 0x6A6, 0x6A6,
+            0x6A6, 0x6A6, 0x684, 0x684, 0x684, 0x684, 0x683, 0x683,
+            0x683, 0x683, 0x686, 0x686, 0x686, 0x686, 0x687, 0x687,
+            0x687, 0x687, 0x68D, 0x68D, 0x68C, 0x68C, 0x68E, 0x68E,
+            0x688, 0x688, 0x698, 0x698, 0x691, 0x691, 0x6A9, 0x6A9,
+            0x6A9, 0x6A9, 0x6AF, 0x6AF, 0x6AF, 0x6AF, 0x6B3, 0x6B3,
+            0x6B3, 0x6B3, 0x6B1, 0x6B1, 0x6B1, 0x6B1, 0x6BA, 0x6BA,
+            0x6BB, 0x6BB, 0x6BB, 0x6BB, 0x6D5, 0x6D5, 0x6C1, 0x6C1,
+            0x6C1, 0x6C1, 0x6BE, 0x6BE, 0x6BE, 0x6BE, 0x6D2, 0x6D2,
+            0x6D2, 0x6D2, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0x6AD, 0x6AD, 0x6AD, 0x6AD, 0x6C7,
+            0x6C7, 0x6C6, 0x6C6, 0x6C8, 0x6C8, 0x80000B07, 0x6CB, 0x6CB,
+            0x6C5, 0x6C5, 0x6C9, 0x6C9, 0x6D0, 0x6D0, 0x6D0, 0x6D0,
+            0x649, 0x649, 0x80000B0A, 0x80000B0D, 0x80000B10, 0x80000B13, 0x80000B16, 0x80000B19,
+            0x80000B1C, 0x80000B1F, 0x80000B22, 0x80000B25, 0x80000B28, 0x80000B2B, 0x80000B2E, 0x80000B31,
+            0x80000B34, 0x80000B37, 0x80000B3A, 0x80000B3D, 0x6CC, 0x6CC, 0x6CC, 0x6CC,
+        },
+        {
+            0x80000B40, 0x80000B43, 0x80000B46, 0x80000B49, 0x80000B4C, 0x80000B4F, 0x80000B52, 0x80000B55,
+            0x80000B58, 0x80000B5B, 0x80000B5E, 0x80000B61, 0x80000B64, 0x80000B67, 0x80000B6A, 0x80000B6D,
+            0x80000B70, 0x80000B73, 0x80000B76, 0x80000B79, 0x80000B7C, 0x80000B7F, 0x80000B82, 0x80000B85,
+            0x80000B88, 0x80000B8B, 0x80000B8E, 0x80000B91, 0x80000B94, 0x80000B97, 0x80000B9A, 0x80000B9D,
+            0x80000BA0, 0x80000BA3, 0x80000BA6, 0x80000BA9, 0x80000BAC, 0x80000BAF, 0x80000BB2, 0x80000BB5,
+            0x80000BB8, 0x80000BBB, 0x80000BBE, 0x80000BC1, 0x80000BC4, 0x80000BC7, 0x80000BCA, 0x80000BCD,
+            0x80000BD0, 0x80000BD3, 0x80000BD6, 0x80000BD9, 0x80000BDC, 0x80000BDF, 0x80000BE2, 0x80000BE5,
+            0x80000BE8, 0x80000BEB, 0x80000BEE, 0x80000BF1, 0x80000BF4, 0x80000BF7, 0x80000BFA, 0x80000BFD,
+            0x80000C00, 0x80000C03, 0x80000C06, 0x80000C09, 0x80000C0C, 0x80000C0F, 0x80000C12, 0x80000C15,
+            0x80000C18, 0x80000C1B, 0x80000C1E, 0x80000C21, 0x80000C24, 0x80000C27, 0x80000C2A, 0x80000C2D,
+            0x80000C30, 0x80000C33, 0x80000C36, 0x80000C39, 0x80000C3C, 0x80000C3F, 0x80000C42, 0x80000C45,
+            0x80000C48, 0x80000C4B, 0x80000C4E, 0x630, 0x631, 0x649, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x80000C51, 0x80000C54, 0x80000C57, 0x80000C5A,
+            0x80000C5D, 0x80000C60, 0x80000C63, 0x80000C66, 0x80000C69, 0x80000C6C, 0x80000C6F, 0x80000C72,
+            0x80000C75, 0x80000C78, 0x80000C7B, 0x80000C7E, 0x80000C81, 0x80000C84, 0x80000C87, 0x80000C8A,
+            0x80000C8D, 0x80000C90, 0x80000C93, 0x80000C96, 0x80000C99, 0x80000C9C, 0x80000C9F, 0x80000CA2,
+            0x80000CA5, 0x80000CA8, 0x80000CAB, 0x80000CAE, 0x80000CB1, 0x80000CB4, 0x80000CB7, 0x80000CBA,
+            0x80000CBD, 0x80000CC0, 0x80000CC3, 0x80000CC6, 0x80000CC9, 0x80000CCC, 0x80000CCF, 0x80000CD2,
+            0x649, 0x80000CD5, 0x80000CD8, 0x80000CDB, 0x80000CDE, 0x80000CE1, 0x80000CE4, 0x80000CE7,
+            0x80000CEA, 0x80000CED, 0x80000CF0, 0x80000CF3, 0x80000CF6, 0x80000CF9, 0x80000CFC, 0x80000CFF,
+            0x80000D02, 0x80000D05, 0x80000D08, 0x80000D0B, 0x80000D0E, 0x80000D11, 0x80000D14, 0x80000D17,
+            0x80000D1A, 0x80000D1D, 0x80000D20, 0x80000D23, 0x80000D26, 0x80000D29, 0x80000D2C, 0x80000D2F,
+            0x80000D32, 0x80000D35, 0x80000D38, 0x80000D3B, 0x80000D3E, 0x80000D41, 0x80000D44, 0x80000D47,
+            0x80000D4A, 0x80000D4D, 0x80000D50, 0x80000D53, 0x80000D56, 0x80000D59, 0x80000D5C, 0x80000D5F,
+            0x80000D62, 0x80000D65, 0x80000D68, 0x80000D6B, 0x80000D6E, 0x80000D71, 0x80000D74, 0x80000D77,
+            0x80000D7A, 0x80000D7D, 0x80000D80, 0x80000D83, 0x80000D86, 0x80000D89, 0x80000D8C, 0x80000D8F,
+            0x80000D92, 0x80000D95, 0x80000D98, 0x80000D9B, 0x80000D9E, 0x80000DA1, 0x80000DA4, 0x80000DA7,
+            0x80000DAA, 0x647, 0x80000DAD, 0x80000DB0, 0x80000DB3, 0x80000DB6, 0x80000DB9, 0x80000DBC,
+            0x80000DBF, 0x80000DC2, 0x80000DC5, 0x80000DC8, 0x80000DCB, 0x80000DCE, 0x80000DD1, 0x80000DD4,
+            0x80000DD7, 0x80000DDA, 0x80000DDD, 0x80000DE0, 0x80000DE3, 0x80000DE6, 0x80000DE9, 0x80000DEC,
+            0x80000DEF, 0x80000DF2, 0x10000640, 0x10000640, 0x10000640, 0x80000DF5, 0x80000DF8, 0x80000DFB,
+            0x80000DFE, 0x80000E01, 0x80000E04, 0x80000E07, 0x80000E0A, 0x80000E0D, 0x80000E10, 0x80000E13,
+        },
+        {
+            0x80000E16, 0x80000E19, 0x80000E1C, 0x80000E1F, 0x80000E22, 0x80000E25, 0x80000E28, 0x80000E2B,
+            0x80000E2E, 0x80000E31, 0x80000E34, 0x80000E37, 0x80000E3A, 0x80000E3D, 0x80000E40, 0x80000E43,
+            0x80000E46, 0x80000E49, 0x80000E4C, 0x80000E4F, 0x80000E52, 0x80000E55, 0x80000E58, 0x80000E5B,
+            0x80000E5E, 0x80000E61, 0x80000E64, 0x80000E67, 0x80000E6A, 0x80000E6D, 0x80000E70, 0x80000E73,
+            0x80000E76, 0x80000E79, 0x80000E7C, 0x80000E7F, 0x80000E82, 0x80000E85, 0x80000E88, 0x80000E8B,
+            0x80000E8E, 0x80000E91, 0x80000E94, 0x80000E97, 0x80000E9A, 0x80000E9D, 0x80000EA0, 0x80000EA3,
+            0x80000EA6, 0x80000EA9, 0x80000EAC, 0x80000EAF, 0x80000EB2, 0x80000EB5, 0x80000EB8, 0x80000EBB,
+            0x80000EBE, 0x80000EC1, 0x80000EC4, 0x80000EC7, 0x627, 0x627, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x80000ECA, 0x80000ECE, 0x80000ED2, 0x80000ED6, 0x80000EDA, 0x80000EDE, 0x80000EE2, 0x80000EE6,
+            0x80000EEA, 0x80000EEE, 0x80000EF2, 0x80000EF6, 0x80000EFA, 0x80000EFE, 0x80000F02, 0x80000F06,
+            0x80000F0A, 0x80000F0E, 0x80000F12, 0x80000F16, 0x80000F1A, 0x80000F1E, 0x80000F22, 0x80000F26,
+            0x80000F2A, 0x80000F2E, 0x80000F32, 0x80000F36, 0x80000F3A, 0x80000F3E, 0x80000F42, 0x80000F46,
+            0x80000F4A, 0x80000F4E, 0x80000F52, 0x80000F56, 0x80000F5A, 0x80000F5E, 0x80000F62, 0x80000F66,
+            0x80000F6A, 0x80000F6E, 0x80000F72, 0x80000F76, 0x80000F7A, 0x80000F7E, 0x80000F82, 0x80000F86,
+            0x80000F8A, 0x80000F8E, 0x80000F92, 0x80000F96, 0x80000F9A, 0x80000F9E, 0x80000FA2, 0x80000FA6,
+            0x80000FAA, 0x80000FAE, 0x80000FB2, 0x80000FB6, 0x80000FBA, 0x80000FBE, 0x80000FC2, 0x80000FC6,
+            0xC0000000, 0xC0000000, 0x80000FCA, 0x80000FCE, 0x80000FD2, 0x80000FD6, 0x80000FDA, 0x80000FDE,
+            0x80000FE2, 0x80000FE6, 0x80000FEA, 0x80000FEE, 0x80000FF2, 0x80000FF6, 0x80000FFA, 0x80000FFE,
+            0x80001002, 0x80001006, 0x8000100A, 0x8000100E, 0x80001012, 0x80001016, 0x8000101A, 0x8000101E,
+            0x80001022, 0x80001026, 0x8000102A, 0x8000102E, 0x80001032, 0x80001036, 0x8000103A, 0x8000103E,
+            0x80001042, 0x80001046, 0x8000104A, 0x8000104E, 0x80001052, 0x80001056, 0x8000105A, 0x8000105E,
+            0x80001062, 0x80001066, 0x8000106A, 0x8000106E, 0x80001072, 0x80001076, 0x8000107A, 0x8000107E,
+            0x80001082, 0x80001086, 0x8000108A, 0x8000108E, 0x80001092, 0x80001096, 0x8000109A, 0x8000109E,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x800010A2, 0x800010A6, 0x800010AA, 0x800010AF, 0x800010B4, 0x800010B9, 0x800010BE, 0x800010C3,
+            0x800010C8, 0x800010CD, 0x800010D1, 0x800010E4, 0x800010ED, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x800010F2, 0x800010F3, 0x800010F4, 0x800010F5, 0x800010F6, 0x800010F7, 0x800010F8, 0x800010F9,
+            0x800010FA, 0x800010FB, 0x800010FC, 0x800010FD, 0x800010FE, 0x800010FF, 0x80001100, 0x80001101,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0x10000640, 0xC0000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x10000640,
+            0xC0000000, 0x10000640, 0xC0000000, 0x10000640, 0xC0000000, 0x10000640, 0xC0000000, 0x10000640,
+            0x621, 0x627, 0x627, 0x627, 0x627, 0x648, 0x648, 0x627,
+            0x627, 0x64A, 0x64A, 0x64A, 0x64A, 0x627, 0x627, 0x628,
+            0x628, 0x628, 0x628, 0x629, 0x629, 0x62A, 0x62A, 0x62A,
+            0x62A, 0x62B, 0x62B, 0x62B, 0x62B, 0x62C, 0x62C, 0x62C,
+            0x62C, 0x62D, 0x62D, 0x62D, 0x62D, 0x62E, 0x62E, 0x62E,
+            0x62E, 0x62F, 0x62F, 0x630, 0x630, 0x631, 0x631, 0x632,
+            0x632, 0x633, 0x633, 0x633, 0x633, 0x634, 0x634, 0x634,
+            0x634, 0x635, 0x635, 0x635, 0x635, 0x636, 0x636, 0x636,
+            0x636, 0x637, 0x637, 0x637, 0x637, 0x638, 0x638, 0x638,
+            0x638, 0x639, 0x639, 0x639, 0x639, 0x63A, 0x63A, 0x63A,
+            0x63A, 0x641, 0x641, 0x641, 0x641, 0x642, 0x642, 0x642,
+            0x642, 0x643, 0x643, 0x643, 0x643, 0x644, 0x644, 0x644,
+            0x644, 0x645, 0x645, 0x645, 0x645, 0x646, 0x646, 0x646,
+            0x646, 0x647, 0x647, 0x647, 0x647, 0x648, 0x648, 0x649,
+            0x649, 0x64A, 0x64A, 0x64A, 0x64A, 0x80001102, 0x80001105, 0x80001108,
+            0x8000110B, 0x8000110E, 0x80001111, 0x80001114, 0x80001117, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+            0x38, 0x39, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0x20000061, 0x20000062, 0x20000063, 0x20000064, 0x20000065, 0x20000066, 0x20000067,
+            0x20000068, 0x20000069, 0x2000006A, 0x2000006B, 0x2000006C, 0x2000006D, 0x2000006E, 0x2000006F,
+            0x20000070, 0x20000071, 0x20000072, 0x20000073, 0x20000074, 0x20000075, 0x20000076, 0x20000077,
+            0x20000078, 0x20000079, 0x2000007A, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0x20000061, 0x20000062, 0x20000063, 0x20000064, 0x20000065, 0x20000066, 0x20000067,
+            0x20000068, 0x20000069, 0x2000006A, 0x2000006B, 0x2000006C, 0x2000006D, 0x2000006E, 0x2000006F,
+            0x20000070, 0x20000071, 0x20000072, 0x20000073, 0x20000074, 0x20000075, 0x20000076, 0x20000077,
+            0x20000078, 0x20000079, 0x2000007A, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x30F2, 0x30A1,
+            0x30A3, 0x30A5, 0x30A7, 0x30A9, 0x30E3, 0x30E5, 0x30E7, 0x30C3,
+            0x100030FC, 0x30A2, 0x30A4, 0x30A6, 0x30A8, 0x30AA, 0x30AB, 0x30AD,
+            0x30AF, 0x30B1, 0x30B3, 0x30B5, 0x30B7, 0x30B9, 0x30BB, 0x30BD,
+            0x30BF, 0x30C1, 0x30C4, 0x30C6, 0x30C8, 0x30CA, 0x30CB, 0x30CC,
+            0x30CD, 0x30CE, 0x30CF, 0x30D2, 0x30D5, 0x30D8, 0x30DB, 0x30DE,
+            0x30DF, 0x30E0, 0x30E1, 0x30E2, 0x30E4, 0x30E6, 0x30E8, 0x30E9,
+            0x30EA, 0x30EB, 0x30EC, 0x30ED, 0x30EF, 0x30F3, 0x8000111A, 0x8000111B,
+            0x1160, 0x1100, 0x1101, 0x11AA, 0x1102, 0x11AC, 0x11AD, 0x1103,
+            0x1104, 0x1105, 0x11B0, 0x11B1, 0x11B2, 0x11B3, 0x11B4, 0x11B5,
+            0x111A, 0x1106, 0x1107, 0x1108, 0x1121, 0x1109, 0x110A, 0x110B,
+            0x110C, 0x110D, 0x110E, 0x110F, 0x1110, 0x1111, 0x1112, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x1161, 0x1162, 0x1163, 0x1164, 0x1165, 0x1166,
+            0xC0000000, 0xC0000000, 0x1167, 0x1168, 0x1169, 0x116A, 0x116B, 0x116C,
+            0xC0000000, 0xC0000000, 0x116D, 0x116E, 0x116F, 0x1170, 0x1171, 0x1172,
+            0xC0000000, 0xC0000000, 0x1173, 0x1174, 0x1175, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x8000111C, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x8000111D, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x8000111E, 0x8000111F,
+            0x80001120, 0x80001121, 0x80001122, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x20010428, 0x20010429, 0x2001042A, 0x2001042B, 0x2001042C, 0x2001042D, 0x2001042E, 0x2001042F,
+            0x20010430, 0x20010431, 0x20010432, 0x20010433, 0x20010434, 0x20010435, 0x20010436, 0x20010437,
+            0x20010438, 0x20010439, 0x2001043A, 0x2001043B, 0x2001043C, 0x2001043D, 0x2001043E, 0x2001043F,
+            0x20010440, 0x20010441, 0x20010442, 0x20010443, 0x20010444, 0x20010445, 0x20010446, 0x20010447,
+            0x20010448, 0x20010449, 0x2001044A, 0x2001044B, 0x2001044C, 0x2001044D, 0x2001044E, 0x2001044F,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x200104D8, 0x200104D9, 0x200104DA, 0x200104DB, 0x200104DC, 0x200104DD, 0x200104DE, 0x200104DF,
+            0x200104E0, 0x200104E1, 0x200104E2, 0x200104E3, 0x200104E4, 0x200104E5, 0x200104E6, 0x200104E7,
+            0x200104E8, 0x200104E9, 0x200104EA, 0x200104EB, 0x200104EC, 0x200104ED, 0x200104EE, 0x200104EF,
+            0x200104F0, 0x200104F1, 0x200104F2, 0x200104F3, 0x200104F4, 0x200104F5, 0x200104F6, 0x200104F7,
+            0x200104F8, 0x200104F9, 0x200104FA, 0x200104FB, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x20010597, 0x20010598, 0x20010599, 0x2001059A, 0x2001059B, 0x2001059C, 0x2001059D, 0x2001059E,
+            0x2001059F, 0x200105A0, 0x200105A1, 0xC0000000, 0x200105A3, 0x200105A4, 0x200105A5, 0x200105A6,
+            0x200105A7, 0x200105A8, 0x200105A9, 0x200105AA, 0x200105AB, 0x200105AC, 0x200105AD, 0x200105AE,
+            0x200105AF, 0x200105B0, 0x200105B1, 0xC0000000, 0x200105B3, 0x200105B4, 0x200105B5, 0x200105B6,
+            0x200105B7, 0x200105B8, 0x200105B9, 0xC0000000, 0x200105BB, 0x200105BC, 0xC0000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0xC0000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0xC0000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0xC0000000, 0x60000000, 0x60000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x50000000, 0x100002D0, 0x100002D1, 0x200000E6, 0x20000299, 0x20000253, 0xC0000000, 0x200002A3,
+            0x2000AB66, 0x200002A5, 0x200002A4, 0x20000256, 0x20000257, 0x20001D91, 0x20000258, 0x2000025E,
+            0x200002A9, 0x20000264, 0x20000262, 0x20000260, 0x2000029B, 0x20000127, 0x2000029C, 0x20000267,
+            0x20000284, 0x200002AA, 0x200002AB, 0x2000026C, 0x2001DF04, 0x2000A78E, 0x2000026E, 0x2001DF05,
+            0x2000028E, 0x2001DF06, 0x200000F8, 0x20000276, 0x20000277, 0x20000071, 0x2000027A, 0x2001DF08,
+            0x2000027D, 0x2000027E, 0x20000280, 0x200002A8, 0x200002A6, 0x2000AB67, 0x200002A7, 0x20000288,
+            0x20002C71, 0xC0000000, 0x2000028F, 0x200002A1, 0x200002A2, 0x20000298, 0x1C0, 0x1C1,
+            0x1C2, 0x1DF0A, 0x2001DF1E, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0xC0000000, 0xC0000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+        },
+        {
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x80001123, 0xC0000000, 0x80001124,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0x80001125, 0x80001126, 0x80001127, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x80001128,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x80001129, 0x8000112A, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x20010CC0, 0x20010CC1, 0x20010CC2, 0x20010CC3, 0x20010CC4, 0x20010CC5, 0x20010CC6, 0x20010CC7,
+            0x20010CC8, 0x20010CC9, 0x20010CCA, 0x20010CCB, 0x20010CCC, 0x20010CCD, 0x20010CCE, 0x20010CCF,
+            0x20010CD0, 0x20010CD1, 0x20010CD2, 0x20010CD3, 0x20010CD4, 0x20010CD5, 0x20010CD6, 0x20010CD7,
+            0x20010CD8, 0x20010CD9, 0x20010CDA, 0x20010CDB, 0x20010CDC, 0x20010CDD, 0x20010CDE, 0x20010CDF,
+            0x20010CE0, 0x20010CE1, 0x20010CE2, 0x20010CE3, 0x20010CE4, 0x20010CE5, 0x20010CE6, 0x20010CE7,
+            0x20010CE8, 0x20010CE9, 0x20010CEA, 0x20010CEB, 0x20010CEC, 0x20010CED, 0x20010CEE, 0x20010CEF,
+            0x20010CF0, 0x20010CF1, 0x20010CF2, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x8000112B, 0x8000112C, 0x8000112D, 0x8000112E,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0x8000112F, 0x80001130, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x80001131, 0x80001132,
+            0x80001133, 0x80001134, 0x80001135, 0x80001136, 0x80001137, 0x80001138, 0x80001139, 0x8000113A,
+            0x8000113B, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x8000113C, 0x8000113D, 0x8000113E, 0x8000113F, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x80001140, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x80001141, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x80001142,
+            0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x11099, 0x40000000, 0x1109B, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x110A5, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0x80001143, 0x80001144, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x80001145, 0x80001146, 0x80001147, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0x80001148, 0x80001149, 0xC0000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0xC0000000, 0xC0000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x8000114A, 0xC0000000, 0xC0000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x8000114B, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x8000114C, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x8000114D, 0x8000114E, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0x8000114F, 0x80001150, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0x80001151, 0x80001152, 0x40000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x80001153, 0xC0000000, 0xC0000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x80001154, 0x80001155,
+            0x80001156, 0x80001157, 0x80001158, 0x80001159, 0x8000115A, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x8000115B, 0x8000115C, 0x8000115D, 0x8000115E, 0x8000115F, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x80001160, 0xC0000000, 0xC0000000, 0xC0000000, 0x80001161, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x80001162, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x80001163, 0x80001164, 0x40000000, 0x40000000, 0xC0000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x80001165,
+            0x80001166, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x80001167,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x80001168, 0x80001169,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0x8000116A, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0x8000116B, 0x8000116C, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x200118C0, 0x200118C1, 0x200118C2, 0x200118C3, 0x200118C4, 0x200118C5, 0x200118C6, 0x200118C7,
+            0x200118C8, 0x200118C9, 0x200118CA, 0x200118CB, 0x200118CC, 0x200118CD, 0x200118CE, 0x200118CF,
+            0x200118D0, 0x200118D1, 0x200118D2, 0x200118D3, 0x200118D4, 0x200118D5, 0x200118D6, 0x200118D7,
+            0x200118D8, 0x200118D9, 0x200118DA, 0x200118DB, 0x200118DC, 0x200118DD, 0x200118DE, 0x200118DF,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0x40000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x8000116D, 0x8000116E, 0x40000000,
+            0xC0000000, 0x40000000, 0xC0000000, 0x8000116F, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x80001170, 0x40000000, 0xC0000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x80001171, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x80001172,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0x80001173, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x80001174,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x80001175, 0xC0000000, 0x80001176, 0x80001177, 0x40000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000,
+            0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x80001178,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0x80001179, 0x8000117A, 0x8000117B, 0x8000117C, 0x8000117D, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x8000117E, 0x8000117F, 0x80001180, 0x80001181, 0x80001182, 0x80001183, 0x80001184, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x50000000, 0x50000000, 0x50000000, 0x50000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x20016E60, 0x20016E61, 0x20016E62, 0x20016E63, 0x20016E64, 0x20016E65, 0x20016E66, 0x20016E67,
+            0x20016E68, 0x20016E69, 0x20016E6A, 0x20016E6B, 0x20016E6C, 0x20016E6D, 0x20016E6E, 0x20016E6F,
+            0x20016E70, 0x20016E71, 0x20016E72, 0x20016E73, 0x20016E74, 0x20016E75, 0x20016E76, 0x20016E77,
+            0x20016E78, 0x20016E79, 0x20016E7A, 0x20016E7B, 0x20016E7C, 0x20016E7D, 0x20016E7E, 0x20016E7F,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0x50000000, 0x50000000, 0x50000000, 0x50000000, 0x50000000,
+            0x50000000, 0x50000000, 0x50000000, 0x50000000, 0x50000000, 0x50000000, 0x50000000, 0x50000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x50000000, 0x50000000, 0xC0000000, 0x50000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x80001185, 0x80001186, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x50000000, 0x50000000, 0x50000000, 0x50000000, 0xC0000000, 0x50000000, 0x50000000, 0x50000000,
+            0x50000000, 0x50000000, 0x50000000, 0x50000000, 0xC0000000, 0x50000000, 0x50000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x80001187, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x80001188, 0x80001189, 0x8000118A,
+            0x8000118B, 0x8000118C, 0xC0000000, 0xC0000000, 0xC0000000, 0x8000118D, 0x8000118E, 0x8000118F,
+            0x80001190, 0x80001191, 0x80001192, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0x80001193, 0x80001194, 0x80001195, 0x80001196, 0x80001197,
+            0x80001198, 0x80001199, 0x8000119A, 0xC0000000, 0xC0000000, 0x8000119B, 0x8000119C, 0x8000119D,
+            0x8000119E, 0x8000119F, 0x800011A0, 0x800011A1, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x800011A2, 0x800011A3, 0x800011A4, 0x800011A5, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x800011A6, 0x800011A7, 0x800011A8, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x20000061, 0x20000062, 0x20000063, 0x20000064, 0x20000065, 0x20000066, 0x20000067, 0x20000068,
+            0x20000069, 0x2000006A, 0x2000006B, 0x2000006C, 0x2000006D, 0x2000006E, 0x2000006F, 0x20000070,
+            0x20000071, 0x20000072, 0x20000073, 0x20000074, 0x20000075, 0x20000076, 0x20000077, 0x20000078,
+            0x20000079, 0x2000007A, 0x20000061, 0x20000062, 0x20000063, 0x20000064, 0x20000065, 0x20000066,
+            0x20000067, 0x20000068, 0x20000069, 0x2000006A, 0x2000006B, 0x2000006C, 0x2000006D, 0x2000006E,
+            0x2000006F, 0x20000070, 0x20000071, 0x20000072, 0x20000073, 0x20000074, 0x20000075, 0x20000076,
+            0x20000077, 0x20000078, 0x20000079, 0x2000007A, 0x20000061, 0x20000062, 0x20000063, 0x20000064,
+            0x20000065, 0x20000066, 0x20000067, 0x20000068, 0x20000069, 0x2000006A, 0x2000006B, 0x2000006C,
+            0x2000006D, 0x2000006E, 0x2000006F, 0x20000070, 0x20000071, 0x20000072, 0x20000073, 0x20000074,
+            0x20000075, 0x20000076, 0x20000077, 0x20000078, 0x20000079, 0x2000007A, 0x20000061, 0x20000062,
+            0x20000063, 0x20000064, 0x20000065, 0x20000066, 0x20000067, 0xC0000000, 0x20000069, 0x2000006A,
+            0x2000006B, 0x2000006C, 0x2000006D, 0x2000006E, 0x2000006F, 0x20000070, 0x20000071, 0x20000072,
+            0x20000073, 0x20000074, 0x20000075, 0x20000076, 0x20000077, 0x20000078, 0x20000079, 0x2000007A,
+            0x20000061, 0x20000062, 0x20000063, 0x20000064, 0x20000065, 0x20000066, 0x20000067, 0x20000068,
+            0x20000069, 0x2000006A, 0x2000006B, 0x2000006C, 0x2000006D, 0x2000006E, 0x2000006F, 0x20000070,
+            0x20000071, 0x20000072, 0x20000073, 0x20000074, 0x20000075, 0x20000076, 0x20000077, 0x20000078,
+            0x20000079, 0x2000007A, 0x20000061, 0x20000062, 0x20000063, 0x20000064, 0x20000065, 0x20000066,
+            0x20000067, 0x20000068, 0x20000069, 0x2000006A, 0x2000006B, 0x2000006C, 0x2000006D, 0x2000006E,
+            0x2000006F, 0x20000070, 0x20000071, 0x20000072, 0x20000073, 0x20000074, 0x20000075, 0x20000076,
+            0x20000077, 0x20000078, 0x20000079, 0x2000007A, 0x20000061, 0xC0000000, 0x20000063, 0x20000064,
+            0xC0000000, 0xC0000000, 0x20000067, 0xC0000000, 0xC0000000, 0x2000006A, 0x2000006B, 0xC0000000,
+            0xC0000000, 0x2000006E, 0x2000006F, 0x20000070, 0x20000071, 0xC0000000, 0x20000073, 0x20000074,
+            0x20000075, 0x20000076, 0x20000077, 0x20000078, 0x20000079, 0x2000007A, 0x20000061, 0x20000062,
+            0x20000063, 0x20000064, 0xC0000000, 0x20000066, 0xC0000000, 0x20000068, 0x20000069, 0x2000006A,
+            0x2000006B, 0x2000006C, 0x2000006D, 0x2000006E, 0xC0000000, 0x20000070, 0x20000071, 0x20000072,
+            0x20000073, 0x20000074, 0x20000075, 0x20000076, 0x20000077, 0x20000078, 0x20000079, 0x2000007A,
+            0x20000061, 0x20000062, 0x20000063, 0x20000064, 0x20000065, 0x20000066, 0x20000067, 0x20000068,
+            0x20000069, 0x2000006A, 0x2000006B, 0x2000006C, 0x2000006D, 0x2000006E, 0x2000006F, 0x20000070,
+            0x20000071, 0x20000072, 0x20000073, 0x20000074, 0x20000075, 0x20000076, 0x20000077, 0x20000078,
+            0x20000079, 0x2000007A, 0x20000061, 0x20000062, 0x20000063, 0x20000064, 0x20000065, 0x20000066,
+            0x20000067, 0x20000068, 0x20000069, 0x2000006A, 0x2000006B, 0x2000006C, 0x2000006D, 0x2000006E,
+            0x2000006F, 0x20000070, 0x20000071, 0x20000072, 0x20000073, 0x20000074, 0x20000075, 0x20000076,
+        },
+        {
+            0x20000077, 0x20000078, 0x20000079, 0x2000007A, 0x20000061, 0x20000062, 0xC0000000, 0x20000064,
+            0x20000065, 0x20000066, 0x20000067, 0xC0000000, 0xC0000000, 0x2000006A, 0x2000006B, 0x2000006C,
+            0x2000006D, 0x2000006E, 0x2000006F, 0x20000070, 0x20000071, 0xC0000000, 0x20000073, 0x20000074,
+            0x20000075, 0x20000076, 0x20000077, 0x20000078, 0x20000079, 0xC0000000, 0x20000061, 0x20000062,
+            0x20000063, 0x20000064, 0x20000065, 0x20000066, 0x20000067, 0x20000068, 0x20000069, 0x2000006A,
+            0x2000006B, 0x2000006C, 0x2000006D, 0x2000006E, 0x2000006F, 0x20000070, 0x20000071, 0x20000072,
+            0x20000073, 0x20000074, 0x20000075, 0x20000076, 0x20000077, 0x20000078, 0x20000079, 0x2000007A,
+            0x20000061, 0x20000062, 0xC0000000, 0x20000064, 0x20000065, 0x20000066, 0x20000067, 0xC0000000,
+            0x20000069, 0x2000006A, 0x2000006B, 0x2000006C, 0x2000006D, 0xC0000000, 0x2000006F, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x20000073, 0x20000074, 0x20000075, 0x20000076, 0x20000077, 0x20000078,
+            0x20000079, 0xC0000000, 0x20000061, 0x20000062, 0x20000063, 0x20000064, 0x20000065, 0x20000066,
+            0x20000067, 0x20000068, 0x20000069, 0x2000006A, 0x2000006B, 0x2000006C, 0x2000006D, 0x2000006E,
+            0x2000006F, 0x20000070, 0x20000071, 0x20000072, 0x20000073, 0x20000074, 0x20000075, 0x20000076,
+            0x20000077, 0x20000078, 0x20000079, 0x2000007A, 0x20000061, 0x20000062, 0x20000063, 0x20000064,
+            0x20000065, 0x20000066, 0x20000067, 0x20000068, 0x20000069, 0x2000006A, 0x2000006B, 0x2000006C,
+            0x2000006D, 0x2000006E, 0x2000006F, 0x20000070, 0x20000071, 0x20000072, 0x20000073, 0x20000074,
+            0x20000075, 0x20000076, 0x20000077, 0x20000078, 0x20000079, 0x2000007A, 0x20000061, 0x20000062,
+            0x20000063, 0x20000064, 0x20000065, 0x20000066, 0x20000067, 0x20000068, 0x20000069, 0x2000006A,
+            0x2000006B, 0x2000006C, 0x2000006D, 0x2000006E, 0x2000006F, 0x20000070, 0x20000071, 0x20000072,
+            0x20000073, 0x20000074, 0x20000075, 0x20000076, 0x20000077, 0x20000078, 0x20000079, 0x2000007A,
+            0x20000061, 0x20000062, 0x20000063, 0x20000064, 0x20000065, 0x20000066, 0x20000067, 0x20000068,
+            0x20000069, 0x2000006A, 0x2000006B, 0x2000006C, 0x2000006D, 0x2000006E, 0x2000006F, 0x20000070,
+            0x20000071, 0x20000072, 0x20000073, 0x20000074, 0x20000075, 0x20000076, 0x20000077, 0x20000078,
+            0x20000079, 0x2000007A, 0x20000061, 0x20000062, 0x20000063, 0x20000064, 0x20000065, 0x20000066,
+            0x20000067, 0x20000068, 0x20000069, 0x2000006A, 0x2000006B, 0x2000006C, 0x2000006D, 0x2000006E,
+            0x2000006F, 0x20000070, 0x20000071, 0x20000072, 0x20000073, 0x20000074, 0x20000075, 0x20000076,
+            0x20000077, 0x20000078, 0x20000079, 0x2000007A, 0x20000061, 0x20000062, 0x20000063, 0x20000064,
+            0x20000065, 0x20000066, 0x20000067, 0x20000068, 0x20000069, 0x2000006A, 0x2000006B, 0x2000006C,
+            0x2000006D, 0x2000006E, 0x2000006F, 0x20000070, 0x20000071, 0x20000072, 0x20000073, 0x20000074,
+            0x20000075, 0x20000076, 0x20000077, 0x20000078, 0x20000079, 0x2000007A, 0x20000061, 0x20000062,
+            0x20000063, 0x20000064, 0x20000065, 0x20000066, 0x20000067, 0x20000068, 0x20000069, 0x2000006A,
+            0x2000006B, 0x2000006C, 0x2000006D, 0x2000006E, 0x2000006F, 0x20000070, 0x20000071, 0x20000072,
+        },
+        {
+            0x20000073, 0x20000074, 0x20000075, 0x20000076, 0x20000077, 0x20000078, 0x20000079, 0x2000007A,
+            0x20000061, 0x20000062, 0x20000063, 0x20000064, 0x20000065, 0x20000066, 0x20000067, 0x20000068,
+            0x20000069, 0x2000006A, 0x2000006B, 0x2000006C, 0x2000006D, 0x2000006E, 0x2000006F, 0x20000070,
+            0x20000071, 0x20000072, 0x20000073, 0x20000074, 0x20000075, 0x20000076, 0x20000077, 0x20000078,
+            0x20000079, 0x2000007A, 0x20000061, 0x20000062, 0x20000063, 0x20000064, 0x20000065, 0x20000066,
+            0x20000067, 0x20000068, 0x20000069, 0x2000006A, 0x2000006B, 0x2000006C, 0x2000006D, 0x2000006E,
+            0x2000006F, 0x20000070, 0x20000071, 0x20000072, 0x20000073, 0x20000074, 0x20000075, 0x20000076,
+            0x20000077, 0x20000078, 0x20000079, 0x2000007A, 0x20000061, 0x20000062, 0x20000063, 0x20000064,
+            0x20000065, 0x20000066, 0x20000067, 0x20000068, 0x20000069, 0x2000006A, 0x2000006B, 0x2000006C,
+            0x2000006D, 0x2000006E, 0x2000006F, 0x20000070, 0x20000071, 0x20000072, 0x20000073, 0x20000074,
+            0x20000075, 0x20000076, 0x20000077, 0x20000078, 0x20000079, 0x2000007A, 0x20000061, 0x20000062,
+            0x20000063, 0x20000064, 0x20000065, 0x20000066, 0x20000067, 0x20000068, 0x20000069, 0x2000006A,
+            0x2000006B, 0x2000006C, 0x2000006D, 0x2000006E, 0x2000006F, 0x20000070, 0x20000071, 0x20000072,
+            0x20000073, 0x20000074, 0x20000075, 0x20000076, 0x20000077, 0x20000078, 0x20000079, 0x2000007A,
+            0x20000061, 0x20000062, 0x20000063, 0x20000064, 0x20000065, 0x20000066, 0x20000067, 0x20000068,
+            0x20000069, 0x2000006A, 0x2000006B, 0x2000006C, 0x2000006D, 0x2000006E, 0x2000006F, 0x20000070,
+            0x20000071, 0x20000072, 0x20000073, 0x20000074, 0x20000075, 0x20000076, 0x20000077, 0x20000078,
+            0x20000079, 0x2000007A, 0x20000061, 0x20000062, 0x20000063, 0x20000064, 0x20000065, 0x20000066,
+            0x20000067, 0x20000068, 0x20000069, 0x2000006A, 0x2000006B, 0x2000006C, 0x2000006D, 0x2000006E,
+            0x2000006F, 0x20000070, 0x20000071, 0x20000072, 0x20000073, 0x20000074, 0x20000075, 0x20000076,
+            0x20000077, 0x20000078, 0x20000079, 0x2000007A, 0x20000131, 0x20000237, 0xC0000000, 0xC0000000,
+            0x200003B1, 0x200003B2, 0x200003B3, 0x200003B4, 0x200003B5, 0x200003B6, 0x200003B7, 0x200003B8,
+            0x200003B9, 0x200003BA, 0x200003BB, 0x200003BC, 0x200003BD, 0x200003BE, 0x200003BF, 0x200003C0,
+            0x200003C1, 0x200003B8, 0x280003C3, 0x200003C4, 0x200003C5, 0x200003C6, 0x200003C7, 0x200003C8,
+            0x200003C9, 0xC0000000, 0x200003B1, 0x200003B2, 0x200003B3, 0x200003B4, 0x200003B5, 0x200003B6,
+            0x200003B7, 0x200003B8, 0x200003B9, 0x200003BA, 0x200003BB, 0x200003BC, 0x200003BD, 0x200003BE,
+            0x200003BF, 0x200003C0, 0x200003C1, 0x200003C2, 0x200003C3, 0x200003C4, 0x200003C5, 0x200003C6,
+            0x200003C7, 0x200003C8, 0x200003C9, 0xC0000000, 0x200003B5, 0x200003B8, 0x200003BA, 0x200003C6,
+            0x200003C1, 0x200003C0, 0x200003B1, 0x200003B2, 0x200003B3, 0x200003B4, 0x200003B5, 0x200003B6,
+            0x200003B7, 0x200003B8, 0x200003B9, 0x200003BA, 0x200003BB, 0x200003BC, 0x200003BD, 0x200003BE,
+            0x200003BF, 0x200003C0, 0x200003C1, 0x200003B8, 0x280003C3, 0x200003C4, 0x200003C5, 0x200003C6,
+            0x200003C7, 0x200003C8, 0x200003C9, 0xC0000000, 0x200003B1, 0x200003B2, 0x200003B3, 0x200003B4,
+        },
+        {
+            0x200003B5, 0x200003B6, 0x200003B7, 0x200003B8, 0x200003B9, 0x200003BA, 0x200003BB, 0x200003BC,
+            0x200003BD, 0x200003BE, 0x200003BF, 0x200003C0, 0x200003C1, 0x200003C2, 0x200003C3, 0x200003C4,
+            0x200003C5, 0x200003C6, 0x200003C7, 0x200003C8, 0x200003C9, 0xC0000000, 0x200003B5, 0x200003B8,
+            0x200003BA, 0x200003C6, 0x200003C1, 0x200003C0, 0x200003B1, 0x200003B2, 0x200003B3, 0x200003B4,
+            0x200003B5, 0x200003B6, 0x200003B7, 0x200003B8, 0x200003B9, 0x200003BA, 0x200003BB, 0x200003BC,
+            0x200003BD, 0x200003BE, 0x200003BF, 0x200003C0, 0x200003C1, 0x200003B8, 0x280003C3, 0x200003C4,
+            0x200003C5, 0x200003C6, 0x200003C7, 0x200003C8, 0x200003C9, 0xC0000000, 0x200003B1, 0x200003B2,
+            0x200003B3, 0x200003B4, 0x200003B5, 0x200003B6, 0x200003B7, 0x200003B8, 0x200003B9, 0x200003BA,
+            0x200003BB, 0x200003BC, 0x200003BD, 0x200003BE, 0x200003BF, 0x200003C0, 0x200003C1, 0x200003C2,
+            0x200003C3, 0x200003C4, 0x200003C5, 0x200003C6, 0x200003C7, 0x200003C8, 0x200003C9, 0xC0000000,
+            0x200003B5, 0x200003B8, 0x200003BA, 0x200003C6, 0x200003C1, 0x200003C0, 0x200003B1, 0x200003B2,
+            0x200003B3, 0x200003B4, 0x200003B5, 0x200003B6, 0x200003B7, 0x200003B8, 0x200003B9, 0x200003BA,
+            0x200003BB, 0x200003BC, 0x200003BD, 0x200003BE, 0x200003BF, 0x200003C0, 0x200003C1, 0x200003B8,
+            0x280003C3, 0x200003C4, 0x200003C5, 0x200003C6, 0x200003C7, 0x200003C8, 0x200003C9, 0xC0000000,
+            0x200003B1, 0x200003B2, 0x200003B3, 0x200003B4, 0x200003B5, 0x200003B6, 0x200003B7, 0x200003B8,
+            0x200003B9, 0x200003BA, 0x200003BB, 0x200003BC, 0x200003BD, 0x200003BE, 0x200003BF, 0x200003C0,
+            0x200003C1, 0x200003C2, 0x200003C3, 0x200003C4, 0x200003C5, 0x200003C6, 0x200003C7, 0x200003C8,
+            0x200003C9, 0xC0000000, 0x200003B5, 0x200003B8, 0x200003BA, 0x200003C6, 0x200003C1, 0x200003C0,
+            0x200003B1, 0x200003B2, 0x200003B3, 0x200003B4, 0x200003B5, 0x200003B6, 0x200003B7, 0x200003B8,
+            0x200003B9, 0x200003BA, 0x200003BB, 0x200003BC, 0x200003BD, 0x200003BE, 0x200003BF, 0x200003C0,
+            0x200003C1, 0x200003B8, 0x280003C3, 0x200003C4, 0x200003C5, 0x200003C6, 0x200003C7, 0x200003C8,
+            0x200003C9, 0xC0000000, 0x200003B1, 0x200003B2, 0x200003B3, 0x200003B4, 0x200003B5, 0x200003B6,
+            0x200003B7, 0x200003B8, 0x200003B9, 0x200003BA, 0x200003BB, 0x200003BC, 0x200003BD, 0x200003BE,
+            0x200003BF, 0x200003C0, 0x200003C1, 0x200003C2, 0x200003C3, 0x200003C4, 0x200003C5, 0x200003C6,
+            0x200003C7, 0x200003C8, 0x200003C9, 0xC0000000, 0x200003B5, 0x200003B8, 0x200003BA, 0x200003C6,
+            0x200003C1, 0x200003C0, 0x200003DD, 0x200003DD, 0xC0000000, 0xC0000000, 0x30, 0x31,
+            0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+            0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+            0x38, 0x39, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+            0x36, 0x37, 0x38, 0x39, 0x30, 0x31, 0x32, 0x33,
+            0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x30, 0x31,
+            0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+        },
+        {
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x40000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x800011A9, 0x800011AA, 0x800011AB, 0x800011AC, 0x800011AD, 0x800011AE, 0x800011AF, 0xC0000000,
+            0x800011B0, 0x800011B1, 0x800011B2, 0x800011B3, 0x800011B4, 0x800011B5, 0x800011B6, 0x800011B7,
+            0x800011B8, 0x800011B9, 0x800011BA, 0x800011BB, 0x800011BC, 0x800011BD, 0x800011BE, 0x800011BF,
+            0x800011C0, 0xC0000000, 0xC0000000, 0x800011C1, 0x800011C2, 0x800011C3, 0x800011C4, 0x800011C5,
+            0x800011C6, 0x800011C7, 0xC0000000, 0x800011C8, 0x800011C9, 0xC0000000, 0x800011CA, 0x800011CB,
+            0x800011CC, 0x800011CD, 0x800011CE, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x800011CF, 0x800011D0, 0x800011D1, 0x800011D2, 0x800011D3, 0x800011D4, 0x800011D5, 0x50000000,
+            0x50000000, 0x50000000, 0x50000000, 0x50000000, 0x50000000, 0x50000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x40000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x800011D6, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x800011D7, 0x800011D8, 0x800011D9, 0x800011DA,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x800011DB, 0x800011DC, 0x800011DD, 0x800011DE, 0x800011DF, 0x800011E0, 0x800011E1, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x2001E922, 0x2001E923, 0x2001E924, 0x2001E925, 0x2001E926, 0x2001E927, 0x2001E928, 0x2001E929,
+            0x2001E92A, 0x2001E92B, 0x2001E92C, 0x2001E92D, 0x2001E92E, 0x2001E92F, 0x2001E930, 0x2001E931,
+            0x2001E932, 0x2001E933, 0x2001E934, 0x2001E935, 0x2001E936, 0x2001E937, 0x2001E938, 0x2001E939,
+            0x2001E93A, 0x2001E93B, 0x2001E93C, 0x2001E93D, 0x2001E93E, 0x2001E93F, 0x2001E940, 0x2001E941,
+            0x2001E942, 0x2001E943, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x60000000,
+            0x60000000, 0x60000000, 0x60000000, 0x60000000, 0x800011E2, 0x800011E3, 0x800011E4, 0x800011E5,
+            0x800011E6, 0x800011E7, 0x800011E8, 0x50000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x627, 0x628, 0x62C, 0x62F, 0xC0000000, 0x648, 0x632, 0x62D,
+            0x637, 0x64A, 0x643, 0x644, 0x645, 0x646, 0x633, 0x639,
+            0x641, 0x635, 0x642, 0x631, 0x634, 0x62A, 0x62B, 0x62E,
+            0x630, 0x636, 0x638, 0x63A, 0x66E, 0x6BA, 0x6A1, 0x66F,
+            0xC0000000, 0x628, 0x62C, 0xC0000000, 0x647, 0xC0000000, 0xC0000000, 0x62D,
+            0xC0000000, 0x64A, 0x643, 0x644, 0x645, 0x646, 0x633, 0x639,
+            0x641, 0x635, 0x642, 0xC0000000, 0x634, 0x62A, 0x62B, 0x62E,
+            0xC0000000, 0x636, 0xC0000000, 0x63A, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0x62C, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0x62D,
+            0xC0000000, 0x64A, 0xC0000000, 0x644, 0xC0000000, 0x646, 0x633, 0x639,
+            0xC0000000, 0x635, 0x642, 0xC0000000, 0x634, 0xC0000000, 0xC0000000, 0x62E,
+            0xC0000000, 0x636, 0xC0000000, 0x63A, 0xC0000000, 0x6BA, 0xC0000000, 0x66F,
+            0xC0000000, 0x628, 0x62C, 0xC0000000, 0x647, 0xC0000000, 0xC0000000, 0x62D,
+            0x637, 0x64A, 0x643, 0xC0000000, 0x645, 0x646, 0x633, 0x639,
+            0x641, 0x635, 0x642, 0xC0000000, 0x634, 0x62A, 0x62B, 0x62E,
+            0xC0000000, 0x636, 0x638, 0x63A, 0x66E, 0xC0000000, 0x6A1, 0xC0000000,
+            0x627, 0x628, 0x62C, 0x62F, 0x647, 0x648, 0x632, 0x62D,
+            0x637, 0x64A, 0xC0000000, 0x644, 0x645, 0x646, 0x633, 0x639,
+            0x641, 0x635, 0x642, 0x631, 0x634, 0x62A, 0x62B, 0x62E,
+            0x630, 0x636, 0x638, 0x63A, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0x628, 0x62C, 0x62F, 0xC0000000, 0x648, 0x632, 0x62D,
+            0x637, 0x64A, 0xC0000000, 0x644, 0x645, 0x646, 0x633, 0x639,
+            0x641, 0x635, 0x642, 0x631, 0x634, 0x62A, 0x62B, 0x62E,
+            0x630, 0x636, 0x638, 0x63A, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x800011E9, 0x800011EC, 0x800011EF, 0x800011F2, 0x800011F5, 0x800011F8, 0x800011FB, 0x800011FE,
+            0x80001201, 0x80001204, 0x80001207, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xA000120A, 0xA000120E, 0xA0001212, 0xA0001216, 0xA000121A, 0xA000121E, 0xA0001222, 0xA0001226,
+            0xA000122A, 0xA000122E, 0xA0001232, 0xA0001236, 0xA000123A, 0xA000123E, 0xA0001242, 0xA0001246,
+            0xA000124A, 0xA000124E, 0xA0001252, 0xA0001256, 0xA000125A, 0xA000125E, 0xA0001262, 0xA0001266,
+            0xA000126A, 0xA000126E, 0xA0001272, 0x20000063, 0x20000072, 0xA0001276, 0xA0001279, 0xC0000000,
+            0x20000061, 0x20000062, 0x20000063, 0x20000064, 0x20000065, 0x20000066, 0x20000067, 0x20000068,
+            0x20000069, 0x2000006A, 0x2000006B, 0x2000006C, 0x2000006D, 0x2000006E, 0x2000006F, 0x20000070,
+            0x20000071, 0x20000072, 0x20000073, 0x20000074, 0x20000075, 0x20000076, 0x20000077, 0x20000078,
+            0x20000079, 0x2000007A, 0xA000127C, 0xA000127F, 0xA0001282, 0xA0001285, 0xA0001288, 0xA000128C,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xA000128F, 0xA0001292, 0xA0001295, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xA0001298, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x8000129B, 0x8000129E, 0x30B5, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x624B, 0x5B57, 0x53CC, 0x30C6, 0x4E8C, 0x591A, 0x89E3, 0x5929,
+            0x4EA4, 0x6620, 0x7121, 0x6599, 0x524D, 0x5F8C, 0x518D, 0x65B0,
+            0x521D, 0x7D42, 0x751F, 0x8CA9, 0x58F0, 0x5439, 0x6F14, 0x6295,
+            0x6355, 0x4E00, 0x4E09, 0x904A, 0x5DE6, 0x4E2D, 0x53F3, 0x6307,
+            0x8D70, 0x6253, 0x7981, 0x7A7A, 0x5408, 0x6E80, 0x6709, 0x6708,
+            0x7533, 0x5272, 0x55B6, 0x914D, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x800012A1, 0x800012A5, 0x800012A9, 0x800012AD, 0x800012B1, 0x800012B5, 0x800012B9, 0x800012BD,
+            0x800012C1, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x5F97, 0x53EF, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+            0x38, 0x39, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x4E3D, 0x4E38, 0x4E41, 0x20122, 0x4F60, 0x4FAE, 0x4FBB, 0x5002,
+            0x507A, 0x5099, 0x50E7, 0x50CF, 0x349E, 0x2063A, 0x514D, 0x5154,
+            0x5164, 0x5177, 0x2051C, 0x34B9, 0x5167, 0x518D, 0x2054B, 0x5197,
+            0x51A4, 0x4ECC, 0x51AC, 0x51B5, 0x291DF, 0x51F5, 0x5203, 0x34DF,
+            0x523B, 0x5246, 0x5272, 0x5277, 0x3515, 0x52C7, 0x52C9, 0x52E4,
+            0x52FA, 0x5305, 0x5306, 0x5317, 0x5349, 0x5351, 0x535A, 0x5373,
+            0x537D, 0x537F, 0x537F, 0x537F, 0x20A2C, 0x7070, 0x53CA, 0x53DF,
+            0x20B63, 0x53EB, 0x53F1, 0x5406, 0x549E, 0x5438, 0x5448, 0x5468,
+            0x54A2, 0x54F6, 0x5510, 0x5553, 0x5563, 0x5584, 0x5584, 0x5599,
+            0x55AB, 0x55B3, 0x55C2, 0x5716, 0x5606, 0x5717, 0x5651, 0x5674,
+            0x5207, 0x58EE, 0x57CE, 0x57F4, 0x580D, 0x578B, 0x5832, 0x5831,
+            0x58AC, 0x214E4, 0x58F2, 0x58F7, 0x5906, 0x591A, 0x5922, 0x5962,
+            0x216A8, 0x216EA, 0x59EC, 0x5A1B, 0x5A27, 0x59D8, 0x5A66, 0x36EE,
+            0x36FC, 0x5B08, 0x5B3E, 0x5B3E, 0x219C8, 0x5BC3, 0x5BD8, 0x5BE7,
+            0x5BF3, 0x21B18, 0x5BFF, 0x5C06, 0x5F53, 0x5C22, 0x3781, 0x5C60,
+            0x5C6E, 0x5CC0, 0x5C8D, 0x21DE4, 0x5D43, 0x21DE6, 0x5D6E, 0x5D6B,
+            0x5D7C, 0x5DE1, 0x5DE2, 0x382F, 0x5DFD, 0x5E28, 0x5E3D, 0x5E69,
+            0x3862, 0x22183, 0x387C, 0x5EB0, 0x5EB3, 0x5EB6, 0x5ECA, 0x2A392,
+            0x5EFE, 0x22331, 0x22331, 0x8201, 0x5F22, 0x5F22, 0x38C7, 0x232B8,
+            0x261DA, 0x5F62, 0x5F6B, 0x38E3, 0x5F9A, 0x5FCD, 0x5FD7, 0x5FF9,
+            0x6081, 0x393A, 0x391C, 0x6094, 0x226D4, 0x60C7, 0x6148, 0x614C,
+            0x614E, 0x614C, 0x617A, 0x618E, 0x61B2, 0x61A4, 0x61AF, 0x61DE,
+            0x61F2, 0x61F6, 0x6210, 0x621B, 0x625D, 0x62B1, 0x62D4, 0x6350,
+            0x22B0C, 0x633D, 0x62FC, 0x6368, 0x6383, 0x63E4, 0x22BF1, 0x6422,
+            0x63C5, 0x63A9, 0x3A2E, 0x6469, 0x647E, 0x649D, 0x6477, 0x3A6C,
+            0x654F, 0x656C, 0x2300A, 0x65E3, 0x66F8, 0x6649, 0x3B19, 0x6691,
+            0x3B08, 0x3AE4, 0x5192, 0x5195, 0x6700, 0x669C, 0x80AD, 0x43D9,
+            0x6717, 0x671B, 0x6721, 0x675E, 0x6753, 0x233C3, 0x3B49, 0x67FA,
+            0x6785, 0x6852, 0x6885, 0x2346D, 0x688E, 0x681F, 0x6914, 0x3B9D,
+            0x6942, 0x69A3, 0x69EA, 0x6AA8, 0x236A3, 0x6ADB, 0x3C18, 0x6B21,
+            0x238A7, 0x6B54, 0x3C4E, 0x6B72, 0x6B9F, 0x6BBA, 0x6BBB, 0x23A8D,
+            0x21D0B, 0x23AFA, 0x6C4E, 0x23CBC, 0x6CBF, 0x6CCD, 0x6C67, 0x6D16,
+        },
+        {
+            0x6D3E, 0x6D77, 0x6D41, 0x6D69, 0x6D78, 0x6D85, 0x23D1E, 0x6D34,
+            0x6E2F, 0x6E6E, 0x3D33, 0x6ECB, 0x6EC7, 0x23ED1, 0x6DF9, 0x6F6E,
+            0x23F5E, 0x23F8E, 0x6FC6, 0x7039, 0x701E, 0x701B, 0x3D96, 0x704A,
+            0x707D, 0x7077, 0x70AD, 0x20525, 0x7145, 0x24263, 0x719C, 0x243AB,
+            0x7228, 0x7235, 0x7250, 0x24608, 0x7280, 0x7295, 0x24735, 0x24814,
+            0x737A, 0x738B, 0x3EAC, 0x73A5, 0x3EB8, 0x3EB8, 0x7447, 0x745C,
+            0x7471, 0x7485, 0x74CA, 0x3F1B, 0x7524, 0x24C36, 0x753E, 0x24C92,
+            0x7570, 0x2219F, 0x7610, 0x24FA1, 0x24FB8, 0x25044, 0x3FFC, 0x4008,
+            0x76F4, 0x250F3, 0x250F2, 0x25119, 0x25133, 0x771E, 0x771F, 0x771F,
+            0x774A, 0x4039, 0x778B, 0x4046, 0x4096, 0x2541D, 0x784E, 0x788C,
+            0x78CC, 0x40E3, 0x25626, 0x7956, 0x2569A, 0x256C5, 0x798F, 0x79EB,
+            0x412F, 0x7A40, 0x7A4A, 0x7A4F, 0x2597C, 0x25AA7, 0x25AA7, 0x7AEE,
+            0x4202, 0x25BAB, 0x7BC6, 0x7BC9, 0x4227, 0x25C80, 0x7CD2, 0x42A0,
+            0x7CE8, 0x7CE3, 0x7D00, 0x25F86, 0x7D63, 0x4301, 0x7DC7, 0x7E02,
+            0x7E45, 0x4334, 0x26228, 0x26247, 0x4359, 0x262D9, 0x7F7A, 0x2633E,
+            0x7F95, 0x7FFA, 0x8005, 0x264DA, 0x26523, 0x8060, 0x265A8, 0x8070,
+            0x2335F, 0x43D5, 0x80B2, 0x8103, 0x440B, 0x813E, 0x5AB5, 0x267A7,
+            0x267B5, 0x23393, 0x2339C, 0x8201, 0x8204, 0x8F9E, 0x446B, 0x8291,
+            0x828B, 0x829D, 0x52B3, 0x82B1, 0x82B3, 0x82BD, 0x82E6, 0x26B3C,
+            0x82E5, 0x831D, 0x8363, 0x83AD, 0x8323, 0x83BD, 0x83E7, 0x8457,
+            0x8353, 0x83CA, 0x83CC, 0x83DC, 0x26C36, 0x26D6B, 0x26CD5, 0x452B,
+            0x84F1, 0x84F3, 0x8516, 0x273CA, 0x8564, 0x26F2C, 0x455D, 0x4561,
+            0x26FB1, 0x270D2, 0x456B, 0x8650, 0x865C, 0x8667, 0x8669, 0x86A9,
+            0x8688, 0x870E, 0x86E2, 0x8779, 0x8728, 0x876B, 0x8786, 0x45D7,
+            0x87E1, 0x8801, 0x45F9, 0x8860, 0x8863, 0x27667, 0x88D7, 0x88DE,
+            0x4635, 0x88FA, 0x34BB, 0x278AE, 0x27966, 0x46BE, 0x46C7, 0x8AA0,
+            0x8AED, 0x8B8A, 0x8C55, 0x27CA8, 0x8CAB, 0x8CC1, 0x8D1B, 0x8D77,
+            0x27F2F, 0x20804, 0x8DCB, 0x8DBC, 0x8DF0, 0x208DE, 0x8ED4, 0x8F38,
+            0x285D2, 0x285ED, 0x9094, 0x90F1, 0x9111, 0x2872E, 0x911B, 0x9238,
+            0x92D7, 0x92D8, 0x927C, 0x93F9, 0x9415, 0x28BFA, 0x958B, 0x4995,
+            0x95B7, 0x28D77, 0x49E6, 0x96C3, 0x5DB2, 0x9723, 0x29145, 0x2921A,
+            0x4A6E, 0x4A76, 0x97E0, 0x2940A, 0x4AB2, 0x29496, 0x980B, 0x980B,
+        },
+        {
+            0x9829, 0x295B6, 0x98E2, 0x4B33, 0x9929, 0x99A7, 0x99C2, 0x99FE,
+            0x4BCE, 0x29B30, 0x9B12, 0x9C40, 0x9CFD, 0x4CCE, 0x4CED, 0x9D67,
+            0x2A0CE, 0x4CF8, 0x2A105, 0x2A20E, 0x2A291, 0x9EBB, 0x4D56, 0x9EF9,
+            0x9EFE, 0x9F05, 0x9F0F, 0x9F16, 0x9F3B, 0x2A600, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+        {
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+            0x40000000, 0x40000000, 0x40000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+            0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000, 0xC0000000,
+        },
+    };
+
+    /* Length and code points of every expansion, 0 splits tokens */
+    const uint32_t EXPANSIONS[4805] = {
+        0x3, 0x31, 0x0, 0x34, 0x3, 0x31, 0x0, 0x32, 0x3, 0x33, 0x0, 0x34,
+        0x2, 0x69, 0x6A, 0x2, 0x69, 0x6A, 0x2, 0x6C, 0x0, 0x2, 0x6C, 0x0,
+        0x2, 0x2BC, 0x6E, 0x2, 0x64, 0x7A, 0x2, 0x64, 0x7A, 0x2, 0x64, 0x7A,
+        0x2, 0x6C, 0x6A, 0x2, 0x6C, 0x6A, 0x2, 0x6C, 0x6A, 0x2, 0x6E, 0x6A,
+        0x2, 0x6E, 0x6A, 0x2, 0x6E, 0x6A, 0x2, 0x64, 0x7A, 0x2, 0x64, 0x7A,
+        0x2, 0x64, 0x7A, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+        0x565, 0x582, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x2, 0x627, 0x674, 0x2, 0x648, 0x674, 0x2, 0x6C7, 0x674, 0x2,
+        0x64A, 0x674, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x2, 0xB92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0xE32, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x2, 0x0, 0xEB2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x2, 0xEAB, 0xE99, 0x2, 0xEAB, 0xEA1, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x2, 0xF42, 0x0, 0x2, 0xF4C, 0x0, 0x2, 0xF51, 0x0, 0x2, 0xF56, 0x0,
+        0x2, 0xF5B, 0x0, 0x2, 0xF40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+        0x1025, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x2, 0x1B05, 0x0, 0x2, 0x1B07, 0x0, 0x2, 0x1B09, 0x0, 0x2, 0x1B0B, 0x0,
+        0x2, 0x1B0D, 0x0, 0x2, 0x1B11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x61, 0x2BE, 0x2, 0x72, 0x73,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x3, 0x61, 0x0, 0x63, 0x3, 0x61, 0x0, 0x73, 0x2, 0x0,
+        0x63, 0x3, 0x63, 0x0, 0x6F, 0x3, 0x63, 0x0, 0x75, 0x2, 0x0, 0x66,
+        0x2, 0x6E, 0x6F, 0x2, 0x73, 0x6D, 0x3, 0x74, 0x65, 0x6C, 0x2, 0x74,
+        0x6D, 0x3, 0x66, 0x61, 0x78, 0x3, 0x31, 0x0, 0x37, 0x3, 0x31, 0x0,
+        0x39, 0x4, 0x31, 0x0, 0x31, 0x30, 0x3, 0x31, 0x0, 0x33, 0x3, 0x32,
+        0x0, 0x33, 0x3, 0x31, 0x0, 0x35, 0x3, 0x32, 0x0, 0x35, 0x3, 0x33,
+        0x0, 0x35, 0x3, 0x34, 0x0, 0x35, 0x3, 0x31, 0x0, 0x36, 0x3, 0x35,
+        0x0, 0x36, 0x3, 0x31, 0x0, 0x38, 0x3, 0x33, 0x0, 0x38, 0x3, 0x35,
+        0x0, 0x38, 0x3, 0x37, 0x0, 0x38, 0x2, 0x31, 0x0, 0x2, 0x69, 0x69,
+        0x3, 0x69, 0x69, 0x69, 0x2, 0x69, 0x76, 0x2, 0x76, 0x69, 0x3, 0x76,
+        0x69, 0x69, 0x4, 0x76, 0x69, 0x69, 0x69, 0x2, 0x69, 0x78, 0x2, 0x78,
+        0x69, 0x3, 0x78, 0x69, 0x69, 0x2, 0x69, 0x69, 0x3, 0x69, 0x69, 0x69,
+        0x2, 0x69, 0x76, 0x2, 0x76, 0x69, 0x3, 0x76, 0x69, 0x69, 0x4, 0x76,
+        0x69, 0x69, 0x69, 0x2, 0x69, 0x78, 0x2, 0x78, 0x69, 0x3, 0x78, 0x69,
+        0x69, 0x3, 0x30, 0x0, 0x33, 0x2, 0x31, 0x30, 0x2, 0x31, 0x31, 0x2,
+        0x31, 0x32, 0x2, 0x31, 0x33, 0x2, 0x31, 0x34, 0x2, 0x31, 0x35, 0x2,
+        0x31, 0x36, 0x2, 0x31, 0x37, 0x2, 0x31, 0x38, 0x2, 0x31, 0x39, 0x2,
+        0x32, 0x30, 0x3, 0x0, 0x31, 0x0, 0x3, 0x0, 0x32, 0x0, 0x3, 0x0,
+        0x33, 0x0, 0x3, 0x0, 0x34, 0x0, 0x3, 0x0, 0x35, 0x0, 0x3, 0x0,
+        0x36, 0x0, 0x3, 0x0, 0x37, 0x0, 0x3, 0x0, 0x38, 0x0, 0x3, 0x0,
+        0x39, 0x0, 0x4, 0x0, 0x31, 0x30, 0x0, 0x4, 0x0, 0x31, 0x31, 0x0,
+        0x4, 0x0, 0x31, 0x32, 0x0, 0x4, 0x0, 0x31, 0x33, 0x0, 0x4, 0x0,
+        0x31, 0x34, 0x0, 0x4, 0x0, 0x31, 0x35, 0x0, 0x4, 0x0, 0x31, 0x36,
+        0x0, 0x4, 0x0, 0x31, 0x37, 0x0, 0x4, 0x0, 0x31, 0x38, 0x0, 0x4,
+        0x0, 0x31, 0x39, 0x0, 0x4, 0x0, 0x32, 0x30, 0x0, 0x2, 0x31, 0x0,
+        0x2, 0x32, 0x0, 0x2, 0x33, 0x0, 0x2, 0x34, 0x0, 0x2, 0x35, 0x0,
+        0x2, 0x36, 0x0, 0x2, 0x37, 0x0, 0x2, 0x38, 0x0, 0x2, 0x39, 0x0,
+        0x3, 0x31, 0x30, 0x0, 0x3, 0x31, 0x31, 0x0, 0x3, 0x31, 0x32, 0x0,
+        0x3, 0x31, 0x33, 0x0, 0x3, 0x31, 0x34, 0x0, 0x3, 0x31, 0x35, 0x0,
+        0x3, 0x31, 0x36, 0x0, 0x3, 0x31, 0x37, 0x0, 0x3, 0x31, 0x38, 0x0,
+        0x3, 0x31, 0x39, 0x0, 0x3, 0x32, 0x30, 0x0, 0x3, 0x0, 0x61, 0x0,
+        0x3, 0x0, 0x62, 0x0, 0x3, 0x0, 0x63, 0x0, 0x3, 0x0, 0x64, 0x0,
+        0x3, 0x0, 0x65, 0x0, 0x3, 0x0, 0x66, 0x0, 0x3, 0x0, 0x67, 0x0,
+        0x3, 0x0, 0x68, 0x0, 0x3, 0x0, 0x69, 0x0, 0x3, 0x0, 0x6A, 0x0,
+        0x3, 0x0, 0x6B, 0x0, 0x3, 0x0, 0x6C, 0x0, 0x3, 0x0, 0x6D, 0x0,
+        0x3, 0x0, 0x6E, 0x0, 0x3, 0x0, 0x6F, 0x0, 0x3, 0x0, 0x70, 0x0,
+        0x3, 0x0, 0x71, 0x0, 0x3, 0x0, 0x72, 0x0, 0x3, 0x0, 0x73, 0x0,
+        0x3, 0x0, 0x74, 0x0, 0x3, 0x0, 0x75, 0x0, 0x3, 0x0, 0x76, 0x0,
+        0x3, 0x0, 0x77, 0x0, 0x3, 0x0, 0x78, 0x0, 0x3, 0x0, 0x79, 0x0,
+        0x3, 0x0, 0x7A, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x2, 0x3088, 0x308A, 0x2, 0x30B3, 0x30C8, 0x3, 0x0, 0x1100, 0x0, 0x3, 0x0,
+        0x1102, 0x0, 0x3, 0x0, 0x1103, 0x0, 0x3, 0x0, 0x1105, 0x0, 0x3, 0x0,
+        0x1106, 0x0, 0x3, 0x0, 0x1107, 0x0, 0x3, 0x0, 0x1109, 0x0, 0x3, 0x0,
+        0x110B, 0x0, 0x3, 0x0, 0x110C, 0x0, 0x3, 0x0, 0x110E, 0x0, 0x3, 0x0,
+        0x110F, 0x0, 0x3, 0x0, 0x1110, 0x0, 0x3, 0x0, 0x1111, 0x0, 0x3, 0x0,
+        0x1112, 0x0, 0x4, 0x0, 0x1100, 0x1161, 0x0, 0x4, 0x0, 0x1102, 0x1161, 0x0,
+        0x4, 0x0, 0x1103, 0x1161, 0x0, 0x4, 0x0, 0x1105, 0x1161, 0x0, 0x4, 0x0,
+        0x1106, 0x1161, 0x0, 0x4, 0x0, 0x1107, 0x1161, 0x0, 0x4, 0x0, 0x1109, 0x1161,
+        0x0, 0x4, 0x0, 0x110B, 0x1161, 0x0, 0x4, 0x0, 0x110C, 0x1161, 0x0, 0x4,
+        0x0, 0x110E, 0x1161, 0x0, 0x4, 0x0, 0x110F, 0x1161, 0x0, 0x4, 0x0, 0x1110,
+        0x1161, 0x0, 0x4, 0x0, 0x1111, 0x1161, 0x0, 0x4, 0x0, 0x1112, 0x1161, 0x0,
+        0x4, 0x0, 0x110C, 0x116E, 0x0, 0x7, 0x0, 0x110B, 0x1169, 0x110C, 0x1165, 0x11AB,
+        0x0, 0x6, 0x0, 0x110B, 0x1169, 0x1112, 0x116E, 0x0, 0x3, 0x0, 0x4E00, 0x0,
+        0x3, 0x0, 0x4E8C, 0x0, 0x3, 0x0, 0x4E09, 0x0, 0x3, 0x0, 0x56DB, 0x0,
+        0x3, 0x0, 0x4E94, 0x0, 0x3, 0x0, 0x516D, 0x0, 0x3, 0x0, 0x4E03, 0x0,
+        0x3, 0x0, 0x516B, 0x0, 0x3, 0x0, 0x4E5D, 0x0, 0x3, 0x0, 0x5341, 0x0,
+        0x3, 0x0, 0x6708, 0x0, 0x3, 0x0, 0x706B, 0x0, 0x3, 0x0, 0x6C34, 0x0,
+        0x3, 0x0, 0x6728, 0x0, 0x3, 0x0, 0x91D1, 0x0, 0x3, 0x0, 0x571F, 0x0,
+        0x3, 0x0, 0x65E5, 0x0, 0x3, 0x0, 0x682A, 0x0, 0x3, 0x0, 0x6709, 0x0,
+        0x3, 0x0, 0x793E, 0x0, 0x3, 0x0, 0x540D, 0x0, 0x3, 0x0, 0x7279, 0x0,
+        0x3, 0x0, 0x8CA1, 0x0, 0x3, 0x0, 0x795D, 0x0, 0x3, 0x0, 0x52B4, 0x0,
+        0x3, 0x0, 0x4EE3, 0x0, 0x3, 0x0, 0x547C, 0x0, 0x3, 0x0, 0x5B66, 0x0,
+        0x3, 0x0, 0x76E3, 0x0, 0x3, 0x0, 0x4F01, 0x0, 0x3, 0x0, 0x8CC7, 0x0,
+        0x3, 0x0, 0x5354, 0x0, 0x3, 0x0, 0x796D, 0x0, 0x3, 0x0, 0x4F11, 0x0,
+        0x3, 0x0, 0x81EA, 0x0, 0x3, 0x0, 0x81F3, 0x0, 0x3, 0x70, 0x74, 0x65,
+        0x2, 0x32, 0x31, 0x2, 0x32, 0x32, 0x2, 0x32, 0x33, 0x2, 0x32, 0x34,
+        0x2, 0x32, 0x35, 0x2, 0x32, 0x36, 0x2, 0x32, 0x37, 0x2, 0x32, 0x38,
+        0x2, 0x32, 0x39, 0x2, 0x33, 0x30, 0x2, 0x33, 0x31, 0x2, 0x33, 0x32,
+        0x2, 0x33, 0x33, 0x2, 0x33, 0x34, 0x2, 0x33, 0x35, 0x2, 0x1100, 0x1161,
+        0x2, 0x1102, 0x1161, 0x2, 0x1103, 0x1161, 0x2, 0x1105, 0x1161, 0x2, 0x1106, 0x1161,
+        0x2, 0x1107, 0x1161, 0x2, 0x1109, 0x1161, 0x2, 0x110B, 0x1161, 0x2, 0x110C, 0x1161,
+        0x2, 0x110E, 0x1161, 0x2, 0x110F, 0x1161, 0x2, 0x1110, 0x1161, 0x2, 0x1111, 0x1161,
+        0x2, 0x1112, 0x1161, 0x5, 0x110E, 0x1161, 0x11B7, 0x1100, 0x1169, 0x4, 0x110C, 0x116E,
+        0x110B, 0x1174, 0x2, 0x110B, 0x116E, 0x2, 0x33, 0x36, 0x2, 0x33, 0x37, 0x2,
+        0x33, 0x38, 0x2, 0x33, 0x39, 0x2, 0x34, 0x30, 0x2, 0x34, 0x31, 0x2,
+        0x34, 0x32, 0x2, 0x34, 0x33, 0x2, 0x34, 0x34, 0x2, 0x34, 0x35, 0x2,
+        0x34, 0x36, 0x2, 0x34, 0x37, 0x2, 0x34, 0x38, 0x2, 0x34, 0x39, 0x2,
+        0x35, 0x30, 0x2, 0x31, 0x6708, 0x2, 0x32, 0x6708, 0x2, 0x33, 0x6708, 0x2,
+        0x34, 0x6708, 0x2, 0x35, 0x6708, 0x2, 0x36, 0x6708, 0x2, 0x37, 0x6708, 0x2,
+        0x38, 0x6708, 0x2, 0x39, 0x6708, 0x3, 0x31, 0x30, 0x6708, 0x3, 0x31, 0x31,
+        0x6708, 0x3, 0x31, 0x32, 0x6708, 0x2, 0x68, 0x67, 0x3, 0x65, 0x72, 0x67,
+        0x2, 0x65, 0x76, 0x3, 0x6C, 0x74, 0x64, 0x2, 0x4EE4, 0x548C, 0x4, 0x30A2,
+        0x30CF, 0x30FC, 0x30C8, 0x4, 0x30A2, 0x30EB, 0x30D5, 0x30A1, 0x4, 0x30A2, 0x30F3, 0x30D8,
+        0x30A2, 0x3, 0x30A2, 0x30FC, 0x30EB, 0x4, 0x30A4, 0x30CB, 0x30F3, 0x30AF, 0x3, 0x30A4,
+        0x30F3, 0x30C1, 0x3, 0x30A6, 0x30A9, 0x30F3, 0x5, 0x30A8, 0x30B9, 0x30AF, 0x30FC, 0x30C8,
+        0x4, 0x30A8, 0x30FC, 0x30AB, 0x30FC, 0x3, 0x30AA, 0x30F3, 0x30B9, 0x3, 0x30AA, 0x30FC,
+        0x30E0, 0x3, 0x30AB, 0x30A4, 0x30EA, 0x4, 0x30AB, 0x30E9, 0x30C3, 0x30C8, 0x4, 0x30AB,
+        0x30ED, 0x30EA, 0x30FC, 0x3, 0x30AB, 0x30ED, 0x30F3, 0x3, 0x30AB, 0x30F3, 0x30DE, 0x2,
+        0x30AD, 0x30AB, 0x3, 0x30AD, 0x30CB, 0x30FC, 0x4, 0x30AD, 0x30E5, 0x30EA, 0x30FC, 0x4,
+        0x30AD, 0x30EB, 0x30BF, 0x30FC, 0x2, 0x30AD, 0x30ED, 0x5, 0x30AD, 0x30ED, 0x30AF, 0x30E9,
+        0x30E0, 0x6, 0x30AD, 0x30ED, 0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x5, 0x30AD, 0x30ED, 0x30EF,
+        0x30C3, 0x30C8, 0x3, 0x30AF, 0x30E9, 0x30E0, 0x5, 0x30AF, 0x30E9, 0x30E0, 0x30C8, 0x30F3,
+        0x5, 0x30AF, 0x30EB, 0x30BB, 0x30A4, 0x30ED, 0x4, 0x30AF, 0x30ED, 0x30FC, 0x30CD, 0x3,
+        0x30B1, 0x30FC, 0x30B9, 0x3, 0x30B3, 0x30EB, 0x30CA, 0x3, 0x30B3, 0x30FC, 0x30DB, 0x4,
+        0x30B5, 0x30A4, 0x30AF, 0x30EB, 0x5, 0x30B5, 0x30F3, 0x30C1, 0x30FC, 0x30E0, 0x4, 0x30B7,
+        0x30EA, 0x30F3, 0x30AF, 0x3, 0x30BB, 0x30F3, 0x30C1, 0x3, 0x30BB, 0x30F3, 0x30C8, 0x3,
+        0x30BF, 0x30FC, 0x30B9, 0x2, 0x30C6, 0x30B7, 0x2, 0x30C8, 0x30EB, 0x2, 0x30C8, 0x30F3,
+        0x2, 0x30CA, 0x30CE, 0x3, 0x30CE, 0x30C3, 0x30C8, 0x3, 0x30CF, 0x30A4, 0x30C4, 0x5,
+        0x30CF, 0x30FC, 0x30BB, 0x30F3, 0x30C8, 0x3, 0x30CF, 0x30FC, 0x30C4, 0x4, 0x30CF, 0x30FC,
+        0x30EC, 0x30EB, 0x5, 0x30D2, 0x30A2, 0x30B9, 0x30C8, 0x30EB, 0x3, 0x30D2, 0x30AF, 0x30EB,
+        0x2, 0x30D2, 0x30B3, 0x2, 0x30D2, 0x30EB, 0x5, 0x30D5, 0x30A1, 0x30E9, 0x30C3, 0x30C8,
+        0x4, 0x30D5, 0x30A3, 0x30FC, 0x30C8, 0x5, 0x30D5, 0x30C3, 0x30B7, 0x30A7, 0x30EB, 0x3,
+        0x30D5, 0x30E9, 0x30F3, 0x5, 0x30D8, 0x30AF, 0x30BF, 0x30FC, 0x30EB, 0x2, 0x30D8, 0x30BD,
+        0x3, 0x30D8, 0x30CB, 0x30D2, 0x3, 0x30D8, 0x30EB, 0x30C4, 0x3, 0x30D8, 0x30F3, 0x30B9,
+        0x3, 0x30D8, 0x30FC, 0x30B7, 0x3, 0x30D8, 0x30FC, 0x30BF, 0x4, 0x30DB, 0x30A4, 0x30F3,
+        0x30C8, 0x3, 0x30DB, 0x30EB, 0x30C8, 0x2, 0x30DB, 0x30F3, 0x3, 0x30DB, 0x30F3, 0x30C8,
+        0x3, 0x30DB, 0x30FC, 0x30EB, 0x3, 0x30DB, 0x30FC, 0x30F3, 0x4, 0x30DE, 0x30A4, 0x30AF,
+        0x30ED, 0x3, 0x30DE, 0x30A4, 0x30EB, 0x3, 0x30DE, 0x30C3, 0x30CF, 0x3, 0x30DE, 0x30EB,
+        0x30AF, 0x5, 0x30DE, 0x30F3, 0x30B7, 0x30E7, 0x30F3, 0x4, 0x30DF, 0x30AF, 0x30ED, 0x30F3,
+        0x2, 0x30DF, 0x30EA, 0x5, 0x30DF, 0x30EA, 0x30CF, 0x30FC, 0x30EB, 0x2, 0x30E1, 0x30AB,
+        0x4, 0x30E1, 0x30AB, 0x30C8, 0x30F3, 0x4, 0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x3, 0x30E4,
+        0x30FC, 0x30C8, 0x3, 0x30E4, 0x30FC, 0x30EB, 0x3, 0x30E6, 0x30A2, 0x30F3, 0x4, 0x30EA,
+        0x30C3, 0x30C8, 0x30EB, 0x2, 0x30EA, 0x30E9, 0x3, 0x30EB, 0x30D2, 0x30FC, 0x4, 0x30EB,
+        0x30FC, 0x30D5, 0x30EB, 0x2, 0x30EC, 0x30E0, 0x5, 0x30EC, 0x30F3, 0x30C8, 0x30B1, 0x30F3,
+        0x3, 0x30EF, 0x30C3, 0x30C8, 0x2, 0x30, 0x70B9, 0x2, 0x31, 0x70B9, 0x2, 0x32,
+        0x70B9, 0x2, 0x33, 0x70B9, 0x2, 0x34, 0x70B9, 0x2, 0x35, 0x70B9, 0x2, 0x36,
+        0x70B9, 0x2, 0x37, 0x70B9, 0x2, 0x38, 0x70B9, 0x2, 0x39, 0x70B9, 0x3, 0x31,
+        0x30, 0x70B9, 0x3, 0x31, 0x31, 0x70B9, 0x3, 0x31, 0x32, 0x70B9, 0x3, 0x31,
+        0x33, 0x70B9, 0x3, 0x31, 0x34, 0x70B9, 0x3, 0x31, 0x35, 0x70B9, 0x3, 0x31,
+        0x36, 0x70B9, 0x3, 0x31, 0x37, 0x70B9, 0x3, 0x31, 0x38, 0x70B9, 0x3, 0x31,
+        0x39, 0x70B9, 0x3, 0x32, 0x30, 0x70B9, 0x3, 0x32, 0x31, 0x70B9, 0x3, 0x32,
+        0x32, 0x70B9, 0x3, 0x32, 0x33, 0x70B9, 0x3, 0x32, 0x34, 0x70B9, 0x3, 0x68,
+        0x70, 0x61, 0x2, 0x64, 0x61, 0x2, 0x61, 0x75, 0x3, 0x62, 0x61, 0x72,
+        0x2, 0x6F, 0x76, 0x2, 0x70, 0x63, 0x2, 0x64, 0x6D, 0x3, 0x64, 0x6D,
+        0x32, 0x3, 0x64, 0x6D, 0x33, 0x2, 0x69, 0x75, 0x2, 0x5E73, 0x6210, 0x2,
+        0x662D, 0x548C, 0x2, 0x5927, 0x6B63, 0x2, 0x660E, 0x6CBB, 0x4, 0x682A, 0x5F0F, 0x4F1A,
+        0x793E, 0x2, 0x70, 0x61, 0x2, 0x6E, 0x61, 0x2, 0x3BC, 0x61, 0x2, 0x6D,
+        0x61, 0x2, 0x6B, 0x61, 0x2, 0x6B, 0x62, 0x2, 0x6D, 0x62, 0x2, 0x67,
+        0x62, 0x3, 0x63, 0x61, 0x6C, 0x4, 0x6B, 0x63, 0x61, 0x6C, 0x2, 0x70,
+        0x66, 0x2, 0x6E, 0x66, 0x2, 0x3BC, 0x66, 0x2, 0x3BC, 0x67, 0x2, 0x6D,
+        0x67, 0x2, 0x6B, 0x67, 0x2, 0x68, 0x7A, 0x3, 0x6B, 0x68, 0x7A, 0x3,
+        0x6D, 0x68, 0x7A, 0x3, 0x67, 0x68, 0x7A, 0x3, 0x74, 0x68, 0x7A, 0x2,
+        0x3BC, 0x6C, 0x2, 0x6D, 0x6C, 0x2, 0x64, 0x6C, 0x2, 0x6B, 0x6C, 0x2,
+        0x66, 0x6D, 0x2, 0x6E, 0x6D, 0x2, 0x3BC, 0x6D, 0x2, 0x6D, 0x6D, 0x2,
+        0x63, 0x6D, 0x2, 0x6B, 0x6D, 0x3, 0x6D, 0x6D, 0x32, 0x3, 0x63, 0x6D,
+        0x32, 0x2, 0x6D, 0x32, 0x3, 0x6B, 0x6D, 0x32, 0x3, 0x6D, 0x6D, 0x33,
+        0x3, 0x63, 0x6D, 0x33, 0x2, 0x6D, 0x33, 0x3, 0x6B, 0x6D, 0x33, 0x3,
+        0x6D, 0x0, 0x73, 0x4, 0x6D, 0x0, 0x73, 0x32, 0x2, 0x70, 0x61, 0x3,
+        0x6B, 0x70, 0x61, 0x3, 0x6D, 0x70, 0x61, 0x3, 0x67, 0x70, 0x61, 0x3,
+        0x72, 0x61, 0x64, 0x5, 0x72, 0x61, 0x64, 0x0, 0x73, 0x6, 0x72, 0x61,
+        0x64, 0x0, 0x73, 0x32, 0x2, 0x70, 0x73, 0x2, 0x6E, 0x73, 0x2, 0x3BC,
+        0x73, 0x2, 0x6D, 0x73, 0x2, 0x70, 0x76, 0x2, 0x6E, 0x76, 0x2, 0x3BC,
+        0x76, 0x2, 0x6D, 0x76, 0x2, 0x6B, 0x76, 0x2, 0x6D, 0x76, 0x2, 0x70,
+        0x77, 0x2, 0x6E, 0x77, 0x2, 0x3BC, 0x77, 0x2, 0x6D, 0x77, 0x2, 0x6B,
+        0x77, 0x2, 0x6D, 0x77, 0x2, 0x6B, 0x3C9, 0x2, 0x6D, 0x3C9, 0x4, 0x61,
+        0x0, 0x6D, 0x0, 0x2, 0x62, 0x71, 0x2, 0x63, 0x63, 0x2, 0x63, 0x64,
+        0x4, 0x63, 0x0, 0x6B, 0x67, 0x3, 0x63, 0x6F, 0x0, 0x2, 0x64, 0x62,
+        0x2, 0x67, 0x79, 0x2, 0x68, 0x61, 0x2, 0x68, 0x70, 0x2, 0x69, 0x6E,
+        0x2, 0x6B, 0x6B, 0x2, 0x6B, 0x6D, 0x2, 0x6B, 0x74, 0x2, 0x6C, 0x6D,
+        0x2, 0x6C, 0x6E, 0x3, 0x6C, 0x6F, 0x67, 0x2, 0x6C, 0x78, 0x2, 0x6D,
+        0x62, 0x3, 0x6D, 0x69, 0x6C, 0x3, 0x6D, 0x6F, 0x6C, 0x2, 0x70, 0x68,
+        0x4, 0x70, 0x0, 0x6D, 0x0, 0x3, 0x70, 0x70, 0x6D, 0x2, 0x70, 0x72,
+        0x2, 0x73, 0x72, 0x2, 0x73, 0x76, 0x2, 0x77, 0x62, 0x3, 0x76, 0x0,
+        0x6D, 0x3, 0x61, 0x0, 0x6D, 0x2, 0x31, 0x65E5, 0x2, 0x32, 0x65E5, 0x2,
+        0x33, 0x65E5, 0x2, 0x34, 0x65E5, 0x2, 0x35, 0x65E5, 0x2, 0x36, 0x65E5, 0x2,
+        0x37, 0x65E5, 0x2, 0x38, 0x65E5, 0x2, 0x39, 0x65E5, 0x3, 0x31, 0x30, 0x65E5,
+        0x3, 0x31, 0x31, 0x65E5, 0x3, 0x31, 0x32, 0x65E5, 0x3, 0x31, 0x33, 0x65E5,
+        0x3, 0x31, 0x34, 0x65E5, 0x3, 0x31, 0x35, 0x65E5, 0x3, 0x31, 0x36, 0x65E5,
+        0x3, 0x31, 0x37, 0x65E5, 0x3, 0x31, 0x38, 0x65E5, 0x3, 0x31, 0x39, 0x65E5,
+        0x3, 0x32, 0x30, 0x65E5, 0x3, 0x32, 0x31, 0x65E5, 0x3, 0x32, 0x32, 0x65E5,
+        0x3, 0x32, 0x33, 0x65E5, 0x3, 0x32, 0x34, 0x65E5, 0x3, 0x32, 0x35, 0x65E5,
+        0x3, 0x32, 0x36, 0x65E5, 0x3, 0x32, 0x37, 0x65E5, 0x3, 0x32, 0x38, 0x65E5,
+        0x3, 0x32, 0x39, 0x65E5, 0x3, 0x33, 0x30, 0x65E5, 0x3, 0x33, 0x31, 0x65E5,
+        0x3, 0x67, 0x61, 0x6C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x66, 0x66,
+        0x2, 0x66, 0x69, 0x2, 0x66, 0x6C, 0x3, 0x66, 0x66, 0x69, 0x3, 0x66,
+        0x66, 0x6C, 0x2, 0x73, 0x74, 0x2, 0x73, 0x74, 0x2, 0x574, 0x576, 0x2,
+        0x574, 0x565, 0x2, 0x574, 0x56B, 0x2, 0x57E, 0x576, 0x2, 0x574, 0x56D, 0x0,
+        0x2, 0x5D0, 0x5DC, 0x2, 0x6C7, 0x674, 0x2, 0x64A, 0x627, 0x2, 0x64A, 0x627,
+        0x2, 0x64A, 0x6D5, 0x2, 0x64A, 0x6D5, 0x2, 0x64A, 0x648, 0x2, 0x64A, 0x648,
+        0x2, 0x64A, 0x6C7, 0x2, 0x64A, 0x6C7, 0x2, 0x64A, 0x6C6, 0x2, 0x64A, 0x6C6,
+        0x2, 0x64A, 0x6C8, 0x2, 0x64A, 0x6C8, 0x2, 0x64A, 0x6D0, 0x2, 0x64A, 0x6D0,
+        0x2, 0x64A, 0x6D0, 0x2, 0x64A, 0x649, 0x2, 0x64A, 0x649, 0x2, 0x64A, 0x649,
+        0x2, 0x64A, 0x62C, 0x2, 0x64A, 0x62D, 0x2, 0x64A, 0x645, 0x2, 0x64A, 0x649,
+        0x2, 0x64A, 0x64A, 0x2, 0x628, 0x62C, 0x2, 0x628, 0x62D, 0x2, 0x628, 0x62E,
+        0x2, 0x628, 0x645, 0x2, 0x628, 0x649, 0x2, 0x628, 0x64A, 0x2, 0x62A, 0x62C,
+        0x2, 0x62A, 0x62D, 0x2, 0x62A, 0x62E, 0x2, 0x62A, 0x645, 0x2, 0x62A, 0x649,
+        0x2, 0x62A, 0x64A, 0x2, 0x62B, 0x62C, 0x2, 0x62B, 0x645, 0x2, 0x62B, 0x649,
+        0x2, 0x62B, 0x64A, 0x2, 0x62C, 0x62D, 0x2, 0x62C, 0x645, 0x2, 0x62D, 0x62C,
+        0x2, 0x62D, 0x645, 0x2, 0x62E, 0x62C, 0x2, 0x62E, 0x62D, 0x2, 0x62E, 0x645,
+        0x2, 0x633, 0x62C, 0x2, 0x633, 0x62D, 0x2, 0x633, 0x62E, 0x2, 0x633, 0x645,
+        0x2, 0x635, 0x62D, 0x2, 0x635, 0x645, 0x2, 0x636, 0x62C, 0x2, 0x636, 0x62D,
+        0x2, 0x636, 0x62E, 0x2, 0x636, 0x645, 0x2, 0x637, 0x62D, 0x2, 0x637, 0x645,
+        0x2, 0x638, 0x645, 0x2, 0x639, 0x62C, 0x2, 0x639, 0x645, 0x2, 0x63A, 0x62C,
+        0x2, 0x63A, 0x645, 0x2, 0x641, 0x62C, 0x2, 0x641, 0x62D, 0x2, 0x641, 0x62E,
+        0x2, 0x641, 0x645, 0x2, 0x641, 0x649, 0x2, 0x641, 0x64A, 0x2, 0x642, 0x62D,
+        0x2, 0x642, 0x645, 0x2, 0x642, 0x649, 0x2, 0x642, 0x64A, 0x2, 0x643, 0x627,
+        0x2, 0x643, 0x62C, 0x2, 0x643, 0x62D, 0x2, 0x643, 0x62E, 0x2, 0x643, 0x644,
+        0x2, 0x643, 0x645, 0x2, 0x643, 0x649, 0x2, 0x643, 0x64A, 0x2, 0x644, 0x62C,
+        0x2, 0x644, 0x62D, 0x2, 0x644, 0x62E, 0x2, 0x644, 0x645, 0x2, 0x644, 0x649,
+        0x2, 0x644, 0x64A, 0x2, 0x645, 0x62C, 0x2, 0x645, 0x62D, 0x2, 0x645, 0x62E,
+        0x2, 0x645, 0x645, 0x2, 0x645, 0x649, 0x2, 0x645, 0x64A, 0x2, 0x646, 0x62C,
+        0x2, 0x646, 0x62D, 0x2, 0x646, 0x62E, 0x2, 0x646, 0x645, 0x2, 0x646, 0x649,
+        0x2, 0x646, 0x64A, 0x2, 0x647, 0x62C, 0x2, 0x647, 0x645, 0x2, 0x647, 0x649,
+        0x2, 0x647, 0x64A, 0x2, 0x64A, 0x62C, 0x2, 0x64A, 0x62D, 0x2, 0x64A, 0x62E,
+        0x2, 0x64A, 0x645, 0x2, 0x64A, 0x649, 0x2, 0x64A, 0x64A, 0x2, 0x64A, 0x631,
+        0x2, 0x64A, 0x632, 0x2, 0x64A, 0x645, 0x2, 0x64A, 0x646, 0x2, 0x64A, 0x649,
+        0x2, 0x64A, 0x64A, 0x2, 0x628, 0x631, 0x2, 0x628, 0x632, 0x2, 0x628, 0x645,
+        0x2, 0x628, 0x646, 0x2, 0x628, 0x649, 0x2, 0x628, 0x64A, 0x2, 0x62A, 0x631,
+        0x2, 0x62A, 0x632, 0x2, 0x62A, 0x645, 0x2, 0x62A, 0x646, 0x2, 0x62A, 0x649,
+        0x2, 0x62A, 0x64A, 0x2, 0x62B, 0x631, 0x2, 0x62B, 0x632, 0x2, 0x62B, 0x645,
+        0x2, 0x62B, 0x646, 0x2, 0x62B, 0x649, 0x2, 0x62B, 0x64A, 0x2, 0x641, 0x649,
+        0x2, 0x641, 0x64A, 0x2, 0x642, 0x649, 0x2, 0x642, 0x64A, 0x2, 0x643, 0x627,
+        0x2, 0x643, 0x644, 0x2, 0x643, 0x645, 0x2, 0x643, 0x649, 0x2, 0x643, 0x64A,
+        0x2, 0x644, 0x645, 0x2, 0x644, 0x649, 0x2, 0x644, 0x64A, 0x2, 0x645, 0x627,
+        0x2, 0x645, 0x645, 0x2, 0x646, 0x631, 0x2, 0x646, 0x632, 0x2, 0x646, 0x645,
+        0x2, 0x646, 0x646, 0x2, 0x646, 0x649, 0x2, 0x646, 0x64A, 0x2, 0x64A, 0x631,
+        0x2, 0x64A, 0x632, 0x2, 0x64A, 0x645, 0x2, 0x64A, 0x646, 0x2, 0x64A, 0x649,
+        0x2, 0x64A, 0x64A, 0x2, 0x64A, 0x62C, 0x2, 0x64A, 0x62D, 0x2, 0x64A, 0x62E,
+        0x2, 0x64A, 0x645, 0x2, 0x64A, 0x647, 0x2, 0x628, 0x62C, 0x2, 0x628, 0x62D,
+        0x2, 0x628, 0x62E, 0x2, 0x628, 0x645, 0x2, 0x628, 0x647, 0x2, 0x62A, 0x62C,
+        0x2, 0x62A, 0x62D, 0x2, 0x62A, 0x62E, 0x2, 0x62A, 0x645, 0x2, 0x62A, 0x647,
+        0x2, 0x62B, 0x645, 0x2, 0x62C, 0x62D, 0x2, 0x62C, 0x645, 0x2, 0x62D, 0x62C,
+        0x2, 0x62D, 0x645, 0x2, 0x62E, 0x62C, 0x2, 0x62E, 0x645, 0x2, 0x633, 0x62C,
+        0x2, 0x633, 0x62D, 0x2, 0x633, 0x62E, 0x2, 0x633, 0x645, 0x2, 0x635, 0x62D,
+        0x2, 0x635, 0x62E, 0x2, 0x635, 0x645, 0x2, 0x636, 0x62C, 0x2, 0x636, 0x62D,
+        0x2, 0x636, 0x62E, 0x2, 0x636, 0x645, 0x2, 0x637, 0x62D, 0x2, 0x638, 0x645,
+        0x2, 0x639, 0x62C, 0x2, 0x639, 0x645, 0x2, 0x63A, 0x62C, 0x2, 0x63A, 0x645,
+        0x2, 0x641, 0x62C, 0x2, 0x641, 0x62D, 0x2, 0x641, 0x62E, 0x2, 0x641, 0x645,
+        0x2, 0x642, 0x62D, 0x2, 0x642, 0x645, 0x2, 0x643, 0x62C, 0x2, 0x643, 0x62D,
+        0x2, 0x643, 0x62E, 0x2, 0x643, 0x644, 0x2, 0x643, 0x645, 0x2, 0x644, 0x62C,
+        0x2, 0x644, 0x62D, 0x2, 0x644, 0x62E, 0x2, 0x644, 0x645, 0x2, 0x644, 0x647,
+        0x2, 0x645, 0x62C, 0x2, 0x645, 0x62D, 0x2, 0x645, 0x62E, 0x2, 0x645, 0x645,
+        0x2, 0x646, 0x62C, 0x2, 0x646, 0x62D, 0x2, 0x646, 0x62E, 0x2, 0x646, 0x645,
+        0x2, 0x646, 0x647, 0x2, 0x647, 0x62C, 0x2, 0x647, 0x645, 0x2, 0x64A, 0x62C,
+        0x2, 0x64A, 0x62D, 0x2, 0x64A, 0x62E, 0x2, 0x64A, 0x645, 0x2, 0x64A, 0x647,
+        0x2, 0x64A, 0x645, 0x2, 0x64A, 0x647, 0x2, 0x628, 0x645, 0x2, 0x628, 0x647,
+        0x2, 0x62A, 0x645, 0x2, 0x62A, 0x647, 0x2, 0x62B, 0x645, 0x2, 0x62B, 0x647,
+        0x2, 0x633, 0x645, 0x2, 0x633, 0x647, 0x2, 0x634, 0x645, 0x2, 0x634, 0x647,
+        0x2, 0x643, 0x644, 0x2, 0x643, 0x645, 0x2, 0x644, 0x645, 0x2, 0x646, 0x645,
+        0x2, 0x646, 0x647, 0x2, 0x64A, 0x645, 0x2, 0x64A, 0x647, 0x2, 0x637, 0x649,
+        0x2, 0x637, 0x64A, 0x2, 0x639, 0x649, 0x2, 0x639, 0x64A, 0x2, 0x63A, 0x649,
+        0x2, 0x63A, 0x64A, 0x2, 0x633, 0x649, 0x2, 0x633, 0x64A, 0x2, 0x634, 0x649,
+        0x2, 0x634, 0x64A, 0x2, 0x62D, 0x649, 0x2, 0x62D, 0x64A, 0x2, 0x62C, 0x649,
+        0x2, 0x62C, 0x64A, 0x2, 0x62E, 0x649, 0x2, 0x62E, 0x64A, 0x2, 0x635, 0x649,
+        0x2, 0x635, 0x64A, 0x2, 0x636, 0x649, 0x2, 0x636, 0x64A, 0x2, 0x634, 0x62C,
+        0x2, 0x634, 0x62D, 0x2, 0x634, 0x62E, 0x2, 0x634, 0x645, 0x2, 0x634, 0x631,
+        0x2, 0x633, 0x631, 0x2, 0x635, 0x631, 0x2, 0x636, 0x631, 0x2, 0x637, 0x649,
+        0x2, 0x637, 0x64A, 0x2, 0x639, 0x649, 0x2, 0x639, 0x64A, 0x2, 0x63A, 0x649,
+        0x2, 0x63A, 0x64A, 0x2, 0x633, 0x649, 0x2, 0x633, 0x64A, 0x2, 0x634, 0x649,
+        0x2, 0x634, 0x64A, 0x2, 0x62D, 0x649, 0x2, 0x62D, 0x64A, 0x2, 0x62C, 0x649,
+        0x2, 0x62C, 0x64A, 0x2, 0x62E, 0x649, 0x2, 0x62E, 0x64A, 0x2, 0x635, 0x649,
+        0x2, 0x635, 0x64A, 0x2, 0x636, 0x649, 0x2, 0x636, 0x64A, 0x2, 0x634, 0x62C,
+        0x2, 0x634, 0x62D, 0x2, 0x634, 0x62E, 0x2, 0x634, 0x645, 0x2, 0x634, 0x631,
+        0x2, 0x633, 0x631, 0x2, 0x635, 0x631, 0x2, 0x636, 0x631, 0x2, 0x634, 0x62C,
+        0x2, 0x634, 0x62D, 0x2, 0x634, 0x62E, 0x2, 0x634, 0x645, 0x2, 0x633, 0x647,
+        0x2, 0x634, 0x647, 0x2, 0x637, 0x645, 0x2, 0x633, 0x62C, 0x2, 0x633, 0x62D,
+        0x2, 0x633, 0x62E, 0x2, 0x634, 0x62C, 0x2, 0x634, 0x62D, 0x2, 0x634, 0x62E,
+        0x2, 0x637, 0x645, 0x2, 0x638, 0x645, 0x3, 0x62A, 0x62C, 0x645, 0x3, 0x62A,
+        0x62D, 0x62C, 0x3, 0x62A, 0x62D, 0x62C, 0x3, 0x62A, 0x62D, 0x645, 0x3, 0x62A,
+        0x62E, 0x645, 0x3, 0x62A, 0x645, 0x62C, 0x3, 0x62A, 0x645, 0x62D, 0x3, 0x62A,
+        0x645, 0x62E, 0x3, 0x62C, 0x645, 0x62D, 0x3, 0x62C, 0x645, 0x62D, 0x3, 0x62D,
+        0x645, 0x64A, 0x3, 0x62D, 0x645, 0x649, 0x3, 0x633, 0x62D, 0x62C, 0x3, 0x633,
+        0x62C, 0x62D, 0x3, 0x633, 0x62C, 0x649, 0x3, 0x633, 0x645, 0x62D, 0x3, 0x633,
+        0x645, 0x62D, 0x3, 0x633, 0x645, 0x62C, 0x3, 0x633, 0x645, 0x645, 0x3, 0x633,
+        0x645, 0x645, 0x3, 0x635, 0x62D, 0x62D, 0x3, 0x635, 0x62D, 0x62D, 0x3, 0x635,
+        0x645, 0x645, 0x3, 0x634, 0x62D, 0x645, 0x3, 0x634, 0x62D, 0x645, 0x3, 0x634,
+        0x62C, 0x64A, 0x3, 0x634, 0x645, 0x62E, 0x3, 0x634, 0x645, 0x62E, 0x3, 0x634,
+        0x645, 0x645, 0x3, 0x634, 0x645, 0x645, 0x3, 0x636, 0x62D, 0x649, 0x3, 0x636,
+        0x62E, 0x645, 0x3, 0x636, 0x62E, 0x645, 0x3, 0x637, 0x645, 0x62D, 0x3, 0x637,
+        0x645, 0x62D, 0x3, 0x637, 0x645, 0x645, 0x3, 0x637, 0x645, 0x64A, 0x3, 0x639,
+        0x62C, 0x645, 0x3, 0x639, 0x645, 0x645, 0x3, 0x639, 0x645, 0x645, 0x3, 0x639,
+        0x645, 0x649, 0x3, 0x63A, 0x645, 0x645, 0x3, 0x63A, 0x645, 0x64A, 0x3, 0x63A,
+        0x645, 0x649, 0x3, 0x641, 0x62E, 0x645, 0x3, 0x641, 0x62E, 0x645, 0x3, 0x642,
+        0x645, 0x62D, 0x3, 0x642, 0x645, 0x645, 0x3, 0x644, 0x62D, 0x645, 0x3, 0x644,
+        0x62D, 0x64A, 0x3, 0x644, 0x62D, 0x649, 0x3, 0x644, 0x62C, 0x62C, 0x3, 0x644,
+        0x62C, 0x62C, 0x3, 0x644, 0x62E, 0x645, 0x3, 0x644, 0x62E, 0x645, 0x3, 0x644,
+        0x645, 0x62D, 0x3, 0x644, 0x645, 0x62D, 0x3, 0x645, 0x62D, 0x62C, 0x3, 0x645,
+        0x62D, 0x645, 0x3, 0x645, 0x62D, 0x64A, 0x3, 0x645, 0x62C, 0x62D, 0x3, 0x645,
+        0x62C, 0x645, 0x3, 0x645, 0x62E, 0x62C, 0x3, 0x645, 0x62E, 0x645, 0x3, 0x645,
+        0x62C, 0x62E, 0x3, 0x647, 0x645, 0x62C, 0x3, 0x647, 0x645, 0x645, 0x3, 0x646,
+        0x62D, 0x645, 0x3, 0x646, 0x62D, 0x649, 0x3, 0x646, 0x62C, 0x645, 0x3, 0x646,
+        0x62C, 0x645, 0x3, 0x646, 0x62C, 0x649, 0x3, 0x646, 0x645, 0x64A, 0x3, 0x646,
+        0x645, 0x649, 0x3, 0x64A, 0x645, 0x645, 0x3, 0x64A, 0x645, 0x645, 0x3, 0x628,
+        0x62E, 0x64A, 0x3, 0x62A, 0x62C, 0x64A, 0x3, 0x62A, 0x62C, 0x649, 0x3, 0x62A,
+        0x62E, 0x64A, 0x3, 0x62A, 0x62E, 0x649, 0x3, 0x62A, 0x645, 0x64A, 0x3, 0x62A,
+        0x645, 0x649, 0x3, 0x62C, 0x645, 0x64A, 0x3, 0x62C, 0x62D, 0x649, 0x3, 0x62C,
+        0x645, 0x649, 0x3, 0x633, 0x62E, 0x649, 0x3, 0x635, 0x62D, 0x64A, 0x3, 0x634,
+        0x62D, 0x64A, 0x3, 0x636, 0x62D, 0x64A, 0x3, 0x644, 0x62C, 0x64A, 0x3, 0x644,
+        0x645, 0x64A, 0x3, 0x64A, 0x62D, 0x64A, 0x3, 0x64A, 0x62C, 0x64A, 0x3, 0x64A,
+        0x645, 0x64A, 0x3, 0x645, 0x645, 0x64A, 0x3, 0x642, 0x645, 0x64A, 0x3, 0x646,
+        0x62D, 0x64A, 0x3, 0x642, 0x645, 0x62D, 0x3, 0x644, 0x62D, 0x645, 0x3, 0x639,
+        0x645, 0x64A, 0x3, 0x643, 0x645, 0x64A, 0x3, 0x646, 0x62C, 0x62D, 0x3, 0x645,
+        0x62E, 0x64A, 0x3, 0x644, 0x62C, 0x645, 0x3, 0x643, 0x645, 0x645, 0x3, 0x644,
+        0x62C, 0x645, 0x3, 0x646, 0x62C, 0x62D, 0x3, 0x62C, 0x62D, 0x64A, 0x3, 0x62D,
+        0x62C, 0x64A, 0x3, 0x645, 0x62C, 0x64A, 0x3, 0x641, 0x645, 0x64A, 0x3, 0x628,
+        0x62D, 0x64A, 0x3, 0x643, 0x645, 0x645, 0x3, 0x639, 0x62C, 0x645, 0x3, 0x635,
+        0x645, 0x645, 0x3, 0x633, 0x62E, 0x64A, 0x3, 0x646, 0x62C, 0x64A, 0x3, 0x635,
+        0x644, 0x6D2, 0x3, 0x642, 0x644, 0x6D2, 0x4, 0x627, 0x644, 0x644, 0x647, 0x4,
+        0x627, 0x643, 0x628, 0x631, 0x4, 0x645, 0x62D, 0x645, 0x62F, 0x4, 0x635, 0x644,
+        0x639, 0x645, 0x4, 0x631, 0x633, 0x648, 0x644, 0x4, 0x639, 0x644, 0x64A, 0x647,
+        0x4, 0x648, 0x633, 0x644, 0x645, 0x3, 0x635, 0x644, 0x649, 0x12, 0x635, 0x644,
+        0x649, 0x0, 0x627, 0x644, 0x644, 0x647, 0x0, 0x639, 0x644, 0x64A, 0x647, 0x0,
+        0x648, 0x633, 0x644, 0x645, 0x8, 0x62C, 0x644, 0x0, 0x62C, 0x644, 0x627, 0x644,
+        0x647, 0x4, 0x631, 0x6CC, 0x627, 0x644, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x644,
+        0x627, 0x2, 0x644, 0x627, 0x2, 0x644, 0x627, 0x2, 0x644, 0x627, 0x2, 0x644,
+        0x627, 0x2, 0x644, 0x627, 0x2, 0x644, 0x627, 0x2, 0x644, 0x627, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+        0x0, 0x2, 0x30, 0x0, 0x2, 0x30, 0x0, 0x2, 0x31, 0x0, 0x2, 0x32,
+        0x0, 0x2, 0x33, 0x0, 0x2, 0x34, 0x0, 0x2, 0x35, 0x0, 0x2, 0x36,
+        0x0, 0x2, 0x37, 0x0, 0x2, 0x38, 0x0, 0x2, 0x39, 0x0, 0x3, 0x0,
+        0x61, 0x0, 0x3, 0x0, 0x62, 0x0, 0x3, 0x0, 0x63, 0x0, 0x3, 0x0,
+        0x64, 0x0, 0x3, 0x0, 0x65, 0x0, 0x3, 0x0, 0x66, 0x0, 0x3, 0x0,
+        0x67, 0x0, 0x3, 0x0, 0x68, 0x0, 0x3, 0x0, 0x69, 0x0, 0x3, 0x0,
+        0x6A, 0x0, 0x3, 0x0, 0x6B, 0x0, 0x3, 0x0, 0x6C, 0x0, 0x3, 0x0,
+        0x6D, 0x0, 0x3, 0x0, 0x6E, 0x0, 0x3, 0x0, 0x6F, 0x0, 0x3, 0x0,
+        0x70, 0x0, 0x3, 0x0, 0x71, 0x0, 0x3, 0x0, 0x72, 0x0, 0x3, 0x0,
+        0x73, 0x0, 0x3, 0x0, 0x74, 0x0, 0x3, 0x0, 0x75, 0x0, 0x3, 0x0,
+        0x76, 0x0, 0x3, 0x0, 0x77, 0x0, 0x3, 0x0, 0x78, 0x0, 0x3, 0x0,
+        0x79, 0x0, 0x3, 0x0, 0x7A, 0x0, 0x3, 0x0, 0x73, 0x0, 0x2, 0x63,
+        0x64, 0x2, 0x77, 0x7A, 0x2, 0x68, 0x76, 0x2, 0x6D, 0x76, 0x2, 0x73,
+        0x64, 0x2, 0x73, 0x73, 0x3, 0x70, 0x70, 0x76, 0x2, 0x77, 0x63, 0x2,
+        0x6D, 0x63, 0x2, 0x6D, 0x64, 0x2, 0x6D, 0x72, 0x2, 0x64, 0x6A, 0x2,
+        0x307B, 0x304B, 0x2, 0x30B3, 0x30B3, 0x3, 0x0, 0x672C, 0x0, 0x3, 0x0, 0x4E09,
+        0x0, 0x3, 0x0, 0x4E8C, 0x0, 0x3, 0x0, 0x5B89, 0x0, 0x3, 0x0, 0x70B9,
+        0x0, 0x3, 0x0, 0x6253, 0x0, 0x3, 0x0, 0x76D7, 0x0, 0x3, 0x0, 0x52DD,
+        0x0, 0x3, 0x0, 0x6557, 0x0,
+    };
+};
@@ -1,17 +1,34 @@
 #include <iostream>
 #include <cstdlib>
 #include <fstream>
+#include <sstream>
 #include <experimental/filesystem>
 #include <vector>
 #include <string>
 #include <map>
 #include <unordered_map>
 #include <algorithm>
+#include <queue>
 #include <ctime>
 #include <cassert>
+#include <cctype>
+#include <cstring>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cerrno>
+#include <limits>
 
 #include "../codec.h"
 #include "../index_jumps.h"
+#include "../index_manifest.h"
+#include "../token_map.h"
+#include "../index_biwords.h"
+#include "index_files.h"
+#include "reorder.h"
+#include "doc_source.h"
+#include "tokenizer.h"
 
 
 time_t START_TIME;
@@ -19,29 +36,15 @@ time_t START_TIME;
 #define TIMING(s) START_TIME = time(0); s; std::cout << "* Done. Time: " << (time(0) - START_TIME) << " s" << endl;
 
 
-const size_t MAX_BLOCK_SIZE = 10000000;
-const size_t MAX_INDEX_BLOCK_SIZE = 100000;
-const size_t MAX_POS_FILES_PER_DIR = 5000;
-const size_t DOCS_PER_FILE = 10;
+const size_t DEFAULT_MEMORY_LIMIT = 1ULL << 30;
+// Runs merged at once, more are merged in several passes
+const size_t MAX_MERGE_FAN_IN = 64;
 
 
 using namespace std;
 
 namespace fs = std::experimental::filesystem;
 
-using TID = unsigned int;
-
-
-const string TF_FILE_PATH = "/tf";
-const string TF_OFFSET_FILE_PATH = "/tf_offsets";
-const string POSITIONS_DIR_PATH = "/positions/";
-
-
-vector<int8_t> compressedDataBuffer_4bit;
-vector<int8_t> compressedDataBuffer_8bit;
-vector<int16_t> compressedDataBuffer_16bit;
-vector<TID> jumpedDataBuffer;
-
 
 void systemNoReturn(const char* s) {
     int res = system(s);
@@ -52,206 +55,682 @@ void systemNoReturn(const char* s) {
 }
 
 
+FILE* openFile(const string &fileName, const char *mode) {
+    FILE *f = fopen(fileName.c_str(), mode);
+    if (f == NULL) {
+        cerr << "ERROR: Can't open '" << fileName << "': " << strerror(errno) << endl;
+        exit(1);
+    }
+    return f;
+}
+
+
 void print_help() {
     cout << "specify parameters:\n"; 
     cout << "output_directory" << endl;
     cout << "file with uniq tokens" << endl;
     cout << "file with terms" << endl;
+    cout << "  (both are omitted with --token-map)" << endl;
     cout << "paths to directories with docs" << endl;
+    cout << "options (anywhere):" << endl;
+    cout << "--input=tokens|dump\tdocs are files of text_cleaner tokens or raw <doc> dumps tokenized on the fly, tokens by default" << endl;
+    cout << "--threads=N\tnumber of document processing and index encoding threads, all cores by default" << endl;
+    cout << "--memory-limit=N[K|M|G]\tmemory for postings before spilling them to disk, at least 1M, 1G by default" << endl;
+    cout << "--reorder=none|title|bisection\tdoc ids order: traversal, by title from --meta or the dumps, or by graph bisection, which keeps the terms of all documents in memory" << endl;
+    cout << "--token-map=FILE\ttoken to term map of make_token_map instead of the token and term lists" << endl;
+    cout << "--biwords=FILE\tpairs of words, one per line like findCollocations prints them, that get postings of their own" << endl;
+    cout << "--meta=FILE\tmeta file of text_cleaner with the titles" << endl;
 }
 
 
-void initTokensTerms(
-    const string &tokensFile, 
-    const string &termsFile, 
-    unordered_map<string, TID> &tokenToTermId, 
-    vector<string> &terms) 
-{
-    TID nextTermId = 0;
-    unordered_map<string, TID> termsId;
+/* Removes '--name=value' arguments from argv and returns them */
+map<string, string> parseOptions(int &argc, char *argv[]) {
+    map<string, string> options;
+    int n = 0;
+    for (int i = 0; i < argc; i++) {
+        string arg(argv[i]);
+        if (i > 0 && arg.compare(0, 2, "--") == 0) {
+            size_t eq = arg.find('=');
+            options[arg.substr(2, eq == string::npos ? string::npos : eq - 2)] =
+                eq == string::npos ? "" : arg.substr(eq + 1);
+        } else {
+            argv[n++] = argv[i];
+        }
+    }
+    argc = n;
+    return options;
+}
 
-    ifstream finTokens(tokensFile);
-    ifstream finTerms(termsFile);
 
-    string token;
-    string term;
+/* Size like '512M' in bytes, 0 if it can't be parsed */
+size_t parseSize(const string &s) {
+    size_t pos;
+    size_t size;
+    try {
+        size = stoull(s, &pos);
+    } catch (...) {
+        return 0;
+    }
 
-    while (!finTokens.eof() && !finTerms.eof()) {
-        finTokens >> token;
-        finTerms >> term;
+    string suffix = s.substr(pos);
+    if (suffix == "K" || suffix == "k") return size << 10;
+    if (suffix == "M" || suffix == "m") return size << 20;
+    if (suffix == "G" || suffix == "g") return size << 30;
+    return suffix.empty() ? size : 0;
+}
 
-        auto iter = termsId.find(term);
 
-        if (iter == termsId.end()) {
-            termsId[term] = nextTermId;
-            terms.push_back(term);
-            tokenToTermId[token] = nextTermId;
-            nextTermId++;
-        } else {
-            tokenToTermId[token] = iter->second;
-        }
+/* Token map of make_token_map, or compiled in memory from the token and term lists */
+bool loadTokenMap(const string &mapFile, const string &tokensFile, const string &termsFile, TokenMap &tokenMap) {
+    if (!mapFile.empty()) {
+        return tokenMap.open(mapFile);
     }
 
-    if (finTokens.eof() && !finTerms.eof()) {
-        cerr << termsFile << " is bigger than " << tokensFile << " but should be equal" << endl;
-        string s;
-        finTerms >> s;
-        cerr << "Next term '" << s << "' size = " << s.size() << endl;
-    } else if (!finTokens.eof() && finTerms.eof()) {
-        cerr << tokensFile << " is bigger than " << termsFile << " but should be equal" << endl;
-        string s;
-        finTokens >> s;
-        cerr << "Next token '" << s << "' size = " << s.size() << endl;
-    }
+    vector<pair<string, TID>> tokens;
+    vector<string> terms;
+    if (!TokenMap::readText(tokensFile, termsFile, tokens, terms)) return false;
 
-    finTerms.close();
-    finTokens.close();
+    vector<char> data;
+    return TokenMap::build(tokens, terms, data) && tokenMap.assign(move(data));
 }
 
 
-void writeRecords(vector<pair<TID, TID>> &records, const string &outputFile) {
-    sort(records.begin(), records.end());
-
-    size_t cnt = 1;
-    ofstream fout(outputFile);
-    fout << records.front().first << ' ' << records.front().second << '\n';
-    auto prev = records.front();
+/* Biwords of --biwords, ids go after the terms */
+struct BiwordTable {
+    TID firstId;
+    vector<pair<TID, TID>> pairs;
+    unordered_map<uint64_t, TID> ids;
 
-    for (auto &it : records) {
-        if (it != prev) {
-            fout << it.first << ' ' << it.second << '\n';
-            prev = it;
-            cnt++;
-        }
+    TID find(TID a, TID b) const {
+        auto it = ids.find(Biwords::key(a, b));
+        return it == ids.end() ? TokenMap::NO_TERM : it->second;
     }
+};
 
-    fout.close();
-    cout << "Wrote " << cnt << " records to " << outputFile << endl;
+
+/* Lines of two words of the dictionary, other lines are skipped, so the output of findCollocations is taken as is */
+void loadBiwords(const string &fileName, const TokenMap &tokenMap, BiwordTable &biwords) {
+    biwords.firstId = tokenMap.termsNum();
+
+    ifstream fin(fileName);
+    string line;
+    while (getline(fin, line)) {
+        stringstream ss(line);
+        string a, b, rest;
+        if (!(ss >> a >> b) || (ss >> rest)) continue;
+
+        TID termA = tokenMap.find(a);
+        TID termB = tokenMap.find(b);
+        if (termA == TokenMap::NO_TERM || termB == TokenMap::NO_TERM) continue;
+
+        uint64_t key = Biwords::key(termA, termB);
+        if (biwords.ids.count(key)) continue;
+
+        biwords.ids[key] = biwords.firstId + biwords.pairs.size();
+        biwords.pairs.emplace_back(termA, termB);
+    }
 }
 
 
-void writePositions(TID docId, map<TID, vector<unsigned int>> &positions, const string &fileName) {
-    ofstream fout(fileName, ios_base::binary | ios_base::app);
-    fout.write((char*)&docId, sizeof(TID));
+/* Occurrences of terms in the document as (term id, position), sorted */
+using TOccurrences = vector<pair<TID, unsigned int>>;
 
-    unsigned int n;
 
-    n = positions.size();
-    fout.write((char*)&n, sizeof(unsigned int));
+/* Record of the document in the positions file, positions are written as gaps */
+void encodePositions(TID docId, const TOccurrences &occurrences, vector<char> &out) {
+    vector<int8_t> buffer_4bit;
+    vector<int8_t> buffer_8bit;
+    vector<unsigned int> v;
 
-    for (auto &i : positions) {
-        fout.write((char*)&i.first, sizeof(TID));
+    appendBytes(out, &docId, 1);
 
-        auto &v = i.second;
+    unsigned int n = 0;
+    for (size_t i = 0; i < occurrences.size(); i++) {
+        if (i == 0 || occurrences[i].first != occurrences[i - 1].first) n++;
+    }
+    appendBytes(out, &n, 1);
+
+    for (size_t i = 0; i < occurrences.size();) {
+        TID termId = occurrences[i].first;
+        appendBytes(out, &termId, 1);
 
-        unsigned int prev = v[0];
-        for (unsigned int j = 1; j < v.size(); j++) {
-            v[j] = v[j] - prev;
-            prev += v[j];
+        v.clear();
+        unsigned int prev = 0;
+        for (; i < occurrences.size() && occurrences[i].first == termId; i++) {
+            v.push_back(occurrences[i].second - prev);
+            prev = occurrences[i].second;
         }
 
-        compressedDataBuffer_4bit.clear();
-        unsigned int n4 = VHB<unsigned int, int8_t>::encode(v, compressedDataBuffer_4bit);
+        buffer_4bit.clear();
+        unsigned int n4 = VHB<unsigned int, int8_t>::encode(v, buffer_4bit);
         assert(n4 <= (1 << (sizeof(unsigned int) * 8 - 2)));
         n4 |= 1 << (sizeof(unsigned int) * 8 - 1);
 
-        compressedDataBuffer_8bit.clear();
-        unsigned int n8 = VB<unsigned int, int8_t>::encode(v, compressedDataBuffer_8bit);
+        buffer_8bit.clear();
+        unsigned int n8 = VB<unsigned int, int8_t>::encode(v, buffer_8bit);
         assert(n8 <= (1 << (sizeof(unsigned int) * 8 - 2)));
 
-        if (compressedDataBuffer_8bit.size() <= compressedDataBuffer_4bit.size()) {
-            fout.write((char*)&n8, sizeof(unsigned int));
-            fout.write(
-                (char*)compressedDataBuffer_8bit.data(), 
-                compressedDataBuffer_8bit.size() * sizeof(int8_t));
+        if (buffer_8bit.size() <= buffer_4bit.size()) {
+            appendBytes(out, &n8, 1);
+            appendBytes(out, buffer_8bit.data(), buffer_8bit.size());
         } else {
-            fout.write((char*)&n4, sizeof(unsigned int));
-            fout.write(
-                (char*)compressedDataBuffer_4bit.data(), 
-                compressedDataBuffer_4bit.size() * sizeof(int8_t));
+            appendBytes(out, &n4, 1);
+            appendBytes(out, buffer_4bit.data(), buffer_4bit.size());
         }
     }
-    fout.close();
 }
 
 
-void writeTF(
-    map<TID, vector<unsigned int>> &positions, 
-    unsigned int &curTFOffset, 
-    ofstream &foutTFOffsets, 
-    ofstream &foutTF)
+/* (term id, term frequency) pairs of the document */
+void encodeTF(const TOccurrences &occurrences, vector<char> &out) {
+    vector<TID> v;
+    for (size_t i = 0; i < occurrences.size(); i++) {
+        if (i == 0 || occurrences[i].first != occurrences[i - 1].first) {
+            v.push_back(occurrences[i].first);
+            v.push_back(0);
+        }
+        v.back()++;
+    }
+
+    vector<int8_t> buffer_8bit;
+    VB<unsigned int, int8_t>::encode(v, buffer_8bit);
+    appendBytes(out, buffer_8bit.data(), buffer_8bit.size());
+}
+
+
+/*
+ * Byte storage of the inverter. Postings of a term are a chain of slices
+ * inside BLOCK_SIZE blocks, every next slice of a term is twice bigger up
+ * to MAX_SLICE_SIZE and the pointer to it is stored after the previous one.
+ * Blocks are kept after reset, so used() is what the inverter really holds.
+ */
+class PostingArena {
+public:
+    static const size_t BLOCK_SIZE = 1 << 20;
+private:
+    static const size_t FIRST_SLICE_SIZE = 8;
+    static const size_t MAX_SLICE_SIZE = 1 << 12;
+
+    vector<int8_t*> blocks;
+    uint64_t top;
+
+    int8_t* at(uint64_t offset) {
+        return blocks[offset / BLOCK_SIZE] + offset % BLOCK_SIZE;
+    }
+
+    uint64_t allocate(size_t size) {
+        if (top % BLOCK_SIZE + size > BLOCK_SIZE) {
+            top = (top / BLOCK_SIZE + 1) * BLOCK_SIZE;
+        }
+        if (top / BLOCK_SIZE == blocks.size()) {
+            blocks.push_back(new int8_t[BLOCK_SIZE]);
+        }
+        uint64_t offset = top;
+        top += size;
+        return offset;
+    }
+public:
+    struct Slices {
+        uint64_t head;
+        uint64_t tail;
+        uint64_t sliceEnd;
+        size_t sliceSize;
+        size_t size;
+    };
+
+    PostingArena() : top(0) {}
+
+    ~PostingArena() {
+        for (auto b : blocks) delete[] b;
+    }
+
+    void init(Slices &s) {
+        s.sliceSize = FIRST_SLICE_SIZE;
+        s.head = s.tail = allocate(s.sliceSize + sizeof(uint64_t));
+        s.sliceEnd = s.head + s.sliceSize;
+        s.size = 0;
+    }
+
+    void append(Slices &s, const int8_t *data, size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            if (s.tail == s.sliceEnd) {
+                size_t size = min(s.sliceSize * 2, MAX_SLICE_SIZE);
+                uint64_t next = allocate(size + sizeof(uint64_t));
+                memcpy(at(s.sliceEnd), &next, sizeof(uint64_t));
+                s.tail = next;
+                s.sliceEnd = next + size;
+                s.sliceSize = size;
+            }
+            *at(s.tail++) = data[i];
+        }
+        s.size += n;
+    }
+
+    void read(const Slices &s, vector<int8_t> &out) {
+        uint64_t cur = s.head;
+        size_t sliceSize = FIRST_SLICE_SIZE;
+        size_t left = s.size;
+        while (left > 0) {
+            size_t n = min(sliceSize, left);
+            out.insert(out.end(), at(cur), at(cur) + n);
+            left -= n;
+            if (left > 0) {
+                memcpy(&cur, at(cur + sliceSize), sizeof(uint64_t));
+                sliceSize = min(sliceSize * 2, MAX_SLICE_SIZE);
+            }
+        }
+    }
+
+    void reset() {
+        top = 0;
+    }
+
+    size_t used() {
+        return top;
+    }
+};
+
+
+/*
+ * In-memory inversion: doc ids of every term are appended as VB encoded
+ * gaps to the arena slices of the term. When the arena and the term table
+ * take memoryLimit bytes they are flushed to a binary run file, runs are
+ * merged by buildIndex.
+ *
+ * Run file: terms number, then for every term with postings
+ * term id, postings number, encoded size in bytes, encoded gaps.
+ */
+class Inverter {
+private:
+    static const unsigned int NO_SLOT = -1;
+
+    struct TermPostings {
+        PostingArena::Slices slices;
+        TID lastDocId;
+        unsigned int length;
+    };
+
+    string outputDir;
+    size_t memoryLimit;
+
+    PostingArena arena;
+    vector<unsigned int> slot;
+    vector<TermPostings> postings;
+    vector<string> runs;
+    vector<TID> gap;
+    vector<int8_t> buffer;
+
+    size_t used() {
+        return arena.used() + postings.capacity() * sizeof(TermPostings) + slot.size() * sizeof(unsigned int);
+    }
+
+    void flush() {
+        string fileName = outputDir + "/run_" + to_string(runs.size());
+        FILE *fout = openFile(fileName, "wb");
+
+        unsigned int n = postings.size();
+        fwrite(&n, sizeof(unsigned int), 1, fout);
+
+        size_t usedBytes = used();
+
+        for (TID termId = 0; termId < slot.size(); termId++) {
+            if (slot[termId] == NO_SLOT) continue;
+            auto &p = postings[slot[termId]];
+            slot[termId] = NO_SLOT;
+
+            buffer.clear();
+            arena.read(p.slices, buffer);
+
+            unsigned int bytes = buffer.size();
+            fwrite(&termId, sizeof(TID), 1, fout);
+            fwrite(&p.length, sizeof(unsigned int), 1, fout);
+            fwrite(&bytes, sizeof(unsigned int), 1, fout);
+            fwrite(buffer.data(), sizeof(int8_t), bytes, fout);
+        }
+
+        fclose(fout);
+        cout << "Wrote " << n << " terms to " << fileName << ", used " << (usedBytes >> 20) << " MB" << endl;
+
+        runs.push_back(fileName);
+        postings.clear();
+        arena.reset();
+    }
+public:
+    Inverter(const string &outputDir, size_t termsNum, size_t memoryLimit) :
+        outputDir(outputDir), memoryLimit(memoryLimit), slot(termsNum, NO_SLOT), gap(1) {}
+
+    void add(TID termId, TID docId) {
+        if (slot[termId] == NO_SLOT) {
+            slot[termId] = postings.size();
+            postings.emplace_back();
+            arena.init(postings.back().slices);
+            postings.back().length = 0;
+        }
+        auto &p = postings[slot[termId]];
+
+        gap[0] = p.length == 0 ? docId : docId - p.lastDocId;
+        buffer.clear();
+        VB<TID, int8_t>::encode(gap, buffer);
+        arena.append(p.slices, buffer.data(), buffer.size());
+
+        p.lastDocId = docId;
+        p.length++;
+    }
+
+    void endDocument() {
+        if (used() >= memoryLimit) {
+            flush();
+        }
+    }
+
+    vector<string> finish() {
+        if (!postings.empty() || runs.empty()) {
+            flush();
+        }
+        slot.clear();
+        slot.shrink_to_fit();
+        postings.shrink_to_fit();
+        return runs;
+    }
+};
+
+
+/* Document prepared by a worker, everything but the inversion is encoded */
+struct ParsedDocument {
+    string name;
+    vector<TID> terms;
+    vector<char> positions;
+    vector<char> tf;
+};
+
+
+/* Terms of the document with their positions, sorted */
+void readOccurrences(
+    const DocSource &source,
+    const TokenMap &tokenMap,
+    TOccurrences &occurrences,
+    bool verbose)
 {
-    foutTFOffsets.write((char*)&curTFOffset, sizeof(unsigned int));
+    string text;
+    source.read(text);
 
-    vector<TID> v;
-    for (auto &p : positions) {
-        v.push_back(p.first);
-        v.push_back(p.second.size());
+    occurrences.clear();
+    unsigned int curPos = 0;
+
+    auto addToken = [&](const string &token) {
+        TID termId = tokenMap.find(token);
+        if (termId == TokenMap::NO_TERM) {
+            if (verbose) {
+                cerr << "ERROR: Token '" << token << "' from document '" << source.name << "' not in the dictinonary." << endl;
+            }
+            return;
+        }
+
+        occurrences.emplace_back(termId, curPos++);
+    };
+
+    if (source.raw()) {
+        Tokenizer tokenizer;
+        tokenizer.tokenize(text.data(), text.size(), addToken);
+    } else {
+        string token;
+        size_t i = 0;
+        while (i < text.size()) {
+            while (i < text.size() && isspace((unsigned char)text[i])) i++;
+            size_t start = i;
+            while (i < text.size() && !isspace((unsigned char)text[i])) i++;
+            if (start == i) break;
+
+            token.assign(text, start, i - start);
+            addToken(token);
+        }
     }
 
-    compressedDataBuffer_8bit.clear();
-    VB<unsigned int, int8_t>::encode(v, compressedDataBuffer_8bit);
-    curTFOffset += compressedDataBuffer_8bit.size();
-    foutTF.write(
-        (char*)compressedDataBuffer_8bit.data(), 
-        sizeof(int8_t) * compressedDataBuffer_8bit.size());
+    sort(occurrences.begin(), occurrences.end());
 }
 
 
-void processDocuments(
-    char *paths[], 
-    int pathsNum, 
-    const string &outputDir, 
-    const unordered_map<string, TID> &tokenToTermId, 
-    vector<string> &documents)
+/* Biwords of the adjacent terms as occurrences without positions, sorted */
+void findBiwords(const TOccurrences &occurrences, const BiwordTable &biwords, TOccurrences &found) {
+    vector<TID> termAt(occurrences.size());
+    for (auto &o : occurrences) {
+        termAt[o.second] = o.first;
+    }
+
+    found.clear();
+    for (size_t i = 1; i < termAt.size(); i++) {
+        TID biwordId = biwords.find(termAt[i - 1], termAt[i]);
+        if (biwordId != TokenMap::NO_TERM) {
+            found.emplace_back(biwordId, 0);
+        }
+    }
+    sort(found.begin(), found.end());
+}
+
+
+void parseDocument(
+    TID docId,
+    const DocSource &source,
+    const TokenMap &tokenMap,
+    const BiwordTable &biwords,
+    ParsedDocument &doc)
 {
-    string token;
-    TID curDocId = 0;
+    TOccurrences occurrences;
+    readOccurrences(source, tokenMap, occurrences, true);
 
-    vector<pair<TID, TID>> records;
+    doc.name = source.name;
 
-    int curOutputFileNum = 0;
-    string positionsDir = outputDir + POSITIONS_DIR_PATH;
+    doc.positions.clear();
+    encodePositions(docId, occurrences, doc.positions);
+
+    // Biword ids are bigger than term ids, so they go to the end of both lists
+    if (!biwords.pairs.empty()) {
+        TOccurrences found;
+        findBiwords(occurrences, biwords, found);
+        occurrences.insert(occurrences.end(), found.begin(), found.end());
+    }
+
+    doc.terms.clear();
+    for (auto &o : occurrences) {
+        if (doc.terms.empty() || doc.terms.back() != o.first) {
+            doc.terms.push_back(o.first);
+        }
+    }
+
+    doc.tf.clear();
+    encodeTF(occurrences, doc.tf);
+}
 
-    ofstream foutTF(outputDir + TF_FILE_PATH);
-    ofstream foutTFOffsets(outputDir + TF_OFFSET_FILE_PATH);
-    unsigned int curTFOffset = 0;
 
+/* Every file is a document, or every <doc> of the files if they are dumps */
+vector<DocSource> listDocuments(char *paths[], int pathsNum, bool dump) {
+    vector<DocSource> docs;
     for (int i = 0; i < pathsNum; i++) {
         for (auto& p: fs::recursive_directory_iterator(paths[i])) {
             if (fs::is_directory(p)) continue;
+            if (dump) {
+                Dump::scan(p.path().string(), docs);
+            } else {
+                DocSource doc;
+                doc.path = p.path().string();
+                doc.offset = 0;
+                doc.size = DocSource::WHOLE_FILE;
+                doc.name = p.path().filename().string();
+                docs.push_back(doc);
+            }
+        }
+    }
+    return docs;
+}
 
-            ifstream fin(p.path());
 
-            map<TID, vector<unsigned int>> positions;
-            unsigned int curPos = 0;
+/*
+ * Document names become external ids, so they must be numbers that fit
+ * into TID. Checked right after listing, not after the whole build.
+ */
+bool checkDocumentNames(const vector<DocSource> &docs) {
+    for (auto &d : docs) {
+        char *end;
+        errno = 0;
+        unsigned long long id = strtoull(d.name.c_str(), &end, 10);
+        if (d.name.empty() || !isdigit((unsigned char)d.name[0]) || *end != '\0'
+            || errno != 0 || id > numeric_limits<TID>::max()) {
+            cerr << "ERROR: Document name '" << d.name << "' of '" << d.path << "' is not a numeric id" << endl;
+            return false;
+        }
+    }
+    return true;
+}
 
-            while (!fin.eof()) {
-                fin >> token;
 
-                auto it = tokenToTermId.find(token);
-                if (it == tokenToTermId.end()) {
-                    cerr << "ERROR: Token '" << token << "' from file '" << p << "' not in the dictinonary." << endl;
-                    continue;
+/*
+ * Documents are ordered by recursive graph bisection of the term-document
+ * graph. Terms of one document can't make gaps smaller and are ignored.
+ */
+void reorderByBisection(
+    vector<DocSource> &files,
+    const TokenMap &tokenMap,
+    size_t termsNum,
+    unsigned int threadsNum)
+{
+    vector<vector<TID>> docTerms(files.size());
+    atomic<size_t> nextFile(0);
+
+    vector<thread> workers;
+    for (unsigned int t = 0; t < threadsNum; t++) {
+        workers.emplace_back([&]() {
+            TOccurrences occurrences;
+            size_t i;
+            while ((i = nextFile++) < files.size()) {
+                readOccurrences(files[i], tokenMap, occurrences, false);
+                for (auto &o : occurrences) {
+                    if (docTerms[i].empty() || docTerms[i].back() != o.first) {
+                        docTerms[i].push_back(o.first);
+                    }
                 }
+            }
+        });
+    }
+    for (auto &t : workers) {
+        t.join();
+    }
 
-                positions[it->second].push_back(curPos++);
-                records.push_back({it->second, curDocId});
+    vector<unsigned int> df(termsNum, 0);
+    for (auto &terms : docTerms) {
+        for (TID t : terms) df[t]++;
+    }
+    for (auto &terms : docTerms) {
+        terms.erase(remove_if(terms.begin(), terms.end(), [&](TID t) { return df[t] < 2; }), terms.end());
+    }
 
-                if (records.size() == MAX_BLOCK_SIZE) {
-                    string fileName = outputDir + '/' + to_string(curOutputFileNum);
-                    writeRecords(records, fileName);
-                    records.clear();
-                    curOutputFileNum++;
-                }
+    vector<size_t> order = Reorder::Bisection(docTerms, termsNum, threadsNum).order();
+
+    vector<DocSource> reordered;
+    for (size_t i : order) {
+        reordered.push_back(files[i]);
+    }
+    files.swap(reordered);
+}
+
+
+/* Titles are taken from the meta file if it's given, from the dumps otherwise */
+void reorderByTitle(vector<DocSource> &files, const string &metaFile) {
+    vector<string> names;
+    for (auto &f : files) {
+        names.push_back(f.name);
+    }
+
+    unordered_map<string, string> titles;
+    if (metaFile.empty()) {
+        for (auto &f : files) {
+            titles[f.name] = f.title;
+        }
+    } else {
+        titles = Reorder::readTitles(metaFile);
+    }
+
+    vector<size_t> order = Reorder::byTitle(names, titles);
+
+    vector<DocSource> reordered;
+    for (size_t i : order) {
+        reordered.push_back(files[i]);
+    }
+    files.swap(reordered);
+}
+
+
+/*
+ * Workers read, tokenize and encode documents in parallel, the caller thread
+ * writes them in the order of files, so the doc id of a file is its number
+ * in the list and the output doesn't depend on threadsNum.
+ */
+void processDocuments(
+    const vector<DocSource> &files,
+    const string &outputDir, 
+    const TokenMap &tokenMap, 
+    const BiwordTable &biwords,
+    vector<string> &documents,
+    Inverter &inverter,
+    unsigned int threadsNum)
+{
+    const size_t window = threadsNum * 16;
+    vector<ParsedDocument> slots(window);
+    vector<bool> ready(window, false);
+    size_t nextFile = 0;
+    size_t written = 0;
+    mutex m;
+    condition_variable slotFree;
+    condition_variable slotReady;
+
+    auto worker = [&]() {
+        ParsedDocument doc;
+        while (true) {
+            size_t i;
+            {
+                unique_lock<mutex> lock(m);
+                if (nextFile == files.size()) return;
+                i = nextFile++;
+                slotFree.wait(lock, [&]() { return i < written + window; });
+            }
+
+            parseDocument(i, files[i], tokenMap, biwords, doc);
+
+            {
+                lock_guard<mutex> lock(m);
+                swap(slots[i % window], doc);
+                ready[i % window] = true;
             }
+            slotReady.notify_all();
+        }
+    };
+
+    vector<thread> workers;
+    for (unsigned int i = 0; i < threadsNum; i++) {
+        workers.emplace_back(worker);
+    }
 
-            fin.close();
+    string positionsDir = outputDir + POSITIONS_DIR_PATH;
+
+    ofstream foutTF(outputDir + TF_FILE_PATH);
+    ofstream foutTFOffsets(outputDir + TF_OFFSET_FILE_PATH);
+    unsigned int curTFOffset = 0;
+
+    ofstream foutPositions;
+    ParsedDocument doc;
+
+    for (TID curDocId = 0; curDocId < files.size(); curDocId++) {
+        {
+            unique_lock<mutex> lock(m);
+            slotReady.wait(lock, [&]() { return ready[curDocId % window]; });
+            swap(slots[curDocId % window], doc);
+            ready[curDocId % window] = false;
+            written++;
+        }
+        slotFree.notify_all();
 
-            string spath(p.path());
-            int pos = spath.find_last_of('/');
-            documents.push_back(spath.substr(pos + 1));
+        documents.push_back(doc.name);
 
+        if (curDocId % DOCS_PER_FILE == 0) {
             TID curPosFileNum = curDocId / DOCS_PER_FILE;
             string curPosFile = positionsDir + to_string(curPosFileNum / MAX_POS_FILES_PER_DIR);
             if (curDocId % (MAX_POS_FILES_PER_DIR * DOCS_PER_FILE) == 0) {
@@ -259,22 +738,31 @@ void processDocuments(
             }
             curPosFile += "/" + to_string(curPosFileNum);
 
-            writePositions(curDocId, positions, curPosFile);
-            writeTF(positions, curTFOffset, foutTFOffsets, foutTF);
+            foutPositions.close();
+            foutPositions.open(curPosFile, ios_base::binary | ios_base::app);
+        }
 
-            curDocId++;
+        for (TID termId : doc.terms) {
+            inverter.add(termId, curDocId);
         }
+        inverter.endDocument();
+
+        foutPositions.write(doc.positions.data(), doc.positions.size());
+
+        foutTFOffsets.write((char*)&curTFOffset, sizeof(unsigned int));
+        foutTF.write(doc.tf.data(), doc.tf.size());
+        curTFOffset += doc.tf.size();
+    }
+
+    for (auto &t : workers) {
+        t.join();
     }
 
     foutTFOffsets.write((char*)&curTFOffset, sizeof(unsigned int));
     
+    foutPositions.close();
     foutTF.close();
     foutTFOffsets.close();
-
-    if (!records.empty()) {
-        string fileName = outputDir + '/' + to_string(curOutputFileNum);
-        writeRecords(records, fileName);
-    }
 }
 
 
@@ -289,112 +777,316 @@ void writeVector(const vector<string> &v, const string &outputFile) {
 }
 
 
-void writeIndex(vector<pair<TID, vector<TID>>> &records, const string &outputFile) {
+/* Terms, then biwords as their two terms */
+void writeTerms(const TokenMap &tokenMap, const BiwordTable &biwords, const string &outputFile) {
+    ofstream fout(outputFile);
+
+    for (TID termId = 0; termId < tokenMap.termsNum(); termId++) {
+        fout << tokenMap.term(termId) << '\n';
+    }
+    for (auto &p : biwords.pairs) {
+        fout << tokenMap.term(p.first) << ' ' << tokenMap.term(p.second) << '\n';
+    }
+
+    fout.close();
+}
+
+
+/* Meta file like the one of text_cleaner in the order of doc ids */
+void writeMeta(const vector<DocSource> &docs, const string &outputFile) {
+    ofstream fout(outputFile);
+
+    for (auto &d : docs) {
+        fout << d.name << '\t' << d.url << '\t' << d.title << '\t' << d.path << '\n';
+    }
+
+    fout.close();
+}
+
+
+void writeExternalIds(const vector<string> &documents, const string &outputFile) {
+    vector<TID> ids;
+    ids.reserve(documents.size());
+
+    for (auto &s : documents) {
+        ids.push_back(strtoul(s.c_str(), nullptr, 10));
+    }
+
     ofstream fout(outputFile, ios_base::binary);
+    fout.write((char*)ids.data(), sizeof(TID) * ids.size());
+    fout.close();
+}
+
+
+struct RunReader {
+    FILE *fin;
+    unsigned int termsLeft;
+    TID termId;
+    unsigned int length;
+    vector<int8_t> data;
+
+    RunReader(const string &fileName) {
+        fin = openFile(fileName, "rb");
+        fread(&termsLeft, sizeof(unsigned int), 1, fin);
+        next();
+    }
 
-    unsigned int n = records.size();
-    fout.write((char*)&n, sizeof(TID));
+    ~RunReader() {
+        fclose(fin);
+    }
 
-    for (size_t i = 0; i < records.size(); i++) {
-        fout.write((char*)&records[i].first, sizeof(TID));
+    bool end() {
+        return termId == (TID)-1;
+    }
 
-        auto &v = records[i].second;
-        TID prev = v[0];
-        for (unsigned int j = 1; j < v.size(); j++) {
-            v[j] = v[j] - prev;
-            prev += v[j];
+    void next() {
+        if (termsLeft == 0) {
+            termId = -1;
+            return;
         }
+        termsLeft--;
+
+        unsigned int bytes;
+        fread(&termId, sizeof(TID), 1, fin);
+        fread(&length, sizeof(unsigned int), 1, fin);
+        fread(&bytes, sizeof(unsigned int), 1, fin);
+        data.resize(bytes);
+        fread(data.data(), sizeof(int8_t), bytes, fin);
+    }
 
-        jumpedDataBuffer.clear();
-        Jump::insertJumps<VHB<TID, int8_t>, TID>(v, jumpedDataBuffer);
+    void decode(vector<TID> &docs) {
+        VB<TID, int8_t> vb(data.data(), data.size());
+        TID docId = 0;
+        for (unsigned int i = 0; i < length; i++) {
+            docId += vb.decodeNext();
+            docs.push_back(docId);
+        }
+    }
+};
+
+
+/*
+ * K-way merge of the runs. Runs hold consecutive ranges of documents,
+ * so postings of a term are concatenated in the order of runs.
+ */
+class RunMerger {
+private:
+    using TItem = pair<TID, size_t>;
+
+    vector<RunReader*> readers;
+    priority_queue<TItem, vector<TItem>, greater<TItem>> queue;
+public:
+    RunMerger(const vector<string> &runs) {
+        for (auto &r : runs) {
+            readers.push_back(new RunReader(r));
+        }
+        for (size_t i = 0; i < readers.size(); i++) {
+            if (!readers[i]->end()) queue.emplace(readers[i]->termId, i);
+        }
+    }
 
-        compressedDataBuffer_4bit.clear();
-        unsigned int n4 = VHB<TID, int8_t>::encode(jumpedDataBuffer, compressedDataBuffer_4bit);
-        assert(n4 <= (1 << (sizeof(unsigned int) * 8 - 2)));
-        n4 |= 1 << (sizeof(unsigned int) * 8 - 1);
+    ~RunMerger() {
+        for (auto r : readers) delete r;
+    }
 
-        jumpedDataBuffer.clear();
-        Jump::insertJumps<VB<TID, int8_t>, TID>(v, jumpedDataBuffer);
+    bool end() {
+        return queue.empty();
+    }
 
-        compressedDataBuffer_8bit.clear();
-        unsigned int n8 = VB<TID, int8_t>::encode(jumpedDataBuffer, compressedDataBuffer_8bit);
-        assert(n8 <= (1 << (sizeof(unsigned int) * 8 - 2)));
+    TID term() {
+        return queue.top().first;
+    }
 
-        n = v.size();
-        fout.write((char*)&n, sizeof(unsigned int));
+    /* Appends doc ids of the current term and moves to the next one */
+    void next(vector<TID> &docs) {
+        TID term = queue.top().first;
+        while (!queue.empty() && queue.top().first == term) {
+            size_t i = queue.top().second;
+            queue.pop();
 
-        if (compressedDataBuffer_8bit.size() <= compressedDataBuffer_4bit.size()) {
-            fout.write((char*)&n8, sizeof(unsigned int));
-            fout.write(
-                (char*)compressedDataBuffer_8bit.data(), 
-                compressedDataBuffer_8bit.size() * sizeof(int8_t));
-        } else {
-            fout.write((char*)&n4, sizeof(unsigned int));
-            fout.write(
-                (char*)compressedDataBuffer_4bit.data(), 
-                compressedDataBuffer_4bit.size() * sizeof(int8_t));
+            readers[i]->decode(docs);
+            readers[i]->next();
+            if (!readers[i]->end()) queue.emplace(readers[i]->termId, i);
+        }
+    }
+};
+
+
+/* Merges runs into one run file, the terms number is written at the end */
+void mergeRuns(const vector<string> &runs, const string &fileName) {
+    FILE *fout = openFile(fileName, "wb");
+    unsigned int n = 0;
+    fwrite(&n, sizeof(unsigned int), 1, fout);
+
+    vector<TID> docs, gaps;
+    vector<int8_t> buffer;
+    {
+        RunMerger merger(runs);
+        while (!merger.end()) {
+            TID termId = merger.term();
+            docs.clear();
+            merger.next(docs);
+
+            gaps.resize(docs.size());
+            for (size_t i = 0; i < docs.size(); i++) {
+                gaps[i] = i == 0 ? docs[i] : docs[i] - docs[i - 1];
+            }
+            buffer.clear();
+            VB<TID, int8_t>::encode(gaps, buffer);
+
+            unsigned int length = docs.size();
+            unsigned int bytes = buffer.size();
+            fwrite(&termId, sizeof(TID), 1, fout);
+            fwrite(&length, sizeof(unsigned int), 1, fout);
+            fwrite(&bytes, sizeof(unsigned int), 1, fout);
+            fwrite(buffer.data(), sizeof(int8_t), bytes, fout);
+            n++;
         }
     }
 
-    fout.close();
-    cout << "Wrote " << records.size() << " records to " << outputFile << endl;
-}
+    fseek(fout, 0, SEEK_SET);
+    fwrite(&n, sizeof(unsigned int), 1, fout);
+    if (fclose(fout) != 0) {
+        cerr << "ERROR: Can't write '" << fileName << "'" << endl;
+        exit(1);
+    }
 
+    for (auto &r : runs) {
+        fs::remove(r);
+    }
+}
 
-void buildIndex(const string &outputDir) {
-    string f = outputDir + "/merge";
-    ifstream fin(f);
 
-    vector<pair<TID, vector<TID>>> index;
+/*
+ * Merges runs by groups of MAX_MERGE_FAN_IN consecutive ones until at most
+ * MAX_MERGE_FAN_IN are left, so the final merge keeps a bounded number of
+ * files open. Merged runs still hold consecutive ranges of documents.
+ */
+vector<string> reduceRuns(const string &outputDir, vector<string> runs) {
+    for (unsigned int pass = 1; runs.size() > MAX_MERGE_FAN_IN; pass++) {
+        vector<string> merged;
+        for (size_t from = 0; from < runs.size(); from += MAX_MERGE_FAN_IN) {
+            size_t to = min(runs.size(), from + MAX_MERGE_FAN_IN);
+            if (to - from == 1) {
+                merged.push_back(runs[from]);
+                continue;
+            }
+            string fileName = outputDir + "/run_" + to_string(pass) + "_" + to_string(merged.size());
+            mergeRuns(vector<string>(runs.begin() + from, runs.begin() + to), fileName);
+            merged.push_back(fileName);
+        }
+        cout << "Merged " << runs.size() << " runs into " << merged.size() << endl;
+        runs = merged;
+    }
+    return runs;
+}
 
-    TID prevTerm;
 
-    TID term, doc;
+/*
+ * Term goes to the index file termId / MAX_INDEX_BLOCK_SIZE. Decoded
+ * postings are written out by batches of about memoryLimit / 4 bytes,
+ * encoding takes a few more copies of a batch.
+ */
+unsigned int buildIndex(const string &outputDir, const vector<string> &allRuns, size_t memoryLimit, unsigned int threadsNum) {
+    vector<string> runs = reduceRuns(outputDir, allRuns);
 
-    int curOutputFileNum = 0;
+    vector<pair<TID, vector<TID>>> index;
+    size_t indexBytes = 0;
+    unsigned int curOutputFileNum = 0;
+    IndexFileWriter *writer = new IndexFileWriter(outputDir + "/0", threadsNum);
 
-    fin >> term >> doc;
-    prevTerm = term;
-    index.push_back({term, vector<TID>()});
-    index.back().second.push_back(doc);
+    {
+        RunMerger merger(runs);
+        while (!merger.end()) {
+            TID term = merger.term();
 
-    while (!fin.eof()) {
-        fin >> term >> doc;
+            if (term / MAX_INDEX_BLOCK_SIZE != curOutputFileNum || indexBytes >= memoryLimit / 4) {
+                writer->write(index);
+                index.clear();
+                indexBytes = 0;
+            }
 
-        if (term != prevTerm) {
-            if (index.size() == MAX_INDEX_BLOCK_SIZE) {
-                writeIndex(index, outputDir + '/' + to_string(curOutputFileNum));
+            while (term / MAX_INDEX_BLOCK_SIZE != curOutputFileNum) {
+                writer->close();
+                delete writer;
                 curOutputFileNum++;
-                index.clear();
+                writer = new IndexFileWriter(outputDir + '/' + to_string(curOutputFileNum), threadsNum);
             }
 
             index.push_back({term, vector<TID>()});
-            prevTerm = term;
-        }
+            merger.next(index.back().second);
 
-        index.back().second.push_back(doc);
+            indexBytes += index.back().second.size() * sizeof(TID) + sizeof(index.back());
+        }
     }
 
-    if (!index.empty()) {
-        writeIndex(index, outputDir + '/' + to_string(curOutputFileNum));
+    writer->write(index);
+    writer->close();
+    delete writer;
+
+    for (auto &r : runs) {
+        fs::remove(r);
     }
 
-    fin.close();
+    return curOutputFileNum + 1;
 }
 
 
 int main(int argc, char *argv[]) {
-    if (argc < 5) {
+    auto options = parseOptions(argc, argv);
+
+    unsigned int threadsNum = thread::hardware_concurrency();
+    if (options.count("threads")) {
+        threadsNum = stoul(options["threads"]);
+    }
+    if (threadsNum == 0) {
+        threadsNum = 1;
+    }
+
+    size_t memoryLimit = DEFAULT_MEMORY_LIMIT;
+    if (options.count("memory-limit")) {
+        memoryLimit = parseSize(options["memory-limit"]);
+        if (memoryLimit == 0) {
+            cerr << "ERROR: bad memory limit " << options["memory-limit"] << endl;
+            return 1;
+        }
+        if (memoryLimit < PostingArena::BLOCK_SIZE) {
+            cerr << "ERROR: memory limit " << options["memory-limit"] << " is below one arena block of "
+                 << (PostingArena::BLOCK_SIZE >> 10) << "K" << endl;
+            return 1;
+        }
+    }
+
+    string reorder = options.count("reorder") ? options["reorder"] : "none";
+    if (reorder != "none" && reorder != "title" && reorder != "bisection") {
+        cerr << "ERROR: Unknown document order " << reorder << endl;
+        return 1;
+    }
+    string input = options.count("input") ? options["input"] : "tokens";
+    if (input != "tokens" && input != "dump") {
+        cerr << "ERROR: Unknown input format " << input << endl;
+        return 1;
+    }
+    bool dump = input == "dump";
+
+    if (reorder == "title" && !dump && !options.count("meta")) {
+        cerr << "ERROR: Ordering by title needs --meta" << endl;
+        return 1;
+    }
+
+    string mapFile = options.count("token-map") ? options["token-map"] : "";
+    int pathsArg = mapFile.empty() ? 4 : 2;
+
+    if (argc < pathsArg + 1) {
         print_help();
         return 0;
     }
 
     string outputDir(argv[1]); 
-    string tokensFile(argv[2]);
-    string termsFile(argv[3]);
+    string tokensFile(mapFile.empty() ? argv[2] : "");
+    string termsFile(mapFile.empty() ? argv[3] : "");
 
-    vector<string> terms;
-    unordered_map<string, TID> tokenToTermId;
+    TokenMap tokenMap;
 
     vector<string> documents;
 
@@ -403,56 +1095,74 @@ int main(int argc, char *argv[]) {
     string cmd;
 
     cout << "Building token to term dictinonary..." << endl;
-    TIMING(initTokensTerms(tokensFile, termsFile, tokenToTermId, terms));
+    bool loaded;
+    TIMING(loaded = loadTokenMap(mapFile, tokensFile, termsFile, tokenMap));
+    if (!loaded) {
+        cerr << "ERROR: Can't load the token map" << endl;
+        return 1;
+    }
+
+    BiwordTable biwords;
+    if (options.count("biwords")) {
+        cout << "Loading biwords..." << endl;
+        TIMING(loadBiwords(options["biwords"], tokenMap, biwords));
+        cout << "Loaded " << biwords.pairs.size() << " biwords" << endl;
+    }
+    unsigned int termsNum = tokenMap.termsNum() + biwords.pairs.size();
 
     cmd = "if ! [ -d " + positionsDir + " ]; then mkdir " + positionsDir + "; fi";
     systemNoReturn(cmd.c_str());
 
-    cout << "Processing documents..." << endl;
-    TIMING(processDocuments(argv + 4, argc - 4, outputDir, tokenToTermId, documents));
-
-    tokenToTermId.clear();
-    compressedDataBuffer_4bit.clear();
-    compressedDataBuffer_4bit.shrink_to_fit();
-    compressedDataBuffer_8bit.clear();
-    compressedDataBuffer_8bit.shrink_to_fit();
-    compressedDataBuffer_16bit.clear();
-    compressedDataBuffer_16bit.shrink_to_fit();
-    jumpedDataBuffer.clear();
-    jumpedDataBuffer.shrink_to_fit();
+    vector<DocSource> files;
+    if (dump) {
+        cout << "Scanning dumps..." << endl;
+        TIMING(files = listDocuments(argv + pathsArg, argc - pathsArg, true));
+    } else {
+        files = listDocuments(argv + pathsArg, argc - pathsArg, false);
+    }
+    if (!checkDocumentNames(files)) {
+        return 1;
+    }
 
-    cout << "Merging index blocks..." << endl;
-    cmd = "sort -k 1n -k 2n --merge --unique --buffer-size=30% --parallel=2 --output=";
-    cmd += outputDir + "/merge ";
-    cmd += "$(find " + outputDir + " -maxdepth 1 -type f -regextype posix-extended -regex '.*/[0-9]+')";
+    if (reorder == "bisection") {
+        cout << "Reordering documents by graph bisection..." << endl;
+        TIMING(reorderByBisection(files, tokenMap, tokenMap.termsNum(), threadsNum));
+    } else if (reorder == "title") {
+        cout << "Reordering documents by title..." << endl;
+        TIMING(reorderByTitle(files, options.count("meta") ? options["meta"] : ""));
+    }
 
-    TIMING(systemNoReturn(cmd.c_str()));
+    cout << "Processing documents..." << endl;
+    Inverter inverter(outputDir, termsNum, memoryLimit);
+    TIMING(processDocuments(files, outputDir, tokenMap, biwords, documents, inverter, threadsNum));
+    vector<string> runs = inverter.finish();
 
-    cout << "Deleting tmp files..." << endl;
-    cmd = "rm -f " + outputDir + '/';
-    for (int i = 0; i < 10; i++) {
-        string tmp = cmd + (char)('0' + i) + '*';
-        cout << tmp << endl;
-        systemNoReturn(tmp.c_str());
+    if (dump) {
+        cout << "Writing meta..." << endl;
+        TIMING(writeMeta(files, outputDir + "/meta"));
     }
-
-    cout << "* Done" << endl;
+    files.clear();
+    files.shrink_to_fit();
 
     cout << "Writing doc titles list..." << endl;
     TIMING(writeVector(documents, outputDir + "/docs"));
+    TIMING(writeExternalIds(documents, outputDir + Manifest::EXTERNAL_IDS_FILE_PATH));
+    unsigned int docsNum = documents.size();
     documents.clear();
     documents.shrink_to_fit();
 
     cout << "Writing terms list..." << endl;
-    TIMING(writeVector(terms, outputDir + "/terms"));
-    terms.clear();
-    terms.shrink_to_fit();
+    TIMING(writeTerms(tokenMap, biwords, outputDir + "/terms"));
+    if (!biwords.pairs.empty()) {
+        Biwords::write(outputDir + Biwords::FILE_PATH, biwords.firstId, biwords.pairs);
+    }
 
     cout << "Building index..." << endl;
-    TIMING(buildIndex(outputDir));
+    unsigned int indexFilesNum;
+    TIMING(indexFilesNum = buildIndex(outputDir, runs, memoryLimit, threadsNum));
 
-    cmd = "rm -f " + outputDir + "/merge";
-    systemNoReturn(cmd.c_str());
+    cout << "Writing manifest..." << endl;
+    TIMING(writeManifest(outputDir, docsNum, termsNum, indexFilesNum));
     
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,293 @@
+#pragma once
+
+#include <iostream>
+#include <fstream>
+#include <experimental/filesystem>
+#include <vector>
+#include <string>
+#include <cassert>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+#include "../codec.h"
+#include "../index_jumps.h"
+#include "../index_manifest.h"
+
+
+/* Layout and encoding of the index files, shared by the builder and the segments tool */
+
+const size_t MAX_INDEX_BLOCK_SIZE = 100000;
+const size_t MAX_POS_FILES_PER_DIR = 5000;
+const size_t DOCS_PER_FILE = 10;
+
+
+using namespace std;
+
+namespace fs = std::experimental::filesystem;
+
+using TID = unsigned int;
+
+
+const string TF_FILE_PATH = "/tf";
+const string TF_OFFSET_FILE_PATH = "/tf_offsets";
+const string POSITIONS_DIR_PATH = "/positions/";
+
+
+template<typename T>
+void appendBytes(vector<char> &out, const T *data, size_t n) {
+    out.insert(out.end(), (const char*)data, (const char*)(data + n));
+}
+
+
+void writeManifest(const string &outputDir, unsigned int docsNum, unsigned int termsNum, unsigned int indexFilesNum) {
+    Manifest::Header header = {};
+
+    header.magic = Manifest::MAGIC;
+    header.version = Manifest::VERSION;
+
+    header.docsNum = docsNum;
+    header.termsNum = termsNum;
+
+    header.indexFilesNum = indexFilesNum;
+    header.recordsPerFile = MAX_INDEX_BLOCK_SIZE;
+    header.docsPerFile = DOCS_PER_FILE;
+    header.posFilesPerDir = MAX_POS_FILES_PER_DIR;
+
+    header.postingsCodecs = Manifest::codecMask(Manifest::CODEC_VB) | Manifest::codecMask(Manifest::CODEC_VHB);
+    header.positionsCodecs = Manifest::codecMask(Manifest::CODEC_VB) | Manifest::codecMask(Manifest::CODEC_VHB);
+    header.tfCodecs = Manifest::codecMask(Manifest::CODEC_VB);
+
+    header.tfSize = fs::file_size(outputDir + TF_FILE_PATH);
+    header.externalIdsChecksum = Manifest::fileChecksum(outputDir + Manifest::EXTERNAL_IDS_FILE_PATH);
+    header.tfOffsetsChecksum = Manifest::fileChecksum(outputDir + TF_OFFSET_FILE_PATH);
+
+    if (!Manifest::write(outputDir + Manifest::FILE_PATH, header)) {
+        cerr << "ERROR: Can't write manifest to '" << outputDir << "'" << endl;
+        exit(1);
+    }
+}
+
+
+/* Scratch buffers of an encoding thread */
+struct EncodeBuffers {
+    vector<int8_t> compressed_4bit;
+    vector<int8_t> compressed_8bit;
+    vector<TID> jumped;
+};
+
+
+/*
+ * Index record of the term: term id, postings number, encoded size with
+ * the codec bit, doc id gaps with jumps encoded by VHB or VB, whichever
+ * is smaller. Doc ids in v become gaps.
+ */
+void encodeRecord(TID termId, vector<TID> &v, EncodeBuffers &buffers, vector<char> &out) {
+    appendBytes(out, &termId, 1);
+
+    TID prev = v[0];
+    for (unsigned int j = 1; j < v.size(); j++) {
+        v[j] = v[j] - prev;
+        prev += v[j];
+    }
+
+    buffers.jumped.clear();
+    Jump::insertJumps<VHB<TID, int8_t>, TID>(v, buffers.jumped);
+
+    buffers.compressed_4bit.clear();
+    unsigned int n4 = VHB<TID, int8_t>::encode(buffers.jumped, buffers.compressed_4bit);
+    assert(n4 <= (1 << (sizeof(unsigned int) * 8 - 2)));
+    n4 |= 1 << (sizeof(unsigned int) * 8 - 1);
+
+    buffers.jumped.clear();
+    Jump::insertJumps<VB<TID, int8_t>, TID>(v, buffers.jumped);
+
+    buffers.compressed_8bit.clear();
+    unsigned int n8 = VB<TID, int8_t>::encode(buffers.jumped, buffers.compressed_8bit);
+    assert(n8 <= (1 << (sizeof(unsigned int) * 8 - 2)));
+
+    unsigned int n = v.size();
+    appendBytes(out, &n, 1);
+
+    if (buffers.compressed_8bit.size() <= buffers.compressed_4bit.size()) {
+        appendBytes(out, &n8, 1);
+        appendBytes(out, buffers.compressed_8bit.data(), buffers.compressed_8bit.size());
+    } else {
+        appendBytes(out, &n4, 1);
+        appendBytes(out, buffers.compressed_4bit.data(), buffers.compressed_4bit.size());
+    }
+}
+
+
+/*
+ * Records are split into chunks of about the same postings number, threads
+ * encode chunks into their own buffers and the calling thread writes the
+ * chunks in order as soon as they are ready.
+ */
+void writeIndex(vector<pair<TID, vector<TID>>> &records, ofstream &fout, unsigned int threadsNum) {
+    if (records.empty()) return;
+
+    size_t postingsNum = 0;
+    for (auto &r : records) {
+        postingsNum += r.second.size();
+    }
+
+    vector<size_t> bounds(1, 0);
+    size_t chunkPostings = postingsNum / (threadsNum * 8) + 1;
+    size_t curPostings = 0;
+    for (size_t i = 0; i < records.size(); i++) {
+        curPostings += records[i].second.size();
+        if (curPostings >= chunkPostings || i + 1 == records.size()) {
+            bounds.push_back(i + 1);
+            curPostings = 0;
+        }
+    }
+
+    size_t chunksNum = bounds.size() - 1;
+    vector<vector<char>> chunks(chunksNum);
+    vector<bool> ready(chunksNum, false);
+    atomic<size_t> nextChunk(0);
+    mutex m;
+    condition_variable chunkReady;
+
+    vector<thread> workers;
+    for (unsigned int t = 0; t < min<size_t>(threadsNum, chunksNum); t++) {
+        workers.emplace_back([&]() {
+            EncodeBuffers buffers;
+            size_t c;
+            while ((c = nextChunk++) < chunksNum) {
+                for (size_t i = bounds[c]; i < bounds[c + 1]; i++) {
+                    encodeRecord(records[i].first, records[i].second, buffers, chunks[c]);
+                }
+                {
+                    lock_guard<mutex> lock(m);
+                    ready[c] = true;
+                }
+                chunkReady.notify_one();
+            }
+        });
+    }
+
+    for (size_t c = 0; c < chunksNum; c++) {
+        {
+            unique_lock<mutex> lock(m);
+            chunkReady.wait(lock, [&]() { return ready[c]; });
+        }
+        fout.write(chunks[c].data(), chunks[c].size());
+        vector<char>().swap(chunks[c]);
+    }
+
+    for (auto &t : workers) {
+        t.join();
+    }
+}
+
+
+/*
+ * Index file written by batches of records, the records number in the
+ * header is filled in when the file is closed.
+ */
+class IndexFileWriter {
+private:
+    ofstream fout;
+    string fileName;
+    unsigned int threadsNum;
+    unsigned int recordsNum;
+public:
+    IndexFileWriter(const string &fileName, unsigned int threadsNum) :
+        fout(fileName, ios_base::binary), fileName(fileName), threadsNum(threadsNum), recordsNum(0)
+    {
+        fout.write((char*)&recordsNum, sizeof(unsigned int));
+    }
+
+    void write(vector<pair<TID, vector<TID>>> &records) {
+        writeIndex(records, fout, threadsNum);
+        recordsNum += records.size();
+    }
+
+    void close() {
+        fout.seekp(0);
+        fout.write((char*)&recordsNum, sizeof(unsigned int));
+        fout.close();
+        cout << "Wrote " << recordsNum << " records to " << fileName << endl;
+    }
+};
+
+
+/* Sequential reader of an index file, doc ids are decoded without jumps */
+class IndexFileReader {
+private:
+    FILE *fin;
+    unsigned int recordsLeft;
+    unsigned int codedSize;
+    vector<int8_t> data;
+public:
+    TID termId;
+    unsigned int length;
+
+    IndexFileReader(const string &fileName) : recordsLeft(0), termId(-1), length(0) {
+        fin = fopen(fileName.c_str(), "rb");
+        if (fin && fread(&recordsLeft, sizeof(unsigned int), 1, fin) != 1) {
+            recordsLeft = 0;
+        }
+        next();
+    }
+
+    ~IndexFileReader() {
+        if (fin) fclose(fin);
+    }
+
+    bool end() {
+        return termId == (TID)-1;
+    }
+
+    void next() {
+        if (recordsLeft == 0) {
+            termId = -1;
+            return;
+        }
+        recordsLeft--;
+
+        fread(&termId, sizeof(TID), 1, fin);
+        fread(&length, sizeof(unsigned int), 1, fin);
+        fread(&codedSize, sizeof(unsigned int), 1, fin);
+
+        unsigned int bitCnt = codedSize & ((1u << (sizeof(unsigned int) * 8 - 1)) - 1);
+        data.resize((bitCnt + 7) / 8);
+        fread(data.data(), sizeof(int8_t), data.size(), fin);
+    }
+
+    /* Doc ids are encoded by VHB, otherwise by VB */
+    bool isVHB() {
+        return codedSize >> (sizeof(unsigned int) * 8 - 1);
+    }
+
+    /* Bytes of the encoded doc ids with their jumps */
+    size_t encodedSize() {
+        return data.size();
+    }
+
+    void decode(vector<TID> &docs) {
+        if (isVHB()) {
+            decode<VHB<TID, int8_t>>(docs);
+        } else {
+            decode<VB<TID, int8_t>>(docs);
+        }
+    }
+
+    template<typename TCodec>
+    void decode(vector<TID> &docs) {
+        TCodec codec(data.data(), data.size());
+        unsigned int jlen = Jump::jumpLength(length);
+        TID docId = 0;
+        for (unsigned int i = 0; i < length; i++) {
+            docId += codec.decodeNext();
+            docs.push_back(docId);
+            if (Jump::isJump(i, jlen, length)) {
+                codec.decodeNext();
+                codec.decodeNext();
+            }
+        }
+    }
+};
@@ -0,0 +1,408 @@
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <experimental/filesystem>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "../index_segments.h"
+#include "index_files.h"
+
+
+using namespace std;
+
+namespace fs = std::experimental::filesystem;
+
+
+const size_t DEFAULT_TOP = 20;
+const size_t BLOCK_PACK_SIZE = 128;
+
+
+void print_help() {
+    cout << "usage: index_stats.out index_directory [top_n]" << endl;
+    cout << "index_directory is an index of index_builder or a segmented index of segments.out" << endl;
+    cout << "top_n\tlargest posting lists to list, " << DEFAULT_TOP << " by default" << endl;
+}
+
+
+/* Layout of the index files, from the manifest or the builder constants for a legacy index */
+struct Layout {
+    unsigned int docsNum;
+    unsigned int indexFilesNum;
+    unsigned int recordsPerFile;
+    unsigned int docsPerFile;
+    unsigned int posFilesPerDir;
+};
+
+
+bool readLayout(const string &dir, Layout &layout) {
+    Manifest::Header manifest;
+    if (Manifest::read(dir + Manifest::FILE_PATH, manifest)) {
+        layout = {manifest.docsNum, manifest.indexFilesNum, manifest.recordsPerFile, manifest.docsPerFile, manifest.posFilesPerDir};
+        return true;
+    }
+
+    if (!fs::exists(dir + TF_OFFSET_FILE_PATH)) {
+        return false;
+    }
+    layout.docsNum = fs::file_size(dir + TF_OFFSET_FILE_PATH) / sizeof(unsigned int) - 1;
+    layout.indexFilesNum = 0;
+    while (fs::exists(dir + "/" + to_string(layout.indexFilesNum))) {
+        layout.indexFilesNum++;
+    }
+    layout.recordsPerFile = MAX_INDEX_BLOCK_SIZE;
+    layout.docsPerFile = DOCS_PER_FILE;
+    layout.posFilesPerDir = MAX_POS_FILES_PER_DIR;
+    return true;
+}
+
+
+template<typename T>
+T percentile(vector<T> &v, double p) {
+    if (v.empty()) return 0;
+    size_t i = min(v.size() - 1, (size_t)(p / 100 * v.size()));
+    nth_element(v.begin(), v.begin() + i, v.end());
+    return v[i];
+}
+
+
+template<typename T>
+void printDistribution(const string &name, vector<T> &v) {
+    double sum = 0;
+    for (auto x : v) sum += x;
+    cout << name << ": mean " << (v.empty() ? 0 : sum / v.size())
+         << ", p50 " << percentile(v, 50) << ", p99 " << percentile(v, 99) << ", max " << percentile(v, 100) << endl;
+}
+
+
+double percent(double a, double b) {
+    return b > 0 ? 100 * a / b : 0;
+}
+
+
+/* Sizes of the doc id gaps of a list in every codec, without jumps */
+struct CodecSizes {
+    size_t vb = 0;
+    size_t vhb = 0;
+    size_t best = 0;
+    size_t gamma = 0;
+    size_t blockPack = 0;
+
+    void add(const CodecSizes &other) {
+        vb += other.vb;
+        vhb += other.vhb;
+        best += other.best;
+        gamma += other.gamma;
+        blockPack += other.blockPack;
+    }
+};
+
+
+unsigned int bitWidth(TID n) {
+    return n ? 32 - __builtin_clz(n) : 0;
+}
+
+
+/*
+ * VB and VHB are encoded for real. Elias gamma and bit packing of blocks
+ * of 128 gaps with a byte of their width, the scheme of PFor and SIMD-BP128
+ * without exceptions, are counted only.
+ */
+CodecSizes codecSizes(const vector<TID> &gaps, vector<int8_t> &buffer) {
+    CodecSizes sizes;
+
+    buffer.clear();
+    VB<TID, int8_t>::encode(gaps, buffer);
+    sizes.vb = buffer.size();
+
+    buffer.clear();
+    VHB<TID, int8_t>::encode(gaps, buffer);
+    sizes.vhb = buffer.size();
+
+    sizes.best = min(sizes.vb, sizes.vhb);
+
+    size_t gammaBits = 0;
+    for (size_t i = 0; i < gaps.size(); i++) {
+        // the first doc id may be 0, gamma codes start at 1
+        gammaBits += 2 * bitWidth(gaps[i] + (i == 0)) - 1;
+    }
+    sizes.gamma = (gammaBits + 7) / 8;
+
+    size_t packBits = 0;
+    for (size_t from = 0; from < gaps.size(); from += BLOCK_PACK_SIZE) {
+        size_t to = min(gaps.size(), from + BLOCK_PACK_SIZE);
+        unsigned int width = 0;
+        for (size_t i = from; i < to; i++) {
+            width = max(width, bitWidth(gaps[i]));
+        }
+        packBits += 8 + width * (to - from);
+    }
+    sizes.blockPack = (packBits + 7) / 8;
+
+    return sizes;
+}
+
+
+struct ListStats {
+    TID termId;
+    unsigned int length;
+    size_t bytes;
+    size_t skipBytes;
+    bool vhb;
+};
+
+
+/* Lists of lengths from 2^k to 2^(k+1) - 1 */
+struct LengthBucket {
+    size_t lists = 0;
+    size_t postings = 0;
+    size_t bytes = 0;
+    size_t skipBytes = 0;
+    size_t vhbLists = 0;
+};
+
+
+void analyzePostings(const string &dir, const Layout &layout, const vector<string> &terms, size_t top) {
+    vector<ListStats> lists;
+    vector<LengthBucket> buckets;
+    CodecSizes total;
+    size_t postings = 0, diskBytes = 0, skipBytes = 0;
+    vector<double> fileMb;
+    vector<unsigned int> fileRecords;
+
+    vector<TID> docs;
+    vector<int8_t> buffer;
+    for (unsigned int f = 0; f < layout.indexFilesNum; f++) {
+        string fileName = dir + "/" + to_string(f);
+        if (!fs::exists(fileName)) continue;
+        fileMb.push_back(fs::file_size(fileName) / 1048576.0);
+        fileRecords.push_back(0);
+
+        for (IndexFileReader reader(fileName); !reader.end(); reader.next()) {
+            docs.clear();
+            reader.decode(docs);
+            for (size_t i = docs.size(); i-- > 1;) {
+                docs[i] -= docs[i - 1];
+            }
+
+            CodecSizes sizes = codecSizes(docs, buffer);
+            total.add(sizes);
+
+            ListStats list = {reader.termId, reader.length, reader.encodedSize(), 0, reader.isVHB()};
+            list.skipBytes = list.bytes - (list.vhb ? sizes.vhb : sizes.vb);
+            lists.push_back(list);
+
+            unsigned int k = bitWidth(list.length) - 1;
+            if (buckets.size() <= k) buckets.resize(k + 1);
+            LengthBucket &b = buckets[k];
+            b.lists++;
+            b.postings += list.length;
+            b.bytes += list.bytes;
+            b.skipBytes += list.skipBytes;
+            b.vhbLists += list.vhb;
+
+            postings += list.length;
+            diskBytes += list.bytes;
+            skipBytes += list.skipBytes;
+            fileRecords.back()++;
+        }
+    }
+
+    size_t headerBytes = lists.size() * 3 * sizeof(unsigned int);
+
+    cout << "== Postings" << endl;
+    cout << "lists " << lists.size() << ", postings " << postings << ", encoded " << diskBytes
+         << " bytes, record headers " << headerBytes << " bytes" << endl;
+    cout << "bits/posting " << (postings ? 8.0 * diskBytes / postings : 0)
+         << ", skips " << skipBytes << " bytes, " << percent(skipBytes, diskBytes) << "% of encoded" << endl;
+    cout << "index files " << fileMb.size() << ", records per file " << layout.recordsPerFile
+         << ", a cold term loads its whole file" << endl;
+    printDistribution("file MB", fileMb);
+    printDistribution("file records", fileRecords);
+
+    cout << endl << "Posting list lengths:" << endl;
+    cout << setw(18) << "length" << setw(10) << "lists" << setw(12) << "postings%" << setw(10) << "bytes%"
+         << setw(12) << "bits/post" << setw(8) << "VHB%" << setw(8) << "skip%" << endl;
+    for (size_t k = 0; k < buckets.size(); k++) {
+        auto &b = buckets[k];
+        if (b.lists == 0) continue;
+        string range = to_string(1ULL << k) + (k ? "-" + to_string((2ULL << k) - 1) : "");
+        cout << setw(18) << range << setw(10) << b.lists << setw(12) << percent(b.postings, postings)
+             << setw(10) << percent(b.bytes, diskBytes) << setw(12) << 8.0 * b.bytes / b.postings
+             << setw(8) << percent(b.vhbLists, b.lists) << setw(8) << percent(b.skipBytes, b.bytes) << endl;
+    }
+
+    cout << endl << "Codecs on the same gaps, without skips:" << endl;
+    vector<pair<string, size_t>> codecs = {
+        {"vb/vhb per list (current)", total.best},
+        {"vb only", total.vb},
+        {"vhb only", total.vhb},
+        {"elias gamma", total.gamma},
+        {"bit packing of 128", total.blockPack},
+    };
+    for (auto &c : codecs) {
+        cout << setw(28) << c.first << setw(14) << c.second << " bytes" << setw(10) << (postings ? 8.0 * c.second / postings : 0)
+             << " bits/posting, saves " << percent((double)total.best - c.second, total.best) << "%" << endl;
+    }
+
+    top = min(top, lists.size());
+    partial_sort(lists.begin(), lists.begin() + top, lists.end(), [](const ListStats &a, const ListStats &b) {
+        return a.length > b.length;
+    });
+    cout << endl << "Largest lists:" << endl;
+    cout << setw(10) << "term id" << setw(20) << "term" << setw(12) << "postings" << setw(12) << "bytes"
+         << setw(7) << "codec" << setw(12) << "bits/post" << setw(8) << "skip%" << endl;
+    for (size_t i = 0; i < top; i++) {
+        auto &l = lists[i];
+        cout << setw(10) << l.termId << setw(20) << (l.termId < terms.size() ? terms[l.termId] : "")
+             << setw(12) << l.length << setw(12) << l.bytes << setw(7) << (l.vhb ? "vhb" : "vb")
+             << setw(12) << 8.0 * l.bytes / l.length << setw(8) << percent(l.skipBytes, l.bytes) << endl;
+    }
+}
+
+
+/*
+ * A positions lookup reads the record headers of the file until the doc,
+ * so the bytes before a doc in its file are the cost of DOCS_PER_FILE.
+ */
+void analyzePositions(const string &dir, const Layout &layout) {
+    vector<size_t> docBytes;
+    vector<double> fileKb;
+    size_t lists = 0, vhbLists = 0, positions = 0, dataBytes = 0, totalBytes = 0;
+    double bytesBefore = 0;
+
+    vector<char> file;
+    unsigned int filesNum = (layout.docsNum + layout.docsPerFile - 1) / layout.docsPerFile;
+    for (unsigned int f = 0; f < filesNum; f++) {
+        string fileName = dir + POSITIONS_DIR_PATH + to_string(f / layout.posFilesPerDir) + "/" + to_string(f);
+        ifstream fin(fileName, ios::binary);
+        if (!fin) {
+            cerr << "ERROR: Can't open positions file '" << fileName << "'" << endl;
+            continue;
+        }
+        file.assign(istreambuf_iterator<char>(fin), istreambuf_iterator<char>());
+        fileKb.push_back(file.size() / 1024.0);
+        totalBytes += file.size();
+
+        size_t pos = 0;
+        auto readUInt = [&]() {
+            unsigned int x = 0;
+            if (pos + sizeof(unsigned int) <= file.size()) memcpy(&x, file.data() + pos, sizeof(unsigned int));
+            pos += sizeof(unsigned int);
+            return x;
+        };
+
+        while (pos < file.size()) {
+            size_t start = pos;
+            bytesBefore += start;
+            readUInt();
+            unsigned int termsNum = readUInt();
+            for (unsigned int i = 0; i < termsNum && pos < file.size(); i++) {
+                readUInt();
+                unsigned int codedSize = readUInt();
+                bool vhb = codedSize >> (sizeof(unsigned int) * 8 - 1);
+                unsigned int size = ((codedSize & ((1u << (sizeof(unsigned int) * 8 - 1)) - 1)) + 7) / 8;
+                size = min<size_t>(size, file.size() - min(pos, file.size()));
+
+                int8_t *data = (int8_t*)file.data() + pos;
+                if (vhb) {
+                    VHB<unsigned int, int8_t> codec(data, size);
+                    while (!codec.end()) { codec.decodeNext(); positions++; }
+                } else {
+                    VB<unsigned int, int8_t> codec(data, size);
+                    while (!codec.end()) { codec.decodeNext(); positions++; }
+                }
+                pos += size;
+                dataBytes += size;
+                lists++;
+                vhbLists += vhb;
+            }
+            docBytes.push_back(min(pos, file.size()) - start);
+        }
+    }
+
+    cout << endl << "== Positions" << endl;
+    cout << "files " << fileKb.size() << ", docs per file " << layout.docsPerFile << ", total " << totalBytes << " bytes" << endl;
+    cout << "term lists " << lists << ", VHB " << percent(vhbLists, lists) << "%, positions " << positions
+         << ", bits/position " << (positions ? 8.0 * dataBytes / positions : 0)
+         << ", headers " << percent(totalBytes - dataBytes, totalBytes) << "% of bytes" << endl;
+    printDistribution("bytes per doc", docBytes);
+    printDistribution("file KB", fileKb);
+    cout << "bytes before a doc in its file: mean " << (docBytes.empty() ? 0 : bytesBefore / docBytes.size()) << endl;
+}
+
+
+void analyzeTF(const string &dir, const Layout &layout) {
+    vector<unsigned int> offsets(layout.docsNum + 1);
+    ifstream fin(dir + TF_OFFSET_FILE_PATH, ios::binary);
+    fin.read((char*)offsets.data(), offsets.size() * sizeof(unsigned int));
+    if (!fin) {
+        cerr << "ERROR: Can't read TF offsets of '" << dir << "'" << endl;
+        return;
+    }
+
+    vector<unsigned int> docBytes(layout.docsNum);
+    for (unsigned int i = 0; i < layout.docsNum; i++) {
+        docBytes[i] = offsets[i + 1] - offsets[i];
+    }
+
+    cout << endl << "== TF" << endl;
+    cout << "tf " << fs::file_size(dir + TF_FILE_PATH) << " bytes, tf_offsets "
+         << fs::file_size(dir + TF_OFFSET_FILE_PATH) << " bytes" << endl;
+    printDistribution("bytes per doc", docBytes);
+}
+
+
+bool analyze(const string &dir, size_t top) {
+    Layout layout;
+    if (!readLayout(dir, layout)) {
+        cerr << "ERROR: No index in '" << dir << "'" << endl;
+        return false;
+    }
+
+    vector<string> terms;
+    ifstream fterms(dir + "/terms");
+    string term;
+    while (getline(fterms, term)) {
+        terms.push_back(term);
+    }
+
+    cout << "Index '" << dir << "': " << layout.docsNum << " docs" << endl << endl;
+    analyzePostings(dir, layout, terms, top);
+    analyzePositions(dir, layout);
+    analyzeTF(dir, layout);
+    return true;
+}
+
+
+/*
+ * Offline statistics of a built index: posting list lengths, codecs and
+ * skips of the lists, alternative codecs on the same gaps, and the sizes
+ * behind the RECORDS_PER_FILE and DOCS_PER_FILE layout.
+ */
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        print_help();
+        return 0;
+    }
+
+    cout << fixed << setprecision(2);
+
+    string indexDir(argv[1]);
+    size_t top = argc > 2 ? stoul(argv[2]) : DEFAULT_TOP;
+
+    vector<string> names;
+    if (!Segments::read(indexDir + Segments::FILE_PATH, names)) {
+        return analyze(indexDir, top) ? 0 : 1;
+    }
+
+    bool ok = true;
+    for (auto &name : names) {
+        ok = analyze(indexDir + "/" + name, top) && ok;
+        cout << endl;
+    }
+    return ok ? 0 : 1;
+}
@@ -2,9 +2,16 @@
 #include <dirent.h>
 #include <string>
 #include <vector>
-#include <map>
 #include <algorithm>
 #include <fstream>
+#include <cstring>
+#include <cstdint>
+#include <cctype>
+#include <thread>
+#include <atomic>
+
+#include "doc_source.h"
+#include "tokenizer.h"
 
 using namespace std;
 
@@ -21,11 +28,151 @@ inline bool endsWith(const string &s, const string &suff) {
 }
 
 
+/*
+ * Token counts in an open addressing table with linear probing, the
+ * strings are kept in BLOCK_SIZE blocks of an arena and never move.
+ */
+class TokenCounter {
+private:
+    static const size_t BLOCK_SIZE = 1 << 20;
+    static const size_t MIN_CAPACITY = 1 << 10;
+
+    struct Entry {
+        uint64_t hash;
+        const char *str;
+        uint32_t length;
+        uint32_t count;
+    };
+
+    vector<Entry> table;
+    size_t used;
+    vector<char*> blocks;
+    size_t blockTop;
+
+    const char* store(const char *s, size_t n) {
+        if (blocks.empty() || blockTop + n > BLOCK_SIZE) {
+            blocks.push_back(new char[max(n, BLOCK_SIZE)]);
+            blockTop = 0;
+        }
+        char *p = blocks.back() + blockTop;
+        memcpy(p, s, n);
+        blockTop += n;
+        return p;
+    }
+
+    void grow() {
+        vector<Entry> old(table.size() * 2, Entry{0, nullptr, 0, 0});
+        old.swap(table);
+        size_t mask = table.size() - 1;
+        for (auto &e : old) {
+            if (!e.str) continue;
+            size_t i = e.hash & mask;
+            while (table[i].str) i = (i + 1) & mask;
+            table[i] = e;
+        }
+    }
+public:
+    TokenCounter() : table(MIN_CAPACITY, Entry{0, nullptr, 0, 0}), used(0), blockTop(0) {}
+
+    ~TokenCounter() {
+        for (auto b : blocks) delete[] b;
+    }
+
+    TokenCounter(const TokenCounter&) = delete;
+    TokenCounter& operator=(const TokenCounter&) = delete;
+
+    static uint64_t hash(const char *s, size_t n) {
+        uint64_t h = 14695981039346656037ULL;
+        for (size_t i = 0; i < n; i++) {
+            h ^= (unsigned char)s[i];
+            h *= 1099511628211ULL;
+        }
+        return h ^ (h >> 29);
+    }
+
+    void add(const char *s, size_t n, uint64_t h, uint32_t count) {
+        size_t mask = table.size() - 1;
+        size_t i = h & mask;
+        while (table[i].str) {
+            Entry &e = table[i];
+            if (e.hash == h && e.length == n && memcmp(e.str, s, n) == 0) {
+                e.count += count;
+                return;
+            }
+            i = (i + 1) & mask;
+        }
+
+        table[i] = Entry{h, store(s, n), (uint32_t)n, count};
+        if (++used * 2 > table.size()) grow();
+    }
+
+    void add(const char *s, size_t n) {
+        add(s, n, hash(s, n), 1);
+    }
+
+    /* Adds the counts of other's tokens of the shard, shards are taken by high bits of the hash unlike the slots */
+    void merge(const TokenCounter &other, size_t shard, size_t shardsNum) {
+        for (auto &e : other.table) {
+            if (e.str && (e.hash >> 40) % shardsNum == shard) add(e.str, e.length, e.hash, e.count);
+        }
+    }
+
+    void collect(vector<pair<unsigned int, string>> &v) const {
+        for (auto &e : table) {
+            if (e.str) v.emplace_back(e.count, string(e.str, e.length));
+        }
+    }
+};
+
+
+void countTokens(const string &path, bool dump, Tokenizer &tokenizer, vector<DocSource> &docs, string &text, TokenCounter &counter) {
+    if (dump) {
+        docs.clear();
+        Dump::scan(path, docs);
+        for (auto &doc : docs) {
+            doc.read(text);
+            tokenizer.tokenize(text.data(), text.size(), [&](const string &t) { counter.add(t.data(), t.size()); });
+        }
+        return;
+    }
+
+    ifstream fin(path, ios_base::binary);
+    text.assign(istreambuf_iterator<char>(fin), istreambuf_iterator<char>());
+
+    size_t i = 0;
+    while (i < text.size()) {
+        while (i < text.size() && isspace((unsigned char)text[i])) i++;
+        size_t start = i;
+        while (i < text.size() && !isspace((unsigned char)text[i])) i++;
+        if (start < i) counter.add(text.data() + start, i - start);
+    }
+}
+
+
+/*
+ * Files of the directories are counted by threads into their own tables,
+ * then shard s of all tables is merged by thread s. Tokens are written
+ * sorted by count, then by the token.
+ *
+ * options: --input=dump (files are raw <doc> dumps, tokenized like
+ * index_builder does it), --threads=N (all cores by default)
+ */
 int main(int argc, char* argv[]) {
+    bool dump = false;
+    unsigned int threadsNum = thread::hardware_concurrency();
+    int n = 0;
+    for (int i = 0; i < argc; i++) {
+        string arg(argv[i]);
+        if (arg == "--input=dump") dump = true;
+        else if (arg.compare(0, 10, "--threads=") == 0) threadsNum = stoul(arg.substr(10));
+        else argv[n++] = argv[i];
+    }
+    argc = n;
+    if (threadsNum == 0) threadsNum = 1;
+
     if (argc < 3) return 0;
 
-    map<string, unsigned int> tokens;
-    string token;
+    vector<string> files;
 
     DIR *dirp;
     struct dirent *directory;
@@ -36,37 +183,64 @@ int main(int argc, char* argv[]) {
             while ((directory = readdir(dirp)) != NULL) {
                 string file_path = string(argv[i]) + '/' + string(directory->d_name);
 
-                if (endsWith(file_path, "/.") || 
-                    endsWith(file_path, "/..") || 
-                    endsWith(file_path, "/./") || 
+                if (endsWith(file_path, "/.") ||
+                    endsWith(file_path, "/..") ||
+                    endsWith(file_path, "/./") ||
                     endsWith(file_path, "/../")) continue;
 
-                ifstream fin(file_path);
-                
-                while (fin >> token) {
-                    if (!token.empty()) tokens[token]++;
-                }
-
-                fin.close();
+                files.push_back(file_path);
             }
 
-            cout << argv[i] << ": done" << endl;
-
             closedir(dirp);
         }
     }
 
-    vector<pair<unsigned int, string>> v;
-    v.reserve(tokens.size());
+    vector<TokenCounter> counters(threadsNum);
+    atomic<size_t> nextFile(0);
+
+    vector<thread> workers;
+    for (unsigned int t = 0; t < threadsNum; t++) {
+        workers.emplace_back([&, t]() {
+            Tokenizer tokenizer;
+            vector<DocSource> docs;
+            string text;
+            size_t i;
+            while ((i = nextFile++) < files.size()) {
+                countTokens(files[i], dump, tokenizer, docs, text, counters[t]);
+            }
+        });
+    }
+    for (auto &w : workers) {
+        w.join();
+    }
+    cout << files.size() << " files: done" << endl;
+
+    vector<vector<pair<unsigned int, string>>> shards(threadsNum);
+    workers.clear();
+    for (unsigned int s = 0; s < threadsNum; s++) {
+        workers.emplace_back([&, s]() {
+            TokenCounter merged;
+            for (auto &c : counters) {
+                merged.merge(c, s, threadsNum);
+            }
+            merged.collect(shards[s]);
+        });
+    }
+    for (auto &w : workers) {
+        w.join();
+    }
 
-    for (auto &i : tokens) {
-        v.emplace_back(i.second, i.first);
+    vector<pair<unsigned int, string>> v;
+    for (auto &shard : shards) {
+        v.insert(v.end(), make_move_iterator(shard.begin()), make_move_iterator(shard.end()));
+        shard.clear();
+        shard.shrink_to_fit();
     }
     sort(v.begin(), v.end());
 
     ofstream fout(argv[1]);
     for (auto &i : v) {
-        fout << i.second << endl;
+        fout << i.second << '\n';
     }
     fout.close();
 
@@ -1,7 +1,10 @@
 #!/bin/bash
 
-g++ --std=c++17 -march=native -O3 -o make_dictionary.out make_dictionary.cpp
+g++ --std=c++17 -march=native -O3 -o make_dictionary.out make_dictionary.cpp -pthread
 echo "collecting dictionary..."
 time ./make_dictionary.out ./dict.txt ~/wiki_tokens/*
 echo "lemmatization..."
 time python3 mylemm.py ./dict.txt lemms_dict.txt
+echo "compiling token map..."
+g++ --std=c++17 -march=native -O3 -o make_token_map.out make_token_map.cpp
+time ./make_token_map.out ./token_map.bin ./dict.txt lemms_dict.txt
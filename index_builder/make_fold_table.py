@@ -0,0 +1,133 @@
+# Generates fold_table.h: folding of all Unicode code points the way
+# text_cleaner/make_tokens.py does it: NFKD, combining characters
+# removed, not alphanumeric characters split tokens, the rest lowercased.
+# Entries are code points or kinds with the flags of the final sigma rule
+# of str.lower(): cased, case ignorable (skipped when looking for a cased
+# neighbour) and sigma for what NFKD makes a capital sigma. Characters
+# removed by NFKD are expansions of length 0.
+#
+# usage: python3 make_fold_table.py > fold_table.h
+
+import sys
+import unicodedata
+
+
+IDENTITY = 0x40000000
+EXPANSION = 0x80000000
+SEPARATOR = 0xC0000000
+CASED = 0x20000000
+CASE_IGNORABLE = 0x10000000
+SIGMA = 0x08000000
+VALUE_MASK = 0x07FFFFFF
+
+HANGUL_FIRST = 0xAC00
+HANGUL_LAST = 0xD7A3
+CODE_POINTS = sys.maxunicode + 1
+
+
+def decompose(cp):
+    nfkd_form = unicodedata.normalize('NFKD', chr(cp))
+    return [c for c in nfkd_form if not unicodedata.combining(c)]
+
+
+def fold(cp):
+    out = []
+    for c in decompose(cp):
+        if c.isalnum():
+            out.extend(ord(x) for x in c.lower())
+        else:
+            out.append(0)
+    return out
+
+
+def is_cased(c):
+    return c.islower() or c.isupper() or c.istitle()
+
+
+def is_case_ignorable(c):
+    return unicodedata.category(c) in ('Mn', 'Me', 'Cf', 'Lm', 'Sk')
+
+
+# Flags of the characters the token gets before it is lowercased,
+# a case ignorable one is never taken for cased
+def flags(cp):
+    letters = [c for c in decompose(cp) if c.isalnum()]
+    f = 0
+    if letters and all(is_case_ignorable(c) for c in letters):
+        f |= CASE_IGNORABLE
+    elif any(is_cased(c) for c in letters):
+        f |= CASED
+    if letters == ['\u03a3']:
+        f |= SIGMA
+    return f
+
+
+def entry(cp, expansions):
+    if 0xD800 <= cp < 0xE000 or HANGUL_FIRST <= cp <= HANGUL_LAST:
+        return SEPARATOR
+    out = fold(cp)
+    f = flags(cp)
+    if out == [cp]:
+        return IDENTITY | f
+    if out and all(c == 0 for c in out):
+        return SEPARATOR
+    if len(out) == 1:
+        return out[0] | f
+    index = len(expansions)
+    expansions.append(len(out))
+    expansions.extend(out)
+    return EXPANSION | f | index
+
+
+def main():
+    expansions = []
+    blocks = []
+    block_ids = {}
+    stage1 = []
+
+    for hi in range(CODE_POINTS // 256):
+        block = tuple(entry(hi * 256 + lo, expansions) for lo in range(256))
+        if block not in block_ids:
+            block_ids[block] = len(blocks)
+            blocks.append(block)
+        stage1.append(block_ids[block])
+
+    out = sys.stdout
+    out.write('#pragma once\n\n#include <cstdint>\n\n\n')
+    out.write('/* Generated by make_fold_table.py from Unicode %s, do not edit */\n' % unicodedata.unidata_version)
+    out.write('namespace FoldTable {\n')
+    out.write('    const uint32_t IDENTITY = 0x%08X;\n' % IDENTITY)
+    out.write('    const uint32_t EXPANSION = 0x%08X;\n' % EXPANSION)
+    out.write('    const uint32_t SEPARATOR = 0x%08X;\n' % SEPARATOR)
+    out.write('    const uint32_t CASED = 0x%08X;\n' % CASED)
+    out.write('    const uint32_t CASE_IGNORABLE = 0x%08X;\n' % CASE_IGNORABLE)
+    out.write('    const uint32_t SIGMA = 0x%08X;\n' % SIGMA)
+    out.write('    const uint32_t KIND_MASK = 0xC0000000;\n')
+    out.write('    const uint32_t VALUE_MASK = 0x%08X;\n\n' % VALUE_MASK)
+    out.write('    const uint32_t HANGUL_FIRST = 0x%04X;\n' % HANGUL_FIRST)
+    out.write('    const uint32_t HANGUL_LAST = 0x%04X;\n' % HANGUL_LAST)
+    out.write('    const uint32_t CODE_POINTS = 0x%X;\n\n' % CODE_POINTS)
+
+    out.write('    const uint16_t STAGE1[%d] = {\n' % len(stage1))
+    for i in range(0, len(stage1), 16):
+        out.write('        ' + ', '.join(str(x) for x in stage1[i:i + 16]) + ',\n')
+    out.write('    };\n\n')
+
+    out.write('    const uint32_t STAGE2[%d][256] = {\n' % len(blocks))
+    for block in blocks:
+        out.write('        {\n')
+        for i in range(0, 256, 8):
+            out.write('            ' + ', '.join('0x%X' % x for x in block[i:i + 8]) + ',\n')
+        out.write('        },\n')
+    out.write('    };\n\n')
+
+    out.write('    /* Length and code points of every expansion, 0 splits tokens */\n')
+    out.write('    const uint32_t EXPANSIONS[%d] = {\n' % len(expansions))
+    for i in range(0, len(expansions), 12):
+        out.write('        ' + ', '.join('0x%X' % x for x in expansions[i:i + 12]) + ',\n')
+    out.write('    };\n')
+    out.write('};\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,62 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <ctime>
+
+#include "../token_map.h"
+
+
+time_t START_TIME;
+
+#define TIMING(s) START_TIME = time(0); s; std::cout << "* Done. Time: " << (time(0) - START_TIME) << " s" << endl;
+
+
+using namespace std;
+
+
+/* Compiles the token and term lists of make_dictionary.sh to the token map of index_builder --token-map */
+int main(int argc, char *argv[]) {
+    if (argc < 4) {
+        cout << "usage: make_token_map.out output_file file_with_uniq_tokens file_with_terms" << endl;
+        return 0;
+    }
+
+    vector<pair<string, uint32_t>> tokens;
+    vector<string> terms;
+
+    cout << "Reading tokens and terms..." << endl;
+    bool ok;
+    TIMING(ok = TokenMap::readText(argv[2], argv[3], tokens, terms));
+    if (!ok) {
+        cerr << "ERROR: Can't read " << argv[2] << " or " << argv[3] << endl;
+        return 1;
+    }
+
+    cout << "Building perfect hash of " << tokens.size() << " tokens and " << terms.size() << " terms..." << endl;
+    vector<char> data;
+    TIMING(ok = TokenMap::build(tokens, terms, data));
+    if (!ok) {
+        cerr << "ERROR: Can't build the perfect hash" << endl;
+        return 1;
+    }
+
+    if (!TokenMap::write(argv[1], data)) {
+        cerr << "ERROR: Can't write " << argv[1] << endl;
+        return 1;
+    }
+
+    TokenMap tokenMap;
+    if (!tokenMap.open(argv[1])) {
+        cerr << "ERROR: Can't map " << argv[1] << endl;
+        return 1;
+    }
+    for (auto &t : tokens) {
+        if (tokenMap.find(t.first) != t.second) {
+            cerr << "ERROR: Token '" << t.first << "' is mapped wrong" << endl;
+            return 1;
+        }
+    }
+
+    cout << "Wrote " << data.size() << " bytes to " << argv[1] << endl;
+    return 0;
+}
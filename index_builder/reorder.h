@@ -0,0 +1,204 @@
+#pragma once
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <algorithm>
+#include <numeric>
+#include <thread>
+#include <cmath>
+
+
+using namespace std;
+
+using TID = unsigned int;
+
+
+/* Orders of documents before doc ids are assigned, so that doc id gaps in postings get smaller */
+namespace Reorder {
+    const unsigned int BISECTION_ITERATIONS = 20;
+    const size_t MIN_PARTITION_SIZE = 16;
+
+
+    /* Titles by document names from the meta file of text_cleaner: id, url, title and source file separated by tabs */
+    unordered_map<string, string> readTitles(const string &metaFile) {
+        unordered_map<string, string> titles;
+        ifstream fin(metaFile);
+        string line;
+        while (getline(fin, line)) {
+            stringstream ss(line);
+            string id, url, title;
+            getline(ss, id, '\t');
+            getline(ss, url, '\t');
+            getline(ss, title, '\t');
+            titles[id] = title;
+        }
+        return titles;
+    }
+
+
+    /* Positions of documents sorted by title, documents without title keep their order after the others */
+    vector<size_t> byTitle(const vector<string> &names, const unordered_map<string, string> &titles) {
+
+        vector<pair<int, string>> keys;
+        for (auto &name : names) {
+            auto it = titles.find(name);
+            if (it == titles.end()) {
+                keys.emplace_back(1, "");
+            } else {
+                keys.emplace_back(0, it->second);
+            }
+        }
+
+        vector<size_t> order(names.size());
+        iota(order.begin(), order.end(), 0);
+        stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return keys[a] < keys[b]; });
+        return order;
+    }
+
+
+    /*
+     * Recursive graph bisection of Dhulipala et al. Documents of a partition
+     * are split in halves, then pairs of documents are swapped between the
+     * halves while it lowers the estimated cost of the log gaps of the terms
+     * in both halves. Halves are split further, independent ones in parallel.
+     */
+    class Bisection {
+    private:
+        struct Workspace {
+            vector<int> leftDegrees;
+            vector<int> rightDegrees;
+            vector<pair<float, size_t>> leftGains;
+            vector<pair<float, size_t>> rightGains;
+        };
+
+        const vector<vector<TID>> &docTerms;
+        size_t termsNum;
+        unsigned int parallelDepth;
+        vector<float> log2Table;
+
+        float cost(int deg1, float logn1, int deg2, float logn2) {
+            return deg1 * (logn1 - log2Table[deg1 + 1]) + deg2 * (logn2 - log2Table[deg2 + 1]);
+        }
+
+        void computeGains(
+            const vector<size_t> &docs, size_t begin, size_t end,
+            float logn1, float logn2,
+            const vector<int> &from, const vector<int> &to,
+            vector<pair<float, size_t>> &gains)
+        {
+            gains.clear();
+            for (size_t i = begin; i < end; i++) {
+                float gain = 0;
+                for (TID t : docTerms[docs[i]]) {
+                    gain += cost(from[t], logn1, to[t], logn2) - cost(from[t] - 1, logn1, to[t] + 1, logn2);
+                }
+                gains.emplace_back(gain, i);
+            }
+            sort(gains.begin(), gains.end(), [](const pair<float, size_t> &a, const pair<float, size_t> &b) {
+                return a.first > b.first || (a.first == b.first && a.second < b.second);
+            });
+        }
+
+        void bisect(vector<size_t> &docs, size_t begin, size_t end, Workspace &ws) {
+            size_t middle = begin + (end - begin) / 2;
+            float logn1 = log2(middle - begin);
+            float logn2 = log2(end - middle);
+
+            for (size_t i = begin; i < end; i++) {
+                auto &degrees = i < middle ? ws.leftDegrees : ws.rightDegrees;
+                for (TID t : docTerms[docs[i]]) {
+                    degrees[t]++;
+                }
+            }
+
+            for (unsigned int iter = 0; iter < BISECTION_ITERATIONS; iter++) {
+                computeGains(docs, begin, middle, logn1, logn2, ws.leftDegrees, ws.rightDegrees, ws.leftGains);
+                computeGains(docs, middle, end, logn2, logn1, ws.rightDegrees, ws.leftDegrees, ws.rightGains);
+
+                size_t swaps = 0;
+                for (size_t i = 0; i < ws.leftGains.size() && i < ws.rightGains.size(); i++) {
+                    if (ws.leftGains[i].first + ws.rightGains[i].first <= 0) break;
+
+                    size_t l = ws.leftGains[i].second;
+                    size_t r = ws.rightGains[i].second;
+                    for (TID t : docTerms[docs[l]]) {
+                        ws.leftDegrees[t]--;
+                        ws.rightDegrees[t]++;
+                    }
+                    for (TID t : docTerms[docs[r]]) {
+                        ws.rightDegrees[t]--;
+                        ws.leftDegrees[t]++;
+                    }
+                    swap(docs[l], docs[r]);
+                    swaps++;
+                }
+
+                if (swaps == 0) break;
+            }
+
+            for (size_t i = begin; i < end; i++) {
+                for (TID t : docTerms[docs[i]]) {
+                    ws.leftDegrees[t] = 0;
+                    ws.rightDegrees[t] = 0;
+                }
+            }
+        }
+
+        void newWorkspace(Workspace &ws) {
+            ws.leftDegrees.assign(termsNum, 0);
+            ws.rightDegrees.assign(termsNum, 0);
+        }
+
+        void run(vector<size_t> &docs, size_t begin, size_t end, unsigned int depth, Workspace &ws) {
+            if (end - begin <= MIN_PARTITION_SIZE) {
+                sort(docs.begin() + begin, docs.begin() + end);
+                return;
+            }
+
+            bisect(docs, begin, end, ws);
+
+            size_t middle = begin + (end - begin) / 2;
+            if (depth < parallelDepth) {
+                thread left([&]() {
+                    Workspace leftWs;
+                    newWorkspace(leftWs);
+                    run(docs, begin, middle, depth + 1, leftWs);
+                });
+                run(docs, middle, end, depth + 1, ws);
+                left.join();
+            } else {
+                run(docs, begin, middle, depth + 1, ws);
+                run(docs, middle, end, depth + 1, ws);
+            }
+        }
+    public:
+        /* docTerms are sorted term ids of every document, terms of one document don't matter */
+        Bisection(const vector<vector<TID>> &docTerms, size_t termsNum, unsigned int threadsNum) :
+            docTerms(docTerms), termsNum(termsNum)
+        {
+            parallelDepth = 0;
+            while ((1u << parallelDepth) < threadsNum) {
+                parallelDepth++;
+            }
+
+            log2Table.resize(docTerms.size() + 2);
+            for (size_t i = 1; i < log2Table.size(); i++) {
+                log2Table[i] = log2(i);
+            }
+        }
+
+        vector<size_t> order() {
+            vector<size_t> docs(docTerms.size());
+            iota(docs.begin(), docs.end(), 0);
+
+            Workspace ws;
+            newWorkspace(ws);
+            run(docs, 0, docs.size(), 0, ws);
+            return docs;
+        }
+    };
+};
@@ -0,0 +1,618 @@
+#include <iostream>
+#include <cstdlib>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <queue>
+#include <set>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <ctime>
+#include <cctype>
+#include <cerrno>
+#include <climits>
+
+#include "../index_segments.h"
+#include "../index_deletions.h"
+#include "../index_biwords.h"
+#include "index_files.h"
+
+
+time_t START_TIME;
+
+#define TIMING(s) START_TIME = time(0); s; std::cout << "* Done. Time: " << (time(0) - START_TIME) << " s" << endl;
+
+
+const unsigned int DEFAULT_MERGE_FACTOR = 10;
+const size_t MERGE_BATCH_SIZE = 1 << 26;
+const double MAX_DELETED_FRACTION = 0.3;
+const TID NO_DOC = -1;
+
+
+void print_help() {
+    cout << "usage:" << endl;
+    cout << "add index_directory segment_directory\tmoves the index built by index_builder into the segments, an index built into index_directory itself becomes the first segment, then merges like merge with the default factor" << endl;
+    cout << "merge index_directory [factor]\tmerges every factor adjacent segments of the same size tier, 10 by default" << endl;
+    cout << "optimize index_directory\tmerges all segments into one" << endl;
+    cout << "delete index_directory external_id...\tmarks the documents deleted, they are purged by merges; an engine serving the index reloads it on its next request" << endl;
+    cout << "gc index_directory\tremoves segments replaced by merges, the ones still loaded by an engine generation are kept until it is gone" << endl;
+}
+
+
+struct Segment {
+    string name;
+    string path;
+    Manifest::Header manifest;
+    vector<TID> deleted;
+
+    unsigned int liveDocsNum() const {
+        return manifest.docsNum - deleted.size();
+    }
+};
+
+
+bool readSegment(const string &indexDir, const string &name, Segment &segment) {
+    segment.name = name;
+    segment.path = indexDir + "/" + name;
+    if (!Manifest::read(segment.path + Manifest::FILE_PATH, segment.manifest)) {
+        cerr << "ERROR: Can't read manifest of '" << segment.path << "'" << endl;
+        return false;
+    }
+    if (segment.manifest.recordsPerFile != MAX_INDEX_BLOCK_SIZE) {
+        cerr << "ERROR: Segment '" << segment.path << "' has another index files layout" << endl;
+        return false;
+    }
+    segment.deleted.clear();
+    Deletions::read(segment.path + Deletions::FILE_PATH, segment.deleted);
+    return true;
+}
+
+
+/* Terms and biwords files, segments share term ids only if these are equal */
+uint64_t termsChecksum(const Segment &segment) {
+    uint64_t biwords = Manifest::fileChecksum(segment.path + Biwords::FILE_PATH);
+    return Manifest::checksum(&biwords, sizeof(biwords), Manifest::fileChecksum(segment.path + "/terms"));
+}
+
+
+/* Postings are merged by term id, so all segments must be built with the same dictionary */
+bool checkSameTerms(const vector<Segment> &segments) {
+    uint64_t checksum = termsChecksum(segments[0]);
+    for (size_t i = 1; i < segments.size(); i++) {
+        if (segments[i].manifest.termsNum != segments[0].manifest.termsNum ||
+            termsChecksum(segments[i]) != checksum)
+        {
+            cerr << "ERROR: Segments '" << segments[0].path << "' and '" << segments[i].path
+                 << "' are built with different terms" << endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+
+/* Number of a seg_N name, false for other names */
+bool parseSegmentName(const string &name, unsigned int &num) {
+    if (name.compare(0, 4, "seg_") != 0 || name.size() == 4 || !isdigit((unsigned char)name[4])) {
+        return false;
+    }
+    char *end;
+    errno = 0;
+    unsigned long n = strtoul(name.c_str() + 4, &end, 10);
+    if (*end != '\0' || errno != 0 || n >= UINT_MAX) {
+        return false;
+    }
+    num = n;
+    return true;
+}
+
+
+/* Next unused name like seg_N, names of removed segments are not reused */
+string newSegmentName(const string &indexDir) {
+    unsigned int n = 0;
+    for (auto &entry : fs::directory_iterator(indexDir)) {
+        unsigned int num;
+        if (parseSegmentName(entry.path().filename().string(), num)) {
+            n = max(n, num + 1);
+        }
+    }
+    return "seg_" + to_string(n);
+}
+
+
+/* New doc id of every document of the segment, NO_DOC for deleted ones */
+vector<TID> getNewDocIds(const Segment &segment, TID base) {
+    vector<TID> newIds(segment.manifest.docsNum);
+    for (TID docId : segment.deleted) {
+        newIds[docId] = NO_DOC;
+    }
+    for (TID docId = 0; docId < newIds.size(); docId++) {
+        if (newIds[docId] != NO_DOC) {
+            newIds[docId] = base++;
+        }
+    }
+    return newIds;
+}
+
+
+/* Writes positions records of the documents in the builder layout */
+class PositionsWriter {
+private:
+    string positionsDir;
+    ofstream fout;
+    TID docId;
+public:
+    PositionsWriter(const string &outputDir) : positionsDir(outputDir + POSITIONS_DIR_PATH), docId(0) {
+        fs::create_directories(positionsDir);
+    }
+
+    void write(const char *record, size_t size) {
+        if (docId % DOCS_PER_FILE == 0) {
+            TID fileNum = docId / DOCS_PER_FILE;
+            string dir = positionsDir + to_string(fileNum / MAX_POS_FILES_PER_DIR);
+            if (docId % (MAX_POS_FILES_PER_DIR * DOCS_PER_FILE) == 0) {
+                fs::create_directories(dir);
+            }
+            fout.close();
+            fout.open(dir + "/" + to_string(fileNum), ios_base::binary);
+        }
+
+        fout.write((char*)&docId, sizeof(TID));
+        fout.write(record + sizeof(TID), size - sizeof(TID));
+        docId++;
+    }
+};
+
+
+/* Positions records of the live segment documents in the doc id order */
+void copyPositions(const Segment &segment, const vector<TID> &newIds, PositionsWriter &writer) {
+    const Manifest::Header &m = segment.manifest;
+    vector<char> data;
+
+    for (TID fileNum = 0; fileNum * m.docsPerFile < m.docsNum; fileNum++) {
+        string fileName =
+            segment.path + POSITIONS_DIR_PATH +
+            to_string(fileNum / m.posFilesPerDir) + "/" + to_string(fileNum);
+        ifstream fin(fileName, ios_base::binary);
+        data.assign(istreambuf_iterator<char>(fin), istreambuf_iterator<char>());
+
+        size_t pos = 0;
+        while (pos < data.size()) {
+            size_t start = pos;
+            TID docId;
+            unsigned int termsNum;
+            memcpy(&docId, data.data() + pos, sizeof(TID));
+            memcpy(&termsNum, data.data() + pos + sizeof(TID), sizeof(unsigned int));
+            pos += sizeof(TID) + sizeof(unsigned int);
+
+            for (unsigned int i = 0; i < termsNum; i++) {
+                unsigned int bitCnt;
+                memcpy(&bitCnt, data.data() + pos + sizeof(TID), sizeof(unsigned int));
+                bitCnt &= (1u << (sizeof(unsigned int) * 8 - 1)) - 1;
+                pos += sizeof(TID) + sizeof(unsigned int) + (bitCnt + 7) / 8;
+            }
+
+            if (newIds[docId] != NO_DOC) {
+                writer.write(data.data() + start, pos - start);
+            }
+        }
+    }
+}
+
+
+/* TF data of the live documents, offsets are counted anew */
+void copyTF(const vector<Segment> &segments, const vector<vector<TID>> &newIds, const string &outputDir) {
+    ofstream foutTF(outputDir + TF_FILE_PATH, ios_base::binary);
+    ofstream foutTFOffsets(outputDir + TF_OFFSET_FILE_PATH, ios_base::binary);
+    unsigned int offset = 0;
+    vector<char> data;
+
+    for (size_t s = 0; s < segments.size(); s++) {
+        auto &segment = segments[s];
+
+        vector<unsigned int> offsets(segment.manifest.docsNum + 1);
+        FILE *fin = fopen((segment.path + TF_OFFSET_FILE_PATH).c_str(), "rb");
+        fread(offsets.data(), sizeof(unsigned int), offsets.size(), fin);
+        fclose(fin);
+
+        ifstream finTF(segment.path + TF_FILE_PATH, ios_base::binary);
+        for (TID i = 0; i < segment.manifest.docsNum; i++) {
+            data.resize(offsets[i + 1] - offsets[i]);
+            finTF.read(data.data(), data.size());
+            if (newIds[s][i] == NO_DOC) continue;
+
+            foutTFOffsets.write((char*)&offset, sizeof(unsigned int));
+            foutTF.write(data.data(), data.size());
+            offset += data.size();
+        }
+    }
+
+    foutTFOffsets.write((char*)&offset, sizeof(unsigned int));
+}
+
+
+/* Lines of the docs list and external ids of the live documents */
+void copyDocs(const vector<Segment> &segments, const vector<vector<TID>> &newIds, const string &outputDir) {
+    ofstream foutDocs(outputDir + "/docs");
+    ofstream foutExternalIds(outputDir + Manifest::EXTERNAL_IDS_FILE_PATH, ios_base::binary);
+
+    for (size_t s = 0; s < segments.size(); s++) {
+        ifstream finDocs(segments[s].path + "/docs");
+        vector<TID> externalIds(segments[s].manifest.docsNum);
+        FILE *fin = fopen((segments[s].path + Manifest::EXTERNAL_IDS_FILE_PATH).c_str(), "rb");
+        fread(externalIds.data(), sizeof(TID), externalIds.size(), fin);
+        fclose(fin);
+
+        string line;
+        for (TID i = 0; i < segments[s].manifest.docsNum; i++) {
+            getline(finDocs, line);
+            if (newIds[s][i] == NO_DOC) continue;
+
+            foutDocs << line << '\n';
+            foutExternalIds.write((char*)&externalIds[i], sizeof(TID));
+        }
+    }
+}
+
+
+/*
+ * Postings of a term are concatenated in the order of segments with new doc
+ * ids, deleted documents are dropped. Index files are merged one by one.
+ */
+unsigned int mergePostings(const vector<Segment> &segments, const vector<vector<TID>> &newIds, const string &outputDir) {
+    unsigned int threadsNum = max(1u, thread::hardware_concurrency());
+    unsigned int filesNum = 0;
+    for (auto &segment : segments) {
+        filesNum = max(filesNum, segment.manifest.indexFilesNum);
+    }
+
+    vector<pair<TID, vector<TID>>> records;
+    size_t recordsSize = 0;
+    vector<TID> docs;
+
+    for (unsigned int file = 0; file < filesNum; file++) {
+        vector<IndexFileReader*> readers;
+        for (auto &segment : segments) {
+            readers.push_back(new IndexFileReader(segment.path + "/" + to_string(file)));
+        }
+
+        using TItem = pair<TID, size_t>;
+        priority_queue<TItem, vector<TItem>, greater<TItem>> queue;
+        for (size_t i = 0; i < readers.size(); i++) {
+            if (!readers[i]->end()) queue.emplace(readers[i]->termId, i);
+        }
+
+        IndexFileWriter writer(outputDir + "/" + to_string(file), threadsNum);
+
+        while (!queue.empty()) {
+            TID term = queue.top().first;
+            records.push_back({term, vector<TID>()});
+            auto &merged = records.back().second;
+
+            while (!queue.empty() && queue.top().first == term) {
+                size_t i = queue.top().second;
+                queue.pop();
+
+                docs.clear();
+                readers[i]->decode(docs);
+                for (TID docId : docs) {
+                    if (newIds[i][docId] != NO_DOC) {
+                        merged.push_back(newIds[i][docId]);
+                    }
+                }
+
+                readers[i]->next();
+                if (!readers[i]->end()) queue.emplace(readers[i]->termId, i);
+            }
+
+            if (merged.empty()) {
+                records.pop_back();
+                continue;
+            }
+
+            recordsSize += merged.size() * sizeof(TID);
+            if (recordsSize >= MERGE_BATCH_SIZE) {
+                writer.write(records);
+                records.clear();
+                recordsSize = 0;
+            }
+        }
+
+        writer.write(records);
+        records.clear();
+        recordsSize = 0;
+        writer.close();
+
+        for (auto r : readers) {
+            delete r;
+        }
+    }
+
+    return filesNum;
+}
+
+
+/*
+ * Merges segments [first, last) of the list into a new segment in place
+ * of them, deleted documents are not copied.
+ */
+bool mergeSegments(const string &indexDir, vector<string> &names, size_t first, size_t last) {
+    vector<Segment> segments(last - first);
+    for (size_t i = first; i < last; i++) {
+        if (!readSegment(indexDir, names[i], segments[i - first])) {
+            return false;
+        }
+    }
+
+    if (!checkSameTerms(segments)) {
+        return false;
+    }
+
+    string name = newSegmentName(indexDir);
+    string outputDir = indexDir + "/" + name;
+    fs::create_directories(outputDir);
+
+    cout << "Merging " << segments.size() << " segments into " << name << "..." << endl;
+
+    vector<vector<TID>> newIds;
+    unsigned int docsNum = 0;
+    unsigned int termsNum = segments.front().manifest.termsNum;
+    for (auto &segment : segments) {
+        newIds.push_back(getNewDocIds(segment, docsNum));
+        docsNum += segment.liveDocsNum();
+    }
+
+    if (docsNum == 0) {
+        cerr << "ERROR: All documents of the segments are deleted, nothing to merge" << endl;
+        fs::remove_all(outputDir);
+        return false;
+    }
+
+    copyDocs(segments, newIds, outputDir);
+
+    fs::copy_file(segments.front().path + "/terms", outputDir + "/terms");
+    if (fs::exists(segments.front().path + Biwords::FILE_PATH)) {
+        fs::copy_file(segments.front().path + Biwords::FILE_PATH, outputDir + Biwords::FILE_PATH);
+    }
+
+    copyTF(segments, newIds, outputDir);
+
+    PositionsWriter positionsWriter(outputDir);
+    for (size_t i = 0; i < segments.size(); i++) {
+        copyPositions(segments[i], newIds[i], positionsWriter);
+    }
+
+    unsigned int indexFilesNum;
+    TIMING(indexFilesNum = mergePostings(segments, newIds, outputDir));
+
+    writeManifest(outputDir, docsNum, termsNum, indexFilesNum);
+
+    names.erase(names.begin() + first, names.begin() + last);
+    names.insert(names.begin() + first, name);
+    return Segments::write(indexDir + Segments::FILE_PATH, names);
+}
+
+
+/*
+ * Tiered policy: a segment is in tier floor(log_factor(live docs number)),
+ * factor adjacent segments of the same tier are merged into one of the next
+ * tier, so every document is rewritten about log_factor(N) times. A segment
+ * with more than MAX_DELETED_FRACTION deleted documents is rewritten alone.
+ */
+bool merge(const string &indexDir, vector<string> &names, unsigned int factor) {
+    bool merged = true;
+    while (merged) {
+        merged = false;
+
+        vector<int> tiers;
+        for (size_t i = 0; i < names.size(); i++) {
+            Segment segment;
+            if (!readSegment(indexDir, names[i], segment)) {
+                return false;
+            }
+            if (segment.deleted.size() > MAX_DELETED_FRACTION * segment.manifest.docsNum &&
+                segment.liveDocsNum() > 0)
+            {
+                if (!mergeSegments(indexDir, names, i, i + 1)) {
+                    return false;
+                }
+                merged = true;
+                break;
+            }
+            tiers.push_back(floor(log(max(1u, segment.liveDocsNum())) / log(factor)));
+        }
+        if (merged) continue;
+
+        for (size_t first = 0; first + factor <= names.size(); first++) {
+            size_t last = first + 1;
+            while (last < names.size() && tiers[last] == tiers[first]) {
+                last++;
+            }
+            if (last - first >= factor) {
+                if (!mergeSegments(indexDir, names, first, first + factor)) {
+                    return false;
+                }
+                merged = true;
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+
+/*
+ * Moves the segment directory into the index. An index directory built by
+ * index_builder without segments gets its index listed first as the base
+ * segment, so it keeps its files and doc ids, and the engine loading it
+ * goes on with them.
+ */
+bool add(const string &indexDir, vector<string> &names, const string &segmentDir) {
+    vector<Segment> segments(1);
+    if (!readSegment(fs::path(segmentDir).parent_path().string(), fs::path(segmentDir).filename().string(), segments[0])) {
+        return false;
+    }
+    if (names.empty() && fs::exists(indexDir + Manifest::FILE_PATH)) {
+        cout << "Listing the index of '" << indexDir << "' as the first segment" << endl;
+        names.push_back(Segments::BASE_NAME);
+    }
+    if (!names.empty()) {
+        segments.emplace_back();
+        if (!readSegment(indexDir, names.front(), segments[1]) || !checkSameTerms(segments)) {
+            return false;
+        }
+    }
+
+    string name = newSegmentName(indexDir);
+    fs::rename(segmentDir, indexDir + "/" + name);
+
+    names.push_back(name);
+    cout << "Added " << segments[0].manifest.docsNum << " documents as " << name << endl;
+    return Segments::write(indexDir + Segments::FILE_PATH, names);
+}
+
+
+/* Adds documents with the external ids to the deleted ones of every segment */
+bool remove(const string &indexDir, const vector<string> &names, const vector<TID> &externalIds) {
+    set<TID> ids(externalIds.begin(), externalIds.end());
+    size_t deletedNum = 0;
+
+    for (auto &name : names) {
+        Segment segment;
+        if (!readSegment(indexDir, name, segment)) {
+            return false;
+        }
+
+        vector<TID> segmentIds(segment.manifest.docsNum);
+        FILE *fin = fopen((segment.path + Manifest::EXTERNAL_IDS_FILE_PATH).c_str(), "rb");
+        fread(segmentIds.data(), sizeof(TID), segmentIds.size(), fin);
+        fclose(fin);
+
+        set<TID> deleted(segment.deleted.begin(), segment.deleted.end());
+        size_t oldSize = deleted.size();
+        for (TID docId = 0; docId < segmentIds.size(); docId++) {
+            if (ids.count(segmentIds[docId])) {
+                deleted.insert(docId);
+            }
+        }
+
+        if (deleted.size() != oldSize) {
+            deletedNum += deleted.size() - oldSize;
+            vector<TID> v(deleted.begin(), deleted.end());
+            if (!Deletions::write(segment.path + Deletions::FILE_PATH, v)) {
+                return false;
+            }
+        }
+    }
+
+    cout << "Deleted " << deletedNum << " documents" << endl;
+    return true;
+}
+
+
+/*
+ * Files of the base segment replaced by a merge are everything in the index
+ * directory but the segments and their list
+ */
+void removeBase(const string &indexDir) {
+    for (auto &entry : fs::directory_iterator(indexDir)) {
+        string name = entry.path().filename().string();
+        unsigned int num;
+        if (parseSegmentName(name, num) || "/" + name == Segments::FILE_PATH ||
+            "/" + name == Segments::LOCK_FILE_PATH || "/" + name == Segments::FILE_PATH + ".tmp")
+        {
+            continue;
+        }
+        fs::remove_all(entry.path());
+    }
+}
+
+
+/* Unlisted segments are removed unless an engine still holds their directory lock */
+void gc(const string &indexDir, const vector<string> &names) {
+    if (!names.empty() && find(names.begin(), names.end(), Segments::BASE_NAME) == names.end() &&
+        fs::exists(indexDir + Manifest::FILE_PATH))
+    {
+        int fd = Segments::lock(indexDir, LOCK_EX | LOCK_NB);
+        if (fd < 0) {
+            cout << "Keeping the base segment, it is still used" << endl;
+        } else {
+            cout << "Removing the base segment" << endl;
+            removeBase(indexDir);
+            Segments::unlock(fd);
+        }
+    }
+
+    for (auto &entry : fs::directory_iterator(indexDir)) {
+        string name = entry.path().filename().string();
+        unsigned int num;
+        if (!parseSegmentName(name, num) || find(names.begin(), names.end(), name) != names.end()) {
+            continue;
+        }
+        int fd = Segments::lock(entry.path().string(), LOCK_EX | LOCK_NB);
+        if (fd < 0) {
+            cout << "Keeping " << name << ", it is still used" << endl;
+            continue;
+        }
+        cout << "Removing " << name << endl;
+        fs::remove_all(entry.path());
+        Segments::unlock(fd);
+    }
+}
+
+
+int main(int argc, char *argv[]) {
+    if (argc < 3) {
+        print_help();
+        return 0;
+    }
+
+    string cmd(argv[1]);
+    string indexDir(argv[2]);
+
+    fs::create_directories(indexDir);
+
+    // Commands run one at a time: a delete during a merge would be lost
+    // with the replaced segment, and gc must not race the engine reading
+    // the list. The lock is released at exit.
+    int lock = Segments::lock(indexDir + Segments::LOCK_FILE_PATH, LOCK_EX, O_RDONLY | O_CREAT);
+    if (lock < 0) {
+        cerr << "ERROR: Can't lock '" << indexDir << Segments::LOCK_FILE_PATH << "'" << endl;
+        return 1;
+    }
+
+    vector<string> names;
+    Segments::read(indexDir + Segments::FILE_PATH, names);
+
+    bool ok = true;
+    if (cmd == "add" && argc == 4) {
+        ok = add(indexDir, names, argv[3]) && merge(indexDir, names, DEFAULT_MERGE_FACTOR);
+    } else if (cmd == "merge") {
+        unsigned int factor = argc > 3 ? stoul(argv[3]) : DEFAULT_MERGE_FACTOR;
+        ok = factor >= 2 && merge(indexDir, names, factor);
+    } else if (cmd == "optimize") {
+        bool hasDeleted = false;
+        for (auto &name : names) {
+            hasDeleted = hasDeleted || fs::exists(indexDir + "/" + name + Deletions::FILE_PATH);
+        }
+        ok = (names.size() < 2 && !hasDeleted) || mergeSegments(indexDir, names, 0, names.size());
+    } else if (cmd == "delete") {
+        vector<TID> externalIds;
+        for (int i = 3; i < argc; i++) {
+            externalIds.push_back(stoul(argv[i]));
+        }
+        ok = remove(indexDir, names, externalIds);
+    } else if (cmd == "gc") {
+        gc(indexDir, names);
+    } else {
+        print_help();
+        return 1;
+    }
+
+    if (!ok) {
+        cerr << "ERROR: Command '" << cmd << "' failed on '" << indexDir << "'" << endl;
+        return 1;
+    }
+    return 0;
+}
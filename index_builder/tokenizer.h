@@ -0,0 +1,224 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <cstring>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "fold_table.h"
+
+
+using namespace std;
+
+
+/*
+ * Tokenizer of text_cleaner/make_tokens.py in C++: UTF-8 text is folded by
+ * FoldTable (NFKD, combining characters removed, lowercased), tokens are runs
+ * of alphanumeric characters. Hangul syllables are decomposed by the formula,
+ * the table covers all the planes, so mathematical alphanumerics of plane 1
+ * fold to letters and digits and its scripts are kept. Capital sigma, also
+ * the one NFKD makes of others, becomes final sigma after a cased letter at
+ * the end of a token, case ignorable letters are skipped, as str.lower()
+ * does it.
+ *
+ * ASCII goes 16 bytes at once with SSE2, two-byte sequences (Cyrillic, Greek,
+ * Latin with accents) are looked up without the generic decoding.
+ */
+class Tokenizer {
+private:
+    string token;
+    bool lastCased;
+    // Position of the sigma of a capital one after a cased letter,
+    // it becomes final if the token ends or a not cased character follows
+    size_t sigmaPos;
+
+    void resolveSigma(bool nextCased) {
+        if (sigmaPos != string::npos) {
+            if (!nextCased) token[sigmaPos + 1] = (char)0x82;
+            sigmaPos = string::npos;
+        }
+    }
+
+    /* flags are FoldTable::CASED and FoldTable::CASE_IGNORABLE of the entry */
+    void append(uint32_t cp, uint32_t flags) {
+        if (!(flags & FoldTable::CASE_IGNORABLE)) {
+            bool cased = flags & FoldTable::CASED;
+            resolveSigma(cased);
+            lastCased = cased;
+        }
+        appendUtf8(token, cp);
+    }
+
+    static void appendUtf8(string &s, uint32_t cp) {
+        if (cp < 0x80) {
+            s += (char)cp;
+        } else if (cp < 0x800) {
+            s += (char)(0xC0 | (cp >> 6));
+            s += (char)(0x80 | (cp & 0x3F));
+        } else if (cp < 0x10000) {
+            s += (char)(0xE0 | (cp >> 12));
+            s += (char)(0x80 | ((cp >> 6) & 0x3F));
+            s += (char)(0x80 | (cp & 0x3F));
+        } else {
+            s += (char)(0xF0 | (cp >> 18));
+            s += (char)(0x80 | ((cp >> 12) & 0x3F));
+            s += (char)(0x80 | ((cp >> 6) & 0x3F));
+            s += (char)(0x80 | (cp & 0x3F));
+        }
+    }
+
+    /* Decodes the code point at data[i], i is moved past it, U+FFFD for bad sequences */
+    static uint32_t decodeUtf8(const unsigned char *data, size_t size, size_t &i) {
+        unsigned char c = data[i];
+        int n;
+        uint32_t cp;
+        if (c < 0xC2) { i++; return 0xFFFD; }
+        else if (c < 0xE0) { n = 1; cp = c & 0x1F; }
+        else if (c < 0xF0) { n = 2; cp = c & 0x0F; }
+        else if (c < 0xF5) { n = 3; cp = c & 0x07; }
+        else { i++; return 0xFFFD; }
+
+        if (i + n >= size) { i++; return 0xFFFD; }
+        for (int k = 1; k <= n; k++) {
+            if ((data[i + k] & 0xC0) != 0x80) { i++; return 0xFFFD; }
+            cp = (cp << 6) | (data[i + k] & 0x3F);
+        }
+        i += n + 1;
+        return cp;
+    }
+
+    template<typename F>
+    void flush(F &f) {
+        resolveSigma(false);
+        lastCased = false;
+        if (!token.empty()) {
+            f(token);
+            token.clear();
+        }
+    }
+
+    template<typename F>
+    void fold(uint32_t cp, F &f) {
+        if (cp >= FoldTable::HANGUL_FIRST && cp <= FoldTable::HANGUL_LAST) {
+            uint32_t s = cp - FoldTable::HANGUL_FIRST;
+            append(0x1100 + s / 588, 0);
+            append(0x1161 + (s % 588) / 28, 0);
+            if (s % 28) append(0x11A7 + s % 28, 0);
+            return;
+        }
+
+        if (cp >= FoldTable::CODE_POINTS) {
+            flush(f);
+            return;
+        }
+
+        uint32_t e = FoldTable::STAGE2[FoldTable::STAGE1[cp >> 8]][cp & 0xFF];
+        uint32_t flags = e & (FoldTable::CASED | FoldTable::CASE_IGNORABLE);
+        switch (e & FoldTable::KIND_MASK) {
+            case FoldTable::IDENTITY:
+                append(cp, flags);
+                break;
+            case FoldTable::SEPARATOR:
+                flush(f);
+                break;
+            case FoldTable::EXPANSION: {
+                const uint32_t *x = FoldTable::EXPANSIONS + (e & FoldTable::VALUE_MASK);
+                for (uint32_t k = 1; k <= x[0]; k++) {
+                    if (x[k] == 0) flush(f);
+                    else append(x[k], flags);
+                }
+                break;
+            }
+            default:
+                if ((e & FoldTable::SIGMA) && lastCased) {
+                    resolveSigma(true);
+                    sigmaPos = token.size();
+                    appendUtf8(token, e & FoldTable::VALUE_MASK);
+                    lastCased = true;
+                } else {
+                    append(e & FoldTable::VALUE_MASK, flags);
+                }
+        }
+    }
+
+    static bool isAsciiAlnum(unsigned char c) {
+        return (c >= '0' && c <= '9') || ((c | 0x20) >= 'a' && (c | 0x20) <= 'z');
+    }
+
+#ifdef __SSE2__
+    /* 16 ASCII bytes: bit i of the result is set if byte i is alphanumeric, letters are lowercased into out */
+    static unsigned int asciiBlock(__m128i v, char *out) {
+        const __m128i upperA = _mm_set1_epi8('A' - 1);
+        const __m128i upperZ = _mm_set1_epi8('Z' + 1);
+        const __m128i lowerA = _mm_set1_epi8('a' - 1);
+        const __m128i lowerZ = _mm_set1_epi8('z' + 1);
+        const __m128i digit0 = _mm_set1_epi8('0' - 1);
+        const __m128i digit9 = _mm_set1_epi8('9' + 1);
+
+        __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(v, upperA), _mm_cmplt_epi8(v, upperZ));
+        __m128i lower = _mm_and_si128(_mm_cmpgt_epi8(v, lowerA), _mm_cmplt_epi8(v, lowerZ));
+        __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(v, digit0), _mm_cmplt_epi8(v, digit9));
+
+        v = _mm_or_si128(v, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+        _mm_storeu_si128((__m128i*)out, v);
+
+        return _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(upper, lower), digit));
+    }
+#endif
+public:
+    /* Calls f(token) for every token of the text, token is a string reused between calls */
+    template<typename F>
+    void tokenize(const char *text, size_t size, F f) {
+        const unsigned char *data = (const unsigned char*)text;
+        token.clear();
+        lastCased = false;
+        sigmaPos = string::npos;
+
+        size_t i = 0;
+        while (i < size) {
+#ifdef __SSE2__
+            if (i + 16 <= size) {
+                __m128i v = _mm_loadu_si128((const __m128i*)(data + i));
+                if (_mm_movemask_epi8(v) == 0) {
+                    char folded[16];
+                    unsigned int alnum = asciiBlock(v, folded);
+                    unsigned int k = 0;
+                    while (k < 16) {
+                        unsigned int run = alnum >> k;
+                        if (run & 1) {
+                            unsigned int len = __builtin_ctz(~run);
+                            resolveSigma(folded[k] > '9');
+                            token.append(folded + k, len);
+                            lastCased = folded[k + len - 1] > '9';
+                            k += len;
+                        } else {
+                            flush(f);
+                            k += run == 0 ? 16 - k : __builtin_ctz(run);
+                        }
+                    }
+                    i += 16;
+                    continue;
+                }
+            }
+#endif
+            unsigned char c = data[i];
+            if (c < 0x80) {
+                if (isAsciiAlnum(c)) {
+                    append(c >= 'A' && c <= 'Z' ? c | 0x20 : c, c > '9' ? FoldTable::CASED : 0);
+                } else {
+                    flush(f);
+                }
+                i++;
+            } else if (c >= 0xC2 && c < 0xE0 && i + 1 < size && (data[i + 1] & 0xC0) == 0x80) {
+                fold(((c & 0x1F) << 6) | (data[i + 1] & 0x3F), f);
+                i += 2;
+            } else {
+                fold(decodeUtf8(data, size, i), f);
+            }
+        }
+
+        flush(f);
+    }
+};
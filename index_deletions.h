@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "codec.h"
+
+
+/*
+ * Deleted documents of a segment: sorted doc ids written as VB encoded gaps.
+ * The file is only replaced as a whole, the engine reads it at load and
+ * reloads the index when it is replaced.
+ */
+namespace Deletions {
+    const std::string FILE_PATH = "/deleted";
+
+    inline bool read(const std::string &path, std::vector<unsigned int> &docIds) {
+        FILE *fin = fopen(path.c_str(), "rb");
+        if (!fin) return false;
+
+        std::vector<int8_t> data;
+        int8_t buf[1 << 16];
+        size_t n;
+        while ((n = fread(buf, 1, sizeof(buf), fin)) > 0) {
+            data.insert(data.end(), buf, buf + n);
+        }
+        fclose(fin);
+
+        VB<unsigned int, int8_t> vb(data.data(), data.size());
+        unsigned int docId = 0;
+        while (!vb.end()) {
+            docId += vb.decodeNext();
+            docIds.push_back(docId);
+        }
+        return true;
+    }
+
+    inline bool write(const std::string &path, const std::vector<unsigned int> &docIds) {
+        std::vector<unsigned int> gaps;
+        unsigned int prev = 0;
+        for (unsigned int docId : docIds) {
+            gaps.push_back(docId - prev);
+            prev = docId;
+        }
+
+        std::vector<int8_t> data;
+        VB<unsigned int, int8_t>::encode(gaps, data);
+
+        std::string tmpPath = path + ".tmp";
+        FILE *fout = fopen(tmpPath.c_str(), "wb");
+        if (!fout) return false;
+        bool ok = fwrite(data.data(), 1, data.size(), fout) == data.size();
+        ok = fclose(fout) == 0 && ok;
+        return ok && std::rename(tmpPath.c_str(), path.c_str()) == 0;
+    }
+};
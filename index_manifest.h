@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstdio>
+#include <cstdint>
+#include <string>
+
+
+/*
+ * Binary description of a built index, written by index_builder last,
+ * so an index directory without manifest is incomplete or legacy.
+ */
+namespace Manifest {
+    const uint32_t MAGIC = 0x58444957; // "WIDX"
+    const uint32_t VERSION = 1;
+
+    const std::string FILE_PATH = "/manifest";
+    const std::string EXTERNAL_IDS_FILE_PATH = "/external_ids";
+
+    /* Codec ids, the same as the flag in the high bit of the encoded size */
+    const uint32_t CODEC_VB = 0;
+    const uint32_t CODEC_VHB = 1;
+
+    inline uint32_t codecMask(uint32_t codec) {
+        return 1u << codec;
+    }
+
+    const uint32_t KNOWN_CODECS = (1u << CODEC_VB) | (1u << CODEC_VHB);
+
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+
+        uint32_t docsNum;
+        uint32_t termsNum;
+
+        uint32_t indexFilesNum;
+        uint32_t recordsPerFile;
+        uint32_t docsPerFile;
+        uint32_t posFilesPerDir;
+
+        /* Masks of codecMask() of the codecs used for every kind of data */
+        uint32_t postingsCodecs;
+        uint32_t positionsCodecs;
+        uint32_t tfCodecs;
+        uint32_t reserved;
+
+        uint64_t tfSize;
+        uint64_t externalIdsChecksum;
+        uint64_t tfOffsetsChecksum;
+    };
+
+    /* FNV-1a, the state of the previous call can be passed to continue it */
+    inline uint64_t checksum(const void *data, size_t size, uint64_t h = 14695981039346656037ULL) {
+        const unsigned char *p = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            h ^= p[i];
+            h *= 1099511628211ULL;
+        }
+        return h;
+    }
+
+    inline uint64_t fileChecksum(const std::string &path) {
+        uint64_t h = checksum(nullptr, 0);
+        FILE *fin = fopen(path.c_str(), "rb");
+        if (!fin) return h;
+
+        char buf[1 << 16];
+        size_t n;
+        while ((n = fread(buf, 1, sizeof(buf), fin)) > 0) {
+            h = checksum(buf, n, h);
+        }
+
+        fclose(fin);
+        return h;
+    }
+
+    inline bool read(const std::string &path, Header &header) {
+        FILE *fin = fopen(path.c_str(), "rb");
+        if (!fin) return false;
+        bool ok = fread(&header, sizeof(Header), 1, fin) == 1;
+        fclose(fin);
+        return ok && header.magic == MAGIC;
+    }
+
+    inline bool write(const std::string &path, const Header &header) {
+        FILE *fout = fopen(path.c_str(), "wb");
+        if (!fout) return false;
+        bool ok = fwrite(&header, sizeof(Header), 1, fout) == 1;
+        return fclose(fout) == 0 && ok;
+    }
+};
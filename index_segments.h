@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+
+
+/*
+ * Segmented index is a directory with the list of segment subdirectories,
+ * every segment is a complete index built by index_builder. Doc ids of a
+ * segment follow the ones of the previous segments in the list. The list
+ * is only replaced as a whole, so a reader sees either the old or the new one.
+ * An index the directory had before it got the list is the segment BASE_NAME,
+ * its files stay where they are.
+ *
+ * Commands changing the segments hold LOCK_FILE_PATH exclusively. A reader
+ * holds it shared while it reads the list and locks every listed segment
+ * directory shared, and keeps the directory locks while it uses them.
+ * A replaced segment is removed only if its directory lock can be taken
+ * exclusively, so no loaded generation loses its files.
+ */
+namespace Segments {
+    const std::string FILE_PATH = "/segments";
+    const std::string LOCK_FILE_PATH = "/segments.lock";
+    const std::string BASE_NAME = ".";
+
+    /*
+     * flock of the file or directory with the operation, held until the
+     * returned descriptor is closed. -1 if the path can't be opened, or
+     * the lock is busy and LOCK_NB is given.
+     */
+    inline int lock(const std::string &path, int operation, int openFlags = O_RDONLY) {
+        int fd = open(path.c_str(), openFlags | O_CLOEXEC, 0644);
+        if (fd < 0) return -1;
+        if (flock(fd, operation) != 0) {
+            close(fd);
+            return -1;
+        }
+        return fd;
+    }
+
+    inline void unlock(int fd) {
+        if (fd >= 0) close(fd);
+    }
+
+    inline bool read(const std::string &path, std::vector<std::string> &names) {
+        std::ifstream fin(path);
+        if (!fin) return false;
+
+        std::string name;
+        while (fin >> name) {
+            names.push_back(name);
+        }
+        return true;
+    }
+
+    inline bool write(const std::string &path, const std::vector<std::string> &names) {
+        std::string tmpPath = path + ".tmp";
+        std::ofstream fout(tmpPath);
+        for (auto &name : names) {
+            fout << name << '\n';
+        }
+        fout.close();
+        if (!fout) return false;
+        return std::rename(tmpPath.c_str(), path.c_str()) == 0;
+    }
+};
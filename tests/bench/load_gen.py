@@ -0,0 +1,280 @@
+#! /usr/bin/python3
+# -*- coding: utf-8 -*-
+
+"""
+Replays a query log against the running engine over its pipes, the same
+way client.py talks to it: NEW_REQ opens a session, EXIST_REQ fetches
+its pages. Latency of a query is from its arrival to its last page.
+
+The engine serves one exchange at a time, so exchanges of the clients
+are serialized by a lock, the way several web workers would queue on the
+pipes. In open-loop mode queries arrive at a fixed rate whatever the
+engine does, and the latency counts the wait for the pipes. In closed-loop
+mode each of N clients sends its next query once the previous one is done.
+
+usage: load_gen.py queries.txt [--rate=QPS | --clients=N] [options]
+"""
+
+import argparse
+import json
+import os
+import random
+import struct
+import sys
+import threading
+import time
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '../../app/web'))
+import client
+
+
+PAGE_SIZE = 50
+PERCENTILES = [50, 95, 99, 99.9]
+CLASSES = ['single', 'free_text', 'boolean', 'quote']
+
+
+def query_class(q):
+    if '"' in q:
+        return 'quote'
+    if any(c in q for c in '&|!()'):
+        return 'boolean'
+    if len(q.split()) == 1:
+        return 'single'
+    return 'free_text'
+
+
+class Engine:
+    """Exchanges with the engine, one at a time, request ids are counted like the engine does."""
+
+    def __init__(self, pipes_dir):
+        self.request_pipe = os.path.join(pipes_dir, 'pipe_A')
+        self.response_pipe = os.path.join(pipes_dir, 'pipe_B')
+        self.lock = threading.Lock()
+        self.next_id = None
+
+    def _exchange(self, data):
+        with self.lock:
+            with open(self.request_pipe, 'wb') as fout:
+                fout.write(data)
+            with open(self.response_pipe, 'rb') as fin:
+                return fin.read()
+
+    def sync_ids(self):
+        """A batch of one query tells the id of the last session, the next ones follow it."""
+        s = b'0'
+        buffer = self._exchange(struct.pack('=cIII{}s'.format(len(s)), client.BATCH_REQ, 1, 0, len(s), s))
+        if buffer[:1] != client.OK or buffer[5:6] != client.OK_PAYLOAD:
+            return False
+        self.next_id = struct.unpack_from('=I', buffer, 6)[0] + 1
+        return True
+
+    def new_request(self, q):
+        """Session id of the query, None for a bad one."""
+        s = bytes(q, encoding='utf-8')
+        data = struct.pack('=cI{}s'.format(len(s)), client.NEW_REQ, len(s), s)
+        with self.lock:
+            with open(self.request_pipe, 'wb') as fout:
+                fout.write(data)
+            with open(self.response_pipe, 'rb') as fin:
+                buffer = fin.read()
+            # engine makes a session for a bad query too
+            id = self.next_id
+            self.next_id += 1
+        return id if buffer[:1] == client.OK else None
+
+    def page(self, id):
+        """Doc ids of the next page of the session, None if the engine refused."""
+        buffer = self._exchange(struct.pack('=cI', client.EXIST_REQ, id))
+        if buffer[:1] != client.OK_PAYLOAD:
+            return None
+        n = struct.unpack_from('=I', buffer, 1)[0]
+        return struct.unpack_from('={}I'.format(n), buffer, 5)
+
+
+class Stats:
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.latencies = {c: [] for c in CLASSES}
+        self.errors = {c: 0 for c in CLASSES}
+        self.start = None
+        self.finish = None
+
+    def add(self, cls, latency, ok):
+        with self.lock:
+            if ok:
+                self.latencies[cls].append(latency)
+            else:
+                self.errors[cls] += 1
+
+    @staticmethod
+    def percentile(sorted_values, p):
+        if not sorted_values:
+            return 0.0
+        i = min(len(sorted_values) - 1, int(p / 100.0 * len(sorted_values)))
+        return sorted_values[i]
+
+    def report(self):
+        elapsed = max(self.finish - self.start, 1e-9)
+        result = {'elapsed_sec': elapsed, 'classes': {}}
+        everything = []
+        for c in CLASSES + ['all']:
+            if c == 'all':
+                values = sorted(everything)
+                errors = sum(self.errors.values())
+            else:
+                values = sorted(self.latencies[c])
+                errors = self.errors[c]
+                everything.extend(values)
+            if not values and not errors:
+                continue
+            result['classes'][c] = {
+                'queries': len(values),
+                'errors': errors,
+                'qps': len(values) / elapsed,
+                'latency_ms': {'p{}'.format(p): self.percentile(values, p) * 1000 for p in PERCENTILES},
+            }
+        return result
+
+
+def run_query(engine, q, pages):
+    """True if the engine took the query and gave its pages."""
+    id = engine.new_request(q)
+    if id is None:
+        return False
+    for _ in range(pages):
+        docs = engine.page(id)
+        if docs is None:
+            return False
+        if len(docs) < PAGE_SIZE:
+            break
+    return True
+
+
+def closed_loop(engine, queries, args, stats):
+    position = [0]
+    position_lock = threading.Lock()
+    deadline = time.time() + args.duration if args.duration else None
+
+    def next_query():
+        with position_lock:
+            if position[0] >= args.queries or (deadline and time.time() > deadline):
+                return None, False
+            i = position[0]
+            position[0] += 1
+            return queries[i % len(queries)], i >= args.warmup
+
+    def worker():
+        while True:
+            q, counted = next_query()
+            if q is None:
+                return
+            start = time.time()
+            ok = run_query(engine, q, args.pages)
+            if counted:
+                stats.add(query_class(q), time.time() - start, ok)
+
+    threads = [threading.Thread(target=worker) for _ in range(args.clients)]
+    stats.start = time.time()
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    stats.finish = time.time()
+
+
+def open_loop(engine, queries, args, stats):
+    rng = random.Random(args.seed)
+    inflight = threading.Semaphore(args.max_inflight)
+    threads = []
+
+    def task(q, arrival, counted):
+        try:
+            ok = run_query(engine, q, args.pages)
+            if counted:
+                stats.add(query_class(q), time.time() - arrival, ok)
+        finally:
+            inflight.release()
+
+    stats.start = time.time()
+    arrival = stats.start
+    deadline = stats.start + args.duration if args.duration else None
+    for i in range(args.queries):
+        if deadline and arrival > deadline:
+            break
+        delay = arrival - time.time()
+        if delay > 0:
+            time.sleep(delay)
+        inflight.acquire()
+        q = queries[i % len(queries)]
+        t = threading.Thread(target=task, args=(q, arrival, i >= args.warmup))
+        t.start()
+        threads.append(t)
+        arrival += rng.expovariate(args.rate) if args.poisson else 1.0 / args.rate
+    for t in threads:
+        t.join()
+    stats.finish = time.time()
+
+
+def print_report(report):
+    print('{:>10} {:>8} {:>7} {:>9} {:>9} {:>9} {:>9} {:>9}'.format(
+        'class', 'queries', 'errors', 'qps', 'p50 ms', 'p95 ms', 'p99 ms', 'p99.9 ms'))
+    for c, r in report['classes'].items():
+        l = r['latency_ms']
+        print('{:>10} {:>8} {:>7} {:>9.1f} {:>9.2f} {:>9.2f} {:>9.2f} {:>9.2f}'.format(
+            c, r['queries'], r['errors'], r['qps'], l['p50'], l['p95'], l['p99'], l['p99.9']))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Query log replay against the engine pipes')
+    parser.add_argument('log', help='queries in the engine syntax, one per line')
+    parser.add_argument('--pipes', default='..', help='directory with pipe_A and pipe_B, .. like client.py')
+    parser.add_argument('--rate', type=float, help='open loop: queries per second')
+    parser.add_argument('--poisson', action='store_true', help='open loop: exponential gaps instead of fixed ones')
+    parser.add_argument('--max-inflight', type=int, default=256, help='open loop: queries waiting at once')
+    parser.add_argument('--clients', type=int, default=1, help='closed loop: concurrent clients')
+    parser.add_argument('--queries', type=int, help='queries to send, the log is repeated if needed, the log size by default')
+    parser.add_argument('--duration', type=float, help='stop sending after this many seconds')
+    parser.add_argument('--warmup', type=int, default=0, help='first queries are sent but not counted')
+    parser.add_argument('--pages', type=int, default=1, help='EXIST_REQ pages per query')
+    parser.add_argument('--shuffle', action='store_true', help='replay the log in a random order of --seed')
+    parser.add_argument('--seed', type=int, default=1)
+    parser.add_argument('--json', help='report as JSON to this file, - for stdout')
+    args = parser.parse_args()
+
+    with open(args.log, encoding='utf-8') as fin:
+        queries = [l.strip() for l in fin if l.strip()]
+    if not queries:
+        print('Empty query log')
+        return 1
+    if args.shuffle:
+        random.Random(args.seed).shuffle(queries)
+    if args.queries is None:
+        args.queries = len(queries)
+
+    engine = Engine(args.pipes)
+    if not engine.sync_ids():
+        print("Can't get request ids from the engine")
+        return 1
+
+    stats = Stats()
+    if args.rate:
+        open_loop(engine, queries, args, stats)
+    else:
+        closed_loop(engine, queries, args, stats)
+
+    report = stats.report()
+    report['mode'] = 'open' if args.rate else 'closed'
+    report['rate'] = args.rate
+    report['clients'] = None if args.rate else args.clients
+    print_report(report)
+
+    if args.json == '-':
+        print(json.dumps(report, indent=2))
+    elif args.json:
+        with open(args.json, 'w') as fout:
+            json.dump(report, fout, indent=2)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,277 @@
+#include <iostream>
+#include <fstream>
+#include <experimental/filesystem>
+#include <vector>
+#include <string>
+#include <map>
+#include <set>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <ctime>
+
+#include "synthetic.h"
+
+
+time_t START_TIME;
+
+#define TIMING(s) START_TIME = time(0); s; std::cout << "* Done. Time: " << (time(0) - START_TIME) << " s" << endl;
+
+
+using namespace std;
+
+namespace fs = std::experimental::filesystem;
+
+
+const unsigned int DOCS_PER_DIR = 1000;
+
+
+struct Options {
+    uint64_t seed = 1;
+    size_t docs = 10000;
+    uint32_t vocabulary = 100000;
+    double zipf = 1.0;
+    double length = 300;
+    double lengthSigma = 0.8;
+    uint32_t phrases = 1000;
+    double phraseRate = 2;
+    size_t queries = 1000;
+    unsigned int threads = thread::hardware_concurrency();
+};
+
+
+void print_help() {
+    cout << "usage: make_corpus.out output_directory [options]" << endl;
+    cout << "writes output_directory/corpus/ of token files, dict.txt (word of term id i on line i)," << endl;
+    cout << "phrases.txt, biwords.txt (adjacent word pairs of the phrases for --biwords of index_builder)," << endl;
+    cout << "queries.txt and params, all of them are the same for the same options" << endl;
+    cout << "options:" << endl;
+    cout << "--seed=N\t1 by default" << endl;
+    cout << "--docs=N\t10000 by default" << endl;
+    cout << "--vocabulary=N\twords, 100000 by default" << endl;
+    cout << "--zipf=S\texponent of word frequencies, 1.0 by default" << endl;
+    cout << "--length=N\tmean words per document, log-normal, 300 by default" << endl;
+    cout << "--length-sigma=S\tsigma of the log-normal length, 0.8 by default" << endl;
+    cout << "--phrases=N\tphrases of 2-4 words injected into documents, 1000 by default" << endl;
+    cout << "--phrase-rate=R\tmean phrases per document, 2 by default" << endl;
+    cout << "--queries=N\tqueries of the index in the engine syntax, 1000 by default" << endl;
+    cout << "--threads=N\tall cores by default, doesn't change the output" << endl;
+}
+
+
+bool parseOptions(int &argc, char *argv[], Options &o) {
+    int n = 0;
+    for (int i = 0; i < argc; i++) {
+        string arg(argv[i]);
+        if (i == 0 || arg.compare(0, 2, "--") != 0) {
+            argv[n++] = argv[i];
+            continue;
+        }
+
+        size_t eq = arg.find('=');
+        if (eq == string::npos) return false;
+        string name = arg.substr(2, eq - 2);
+        string value = arg.substr(eq + 1);
+        try {
+            if (name == "seed") o.seed = stoull(value);
+            else if (name == "docs") o.docs = stoull(value);
+            else if (name == "vocabulary") o.vocabulary = stoul(value);
+            else if (name == "zipf") o.zipf = stod(value);
+            else if (name == "length") o.length = stod(value);
+            else if (name == "length-sigma") o.lengthSigma = stod(value);
+            else if (name == "phrases") o.phrases = stoul(value);
+            else if (name == "phrase-rate") o.phraseRate = stod(value);
+            else if (name == "queries") o.queries = stoull(value);
+            else if (name == "threads") o.threads = stoul(value);
+            else return false;
+        } catch (...) {
+            return false;
+        }
+    }
+    argc = n;
+    if (o.threads == 0) o.threads = 1;
+    return o.vocabulary >= 8 && o.length >= 1;
+}
+
+
+/* Phrases of words of the middle of the distribution, frequent words make no interesting phrases */
+vector<vector<uint32_t>> makePhrases(const Options &o) {
+    Random random = Random::stream(o.seed, -1);
+    uint32_t lo = min<uint32_t>(100, o.vocabulary / 8);
+    uint32_t hi = min<uint32_t>(o.vocabulary, 100 * lo);
+
+    vector<vector<uint32_t>> phrases(o.phrases);
+    for (auto &p : phrases) {
+        p.resize(2 + random.below(3));
+        for (auto &w : p) {
+            w = lo + random.below(hi - lo);
+        }
+    }
+    return phrases;
+}
+
+
+/* Words of the document docId, it depends only on the seed and docId */
+void makeDocument(const Options &o, const Zipf &zipf, const vector<vector<uint32_t>> &phrases, size_t docId, vector<uint32_t> &words) {
+    Random random = Random::stream(o.seed, docId);
+
+    size_t length = max<size_t>(1, (size_t)random.logNormal(o.length, o.lengthSigma));
+    words.resize(length);
+    for (auto &w : words) {
+        w = zipf(random);
+    }
+
+    if (phrases.empty()) return;
+    size_t injected = (size_t)o.phraseRate + (random.uniform() < o.phraseRate - (size_t)o.phraseRate);
+    for (size_t i = 0; i < injected; i++) {
+        auto &p = phrases[zipf(random) % phrases.size()];
+        if (p.size() > words.size()) continue;
+        size_t pos = random.below(words.size() - p.size() + 1);
+        copy(p.begin(), p.end(), words.begin() + pos);
+    }
+}
+
+
+void writeDocuments(const Options &o, const vector<vector<uint32_t>> &phrases, const string &corpusDir) {
+    Zipf zipf(o.vocabulary, o.zipf);
+    for (size_t d = 0; d * DOCS_PER_DIR < o.docs; d++) {
+        fs::create_directories(corpusDir + "/" + to_string(d));
+    }
+
+    atomic<size_t> nextDoc(0);
+    vector<thread> workers;
+    for (unsigned int t = 0; t < o.threads; t++) {
+        workers.emplace_back([&]() {
+            vector<uint32_t> words;
+            string text;
+            size_t docId;
+            while ((docId = nextDoc++) < o.docs) {
+                makeDocument(o, zipf, phrases, docId, words);
+                text.clear();
+                for (auto w : words) {
+                    text += syntheticWord(w);
+                    text += ' ';
+                }
+                ofstream fout(corpusDir + "/" + to_string(docId / DOCS_PER_DIR) + "/" + to_string(docId));
+                fout << text;
+            }
+        });
+    }
+    for (auto &w : workers) {
+        w.join();
+    }
+}
+
+
+string joinWords(const vector<uint32_t> &words) {
+    string s;
+    for (auto w : words) {
+        if (!s.empty()) s += ' ';
+        s += to_string(w);
+    }
+    return s;
+}
+
+
+/*
+ * Queries in the engine syntax by class: single term, free text, boolean
+ * and quote. Terms are drawn by frequency like the words of documents,
+ * every fourth single term is a uniformly drawn, mostly rare, one.
+ */
+void writeQueries(const Options &o, const vector<vector<uint32_t>> &phrases, const string &fileName) {
+    Random random = Random::stream(o.seed, -2);
+    Zipf zipf(o.vocabulary, o.zipf);
+    ofstream fout(fileName);
+
+    for (size_t i = 0; i < o.queries; i++) {
+        uint32_t a = zipf(random);
+        uint32_t b = zipf(random);
+        uint32_t c = zipf(random);
+        switch (i % 4) {
+        case 0:
+            fout << (i % 16 == 0 ? random.below(o.vocabulary) : a);
+            break;
+        case 1: {
+            vector<uint32_t> words(2 + random.below(3));
+            for (auto &w : words) w = zipf(random);
+            fout << joinWords(words);
+            break;
+        }
+        case 2:
+            switch (random.below(4)) {
+            case 0: fout << a << ' ' << b << " &"; break;
+            case 1: fout << a << ' ' << b << " |"; break;
+            case 2: fout << a << ' ' << b << " & " << c << " |"; break;
+            default: fout << a << ' ' << b << " ! &"; break;
+            }
+            break;
+        default:
+            if (phrases.empty()) {
+                fout << "\" " << a << ' ' << b << " \"";
+            } else {
+                auto &p = phrases[random.below(phrases.size())];
+                fout << "\" " << joinWords(p) << (random.below(4) == 0 ? " /" + to_string(p.size() + 2) : "") << " \"";
+            }
+            break;
+        }
+        fout << '\n';
+    }
+}
+
+
+/*
+ * Zipf distributed corpus for benchmarks. Term ids of the index that
+ * index_builder makes of it with dict.txt as both the tokens and the terms
+ * are the ranks of the words, so the queries can name them.
+ */
+int main(int argc, char *argv[]) {
+    Options o;
+    if (!parseOptions(argc, argv, o) || argc < 2) {
+        print_help();
+        return argc < 2 ? 0 : 1;
+    }
+
+    string outputDir(argv[1]);
+    fs::create_directories(outputDir);
+
+    ofstream fparams(outputDir + "/params");
+    fparams << "seed " << o.seed << "\ndocs " << o.docs << "\nvocabulary " << o.vocabulary << "\nzipf " << o.zipf
+            << "\nlength " << o.length << "\nlength-sigma " << o.lengthSigma << "\nphrases " << o.phrases
+            << "\nphrase-rate " << o.phraseRate << "\nqueries " << o.queries << endl;
+    fparams.close();
+
+    ofstream fdict(outputDir + "/dict.txt");
+    for (uint32_t r = 0; r < o.vocabulary; r++) {
+        fdict << syntheticWord(r) << '\n';
+    }
+    fdict.close();
+
+    auto phrases = makePhrases(o);
+    ofstream fphrases(outputDir + "/phrases.txt");
+    for (auto &p : phrases) {
+        for (size_t i = 0; i < p.size(); i++) {
+            fphrases << (i ? " " : "") << syntheticWord(p[i]);
+        }
+        fphrases << '\n';
+    }
+    fphrases.close();
+
+    // index_builder takes biwords of two words, a phrase gives its adjacent pairs
+    set<pair<uint32_t, uint32_t>> pairs;
+    ofstream fbiwords(outputDir + "/biwords.txt");
+    for (auto &p : phrases) {
+        for (size_t i = 0; i + 1 < p.size(); i++) {
+            if (pairs.insert({p[i], p[i + 1]}).second) {
+                fbiwords << syntheticWord(p[i]) << ' ' << syntheticWord(p[i + 1]) << '\n';
+            }
+        }
+    }
+    fbiwords.close();
+
+    cout << "Writing " << o.docs << " documents..." << endl;
+    fs::remove_all(outputDir + "/corpus");
+    TIMING(writeDocuments(o, phrases, outputDir + "/corpus"));
+
+    writeQueries(o, phrases, outputDir + "/queries.txt");
+    return 0;
+}
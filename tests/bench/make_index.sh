@@ -0,0 +1,27 @@
+#!/bin/bash
+# usage: make_index.sh output_dir docs_num [seed] [make_corpus options]
+# The index goes to output_dir/index, INDEX_OPTIONS are passed to index_builder,
+# e.g. INDEX_OPTIONS="--biwords=output_dir/biwords.txt --reorder=bisection"
+set -e
+
+if [ $# -lt 2 ]; then
+    echo "usage: make_index.sh output_dir docs_num [seed] [make_corpus options]"
+    exit 1
+fi
+
+BENCH_DIR=$(cd "$(dirname "$0")" && pwd)
+OUT=$1
+DOCS=$2
+SEED=${3:-1}
+shift $(( $# < 3 ? $# : 3 ))
+
+make -s -C "$BENCH_DIR"
+make -s -C "$BENCH_DIR/../../index_builder"
+
+echo "generating corpus..."
+"$BENCH_DIR/make_corpus.out" "$OUT" --docs=$DOCS --seed=$SEED "$@"
+
+echo "building index..."
+rm -rf "$OUT/index"
+mkdir -p "$OUT/index"
+time "$BENCH_DIR/../../index_builder/index_builder.out" "$OUT/index" "$OUT/dict.txt" "$OUT/dict.txt" "$OUT/corpus" $INDEX_OPTIONS
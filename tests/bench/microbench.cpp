@@ -0,0 +1,357 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <functional>
+
+#include "../../app/engine/query_parser.h"
+#include "synthetic.h"
+
+using namespace std;
+using namespace chrono;
+
+
+struct Options {
+    uint64_t seed = 1;
+    size_t lists = 200;
+    double length = 10000;
+    string lengthDist = "lognormal";
+    double density = 0.01;
+    size_t ops = 200;
+    string index;
+    string json;
+};
+
+
+/* Latencies of the operations of a benchmark, units are the postings, ints, jumps or queries of its time */
+struct Result {
+    string name;
+    string unit;
+    vector<double> latencies;
+    double units = 0;
+    double ns = 0;
+    double bytesPerPosting = -1;
+
+    void add(double latency, double n) {
+        latencies.push_back(latency);
+        units += n;
+        ns += latency;
+    }
+
+    double percentile(double p) {
+        sort(latencies.begin(), latencies.end());
+        if (latencies.empty()) return 0;
+        return latencies[min(latencies.size() - 1, (size_t)(p / 100 * latencies.size()))];
+    }
+
+    double unitsPerSec() const {
+        return ns > 0 ? units / ns * 1e9 : 0;
+    }
+};
+
+
+void print_help() {
+    cout << "usage: microbench.out [options]" << endl;
+    cout << "codecs run on generated postings, iterators on the index of --index" << endl;
+    cout << "options:" << endl;
+    cout << "--seed=N\t1 by default" << endl;
+    cout << "--lists=N\tgenerated posting lists, 200 by default" << endl;
+    cout << "--length=N\tmean postings per list, 10000 by default" << endl;
+    cout << "--length-dist=fixed|lognormal\tlognormal by default" << endl;
+    cout << "--density=D\tshare of documents with the term, gaps are geometric, 0.01 by default" << endl;
+    cout << "--index=DIR\tindex for the iterator benchmarks, e.g. of tests/bench/make_index.sh" << endl;
+    cout << "--ops=N\tqueries per iterator benchmark, 200 by default" << endl;
+    cout << "--json=FILE\tresults as JSON, - for stdout" << endl;
+}
+
+
+bool parseOptions(int argc, char *argv[], Options &o) {
+    for (int i = 1; i < argc; i++) {
+        string arg(argv[i]);
+        size_t eq = arg.find('=');
+        if (arg.compare(0, 2, "--") != 0 || eq == string::npos) return false;
+        string name = arg.substr(2, eq - 2);
+        string value = arg.substr(eq + 1);
+        try {
+            if (name == "seed") o.seed = stoull(value);
+            else if (name == "lists") o.lists = stoull(value);
+            else if (name == "length") o.length = stod(value);
+            else if (name == "length-dist") o.lengthDist = value;
+            else if (name == "density") o.density = stod(value);
+            else if (name == "ops") o.ops = stoull(value);
+            else if (name == "index") o.index = value;
+            else if (name == "json") o.json = value;
+            else return false;
+        } catch (...) {
+            return false;
+        }
+    }
+    return (o.lengthDist == "fixed" || o.lengthDist == "lognormal") && o.density > 0 && o.density <= 1 && o.length >= 1;
+}
+
+
+template<typename F>
+double measure(F f) {
+    auto start = steady_clock::now();
+    f();
+    return duration_cast<nanoseconds>(steady_clock::now() - start).count();
+}
+
+
+/* Doc id gaps of the lists like index_builder makes them */
+vector<vector<TID>> makeGaps(const Options &o) {
+    Random random(o.seed);
+    vector<vector<TID>> lists(o.lists);
+    for (auto &gaps : lists) {
+        size_t n = o.lengthDist == "fixed" ? (size_t)o.length : max<size_t>(1, (size_t)random.logNormal(o.length, 1.0));
+        gaps.resize(n);
+        for (auto &g : gaps) {
+            g = o.density >= 1 ? 1 : 1 + (TID)(log(1.0 - random.uniform()) / log(1.0 - o.density));
+        }
+        gaps[0]--;
+    }
+    return lists;
+}
+
+
+template<typename TCodec>
+void benchCodec(const string &name, const vector<vector<TID>> &lists, vector<Result> &results) {
+    Result encode{name + "_encode", "ints"};
+    Result decode{name + "_decode", "ints"};
+    Result jumps{name + "_decode_with_jumps", "ints"};
+    size_t bytes = 0, jumpedBytes = 0, postings = 0;
+
+    vector<int8_t> encoded;
+    vector<TID> jumped;
+    volatile TID sink = 0;
+    for (auto &gaps : lists) {
+        encoded.clear();
+        encode.add(measure([&]() { TCodec::encode(gaps, encoded); }), gaps.size());
+        bytes += encoded.size();
+        postings += gaps.size();
+
+        decode.add(measure([&]() {
+            TCodec codec(encoded.data(), encoded.size());
+            TID sum = 0;
+            while (!codec.end()) sum += codec.decodeNext();
+            sink = sink + sum;
+        }), gaps.size());
+
+        jumped.clear();
+        Jump::insertJumps<TCodec, TID>(gaps, jumped);
+        encoded.clear();
+        TCodec::encode(jumped, encoded);
+        jumpedBytes += encoded.size();
+        jumps.add(measure([&]() {
+            TCodec codec(encoded.data(), encoded.size());
+            TID sum = 0;
+            while (!codec.end()) sum += codec.decodeNext();
+            sink = sink + sum;
+        }), gaps.size());
+    }
+
+    encode.bytesPerPosting = decode.bytesPerPosting = (double)bytes / postings;
+    jumps.bytesPerPosting = (double)jumpedBytes / postings;
+    results.push_back(encode);
+    results.push_back(decode);
+    results.push_back(jumps);
+}
+
+
+/* Runs make(a, b) of the sampled term pairs twice, the first run loads the records and isn't counted */
+void benchIterator(
+    const string &name, const vector<pair<TID, TID>> &terms,
+    function<IndexIterator*(TID, TID)> make, vector<Result> &results)
+{
+    Result r{name, "postings"};
+    for (int run = 0; run < 2; run++) {
+        for (auto &t : terms) {
+            double postings = 0;
+            double latency = measure([&]() {
+                IndexIterator *it = make(t.first, t.second);
+                postings = it->len();
+                volatile TID sink = 0;
+                while (!it->end()) {
+                    sink = it->get();
+                    it->next();
+                }
+                delete it;
+            });
+            if (run == 1) {
+                r.add(latency, postings);
+            }
+        }
+    }
+    results.push_back(r);
+}
+
+
+/* Jumps wherever the skip list has one, a jump past the end is rolled back */
+void benchJumps(Index *index, const vector<pair<TID, TID>> &terms, vector<Result> &results) {
+    Result r{"simple_jump", "jumps"};
+    for (int run = 0; run < 2; run++) {
+        for (auto &t : terms) {
+            double jumps = 0;
+            double latency = measure([&]() {
+                SimpleIterator it(index, t.first);
+                while (!it.end()) {
+                    if (it.isJump()) {
+                        it.jump();
+                        jumps++;
+                        if (it.end()) {
+                            it.rollback();
+                            it.next();
+                        }
+                    } else {
+                        it.next();
+                    }
+                }
+            });
+            // latency of a jump is the mean of the list, a single one is below the timer resolution
+            if (run == 1 && jumps > 0) {
+                r.latencies.push_back(latency / jumps);
+                r.units += jumps;
+                r.ns += latency;
+            }
+        }
+    }
+    results.push_back(r);
+}
+
+
+/* First page of ranked free text queries of 2-3 terms, lazy or full paging */
+void benchRank(SegmentedIndex *index, const Zipf &zipf, Random random, size_t ops, bool lazy, vector<Result> &results) {
+    vector<string> queries;
+    for (size_t i = 0; i < ops; i++) {
+        string q;
+        for (size_t k = 2 + random.below(2); k > 0; k--) {
+            q += to_string(zipf(random)) + " ";
+        }
+        queries.push_back(q);
+    }
+
+    Result r{lazy ? "rank_top50_lazy" : "rank_top50", "queries"};
+    for (int run = 0; run < 2; run++) {
+        for (auto &q : queries) {
+            double latency = measure([&]() {
+                RankDecorator *it = getIterator(index, q, lazy);
+                volatile TID sink = 0;
+                for (int k = 0; it && k < 50 && !it->end(); k++) {
+                    sink = it->get();
+                    it->next();
+                }
+                delete it;
+            });
+            if (run == 1) {
+                r.add(latency, 1);
+            }
+        }
+    }
+    results.push_back(r);
+}
+
+
+size_t countLines(const string &fileName) {
+    ifstream fin(fileName);
+    string s;
+    size_t n = 0;
+    while (getline(fin, s)) n++;
+    return n;
+}
+
+
+void writeJson(ostream &out, const Options &o, vector<Result> &results) {
+    out << "{\n  \"params\": {\"seed\": " << o.seed << ", \"lists\": " << o.lists << ", \"length\": " << o.length
+        << ", \"length_dist\": \"" << o.lengthDist << "\", \"density\": " << o.density << ", \"ops\": " << o.ops
+        << ", \"index\": \"" << o.index << "\"},\n  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        auto &r = results[i];
+        out << "    {\"name\": \"" << r.name << "\", \"unit\": \"" << r.unit << "\", \"ops\": " << r.latencies.size()
+            << ", \"units_per_sec\": " << r.unitsPerSec()
+            << ", \"latency_ns\": {\"p50\": " << r.percentile(50) << ", \"p90\": " << r.percentile(90)
+            << ", \"p99\": " << r.percentile(99) << ", \"max\": " << r.percentile(100) << "}";
+        if (r.bytesPerPosting >= 0) out << ", \"bytes_per_posting\": " << r.bytesPerPosting;
+        out << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}" << endl;
+}
+
+
+/*
+ * Codec, skip and iterator benchmarks. Iterator benchmarks sample term
+ * pairs by Zipf over the term ids, so on the index of make_index.sh they
+ * follow the word frequencies of its corpus.
+ */
+int main(int argc, char *argv[]) {
+    Options o;
+    if (!parseOptions(argc, argv, o)) {
+        print_help();
+        return 1;
+    }
+
+    vector<Result> results;
+
+    auto lists = makeGaps(o);
+    benchCodec<VB<TID, int8_t>>("vb", lists, results);
+    benchCodec<VHB<TID, int8_t>>("vhb", lists, results);
+    lists.clear();
+
+    if (!o.index.empty()) {
+        SegmentedIndex index(o.index);
+        if (!index.isLoaded()) {
+            cerr << "ERROR: Can't load index '" << o.index << "'" << endl;
+            return 1;
+        }
+        Index *segment = index.segment(0);
+
+        size_t termsNum = countLines(o.index + "/terms");
+        if (termsNum == 0) {
+            cerr << "ERROR: No terms in '" << o.index << "'" << endl;
+            return 1;
+        }
+        Zipf zipf(termsNum, 1.0);
+        Random random(o.seed);
+        vector<pair<TID, TID>> terms(o.ops);
+        for (auto &t : terms) {
+            t.first = zipf(random);
+            t.second = zipf(random);
+        }
+
+        benchIterator("simple_scan", terms, [&](TID a, TID) {
+            return new SimpleIterator(segment, a);
+        }, results);
+        benchJumps(segment, terms, results);
+        benchIterator("and", terms, [&](TID a, TID b) {
+            return new AndIterator(new SimpleIterator(segment, a), new SimpleIterator(segment, b));
+        }, results);
+        benchIterator("or", terms, [&](TID a, TID b) {
+            return new OrIterator(new SimpleIterator(segment, a), new SimpleIterator(segment, b));
+        }, results);
+        benchIterator("and_not", terms, [&](TID a, TID b) {
+            return new AndIterator(new SimpleIterator(segment, a), new NotIterator(new SimpleIterator(segment, b)));
+        }, results);
+        benchIterator("quote", terms, [&](TID a, TID b) {
+            return newQuoteIterator(segment, {a, b}, 2);
+        }, results);
+        benchRank(&index, zipf, random, o.ops, false, results);
+        benchRank(&index, zipf, random, o.ops, true, results);
+    }
+
+    for (auto &r : results) {
+        cout << r.name << ": " << (size_t)r.unitsPerSec() << " " << r.unit << "/s, latency p50 " << r.percentile(50)
+             << " ns, p99 " << r.percentile(99) << " ns";
+        if (r.bytesPerPosting >= 0) cout << ", " << r.bytesPerPosting << " bytes/posting";
+        cout << endl;
+    }
+
+    if (o.json == "-") {
+        writeJson(cout, o, results);
+    } else if (!o.json.empty()) {
+        ofstream fout(o.json);
+        writeJson(fout, o, results);
+    }
+    return 0;
+}
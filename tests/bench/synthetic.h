@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstdint>
+#include <cmath>
+#include <vector>
+#include <string>
+
+using namespace std;
+
+
+/*
+ * Random numbers that are the same on every platform for a seed: the
+ * distributions of <random> are implementation defined, these are not.
+ */
+class Random {
+private:
+    uint64_t state;
+public:
+    explicit Random(uint64_t seed) : state(seed) {}
+
+    static uint64_t mix(uint64_t x) {
+        x += 0x9e3779b97f4a7c15ULL;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+
+    /* Independent stream number i of the seed, e.g. one per document */
+    static Random stream(uint64_t seed, uint64_t i) {
+        return Random(mix(seed ^ mix(i)));
+    }
+
+    uint64_t next() {
+        state += 0x9e3779b97f4a7c15ULL;
+        uint64_t x = state;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+
+    /* [0, 1) */
+    double uniform() {
+        return (next() >> 11) * (1.0 / (1ULL << 53));
+    }
+
+    /* [0, n) */
+    uint64_t below(uint64_t n) {
+        return (uint64_t)(((unsigned __int128)next() * n) >> 64);
+    }
+
+    double normal() {
+        double u = 1.0 - uniform();
+        return sqrt(-2.0 * log(u)) * cos(2.0 * M_PI * uniform());
+    }
+
+    /* Log-normal with the mean, sigma is of the underlying normal */
+    double logNormal(double mean, double sigma) {
+        return exp(log(mean) - sigma * sigma / 2 + sigma * normal());
+    }
+};
+
+
+/* Ranks 0..n-1 with P(r) ~ 1 / (r + 1)^s, alias method so a draw is O(1) */
+class Zipf {
+private:
+    vector<double> prob;
+    vector<uint32_t> alias;
+public:
+    Zipf(uint32_t n, double s) : prob(n), alias(n) {
+        vector<double> w(n);
+        double sum = 0;
+        for (uint32_t r = 0; r < n; r++) {
+            w[r] = pow(r + 1.0, -s);
+            sum += w[r];
+        }
+
+        vector<uint32_t> small, large;
+        for (uint32_t r = 0; r < n; r++) {
+            w[r] *= n / sum;
+            (w[r] < 1 ? small : large).push_back(r);
+        }
+        while (!small.empty() && !large.empty()) {
+            uint32_t a = small.back();
+            small.pop_back();
+            uint32_t b = large.back();
+            prob[a] = w[a];
+            alias[a] = b;
+            w[b] -= 1 - w[a];
+            if (w[b] < 1) {
+                large.pop_back();
+                small.push_back(b);
+            }
+        }
+        for (uint32_t r : small) { prob[r] = 1; alias[r] = r; }
+        for (uint32_t r : large) { prob[r] = 1; alias[r] = r; }
+    }
+
+    uint32_t operator()(Random &random) const {
+        uint32_t r = random.below(prob.size());
+        return random.uniform() < prob[r] ? r : alias[r];
+    }
+
+    size_t size() const {
+        return prob.size();
+    }
+};
+
+
+/* Word of the rank, term id of the synthetic index is the rank */
+inline string syntheticWord(uint32_t rank) {
+    return "w" + to_string(rank);
+}
@@ -0,0 +1,136 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <map>
+#include <set>
+#include <algorithm>
+#include "../app/engine/query_parser.h"
+#include "../index_deletions.h"
+
+using namespace std;
+
+
+/*
+ * A deleted document must be dropped at the postings, so neither AND and
+ * quote results nor ranking ever see it and its positions are not read.
+ * The test deletes a document of the index and compares the results of
+ * queries with its terms before and after.
+ * usage: live_docs_test.out index_dir, the index gets the deletions file
+ */
+
+int ERR_NUM = 0;
+
+void check(bool ok, const string &what) {
+    cout << "Test [" << what << "]: " << (ok ? "OK" : "FAIL") << endl;
+    if (!ok) ERR_NUM++;
+}
+
+
+vector<TID> getAll(IndexIterator *it) {
+    vector<TID> v;
+    while (!it->end()) {
+        v.push_back(it->get());
+        it->next();
+    }
+    delete it;
+    return v;
+}
+
+
+vector<TID> getRanked(SegmentedIndex *index, const string &expr) {
+    vector<TID> v;
+    RankDecorator *it = getIterator(index, expr, false);
+    while (it && !it->end()) {
+        v.push_back(it->get());
+        it->next();
+    }
+    delete it;
+    return v;
+}
+
+
+/* Positions files read by the quote, every candidate document is one file */
+uint64_t quotePositionsRead(Index *index, TID a, TID b) {
+    QueryTrace trace;
+    QueryTrace::current = &trace;
+    getAll(new QuoteIterator(index, {a, b}, 2));
+    QueryTrace::current = nullptr;
+    return trace.positionsFilesOpened;
+}
+
+
+vector<TID> without(vector<TID> v, TID id) {
+    v.erase(remove(v.begin(), v.end(), id), v.end());
+    return v;
+}
+
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        cout << "usage: live_docs_test.out index_dir" << endl;
+        return 1;
+    }
+    string dir(argv[1]);
+    remove((dir + Deletions::FILE_PATH).c_str());
+
+    TID docId, externalId, a = 0, b = 0;
+    vector<TID> andBefore, quoteBefore, rankedBefore;
+    uint64_t positionsBefore;
+    {
+        SegmentedIndex segmented(dir);
+        Index *index = segmented.segment(0);
+        docId = (index->getMaxDocId() + 1) / 2;
+        externalId = index->getExternalId(docId);
+
+        // two different terms next to each other in the document
+        auto positions = index->getPositions(docId);
+        map<unsigned int, TID> termAt;
+        for (auto &t : positions.terms) {
+            t.detach();
+            for (; !t.end(); t.next()) termAt[t.get()] = t.termId;
+        }
+        positions.clear();
+        for (auto it = termAt.begin(); next(it) != termAt.end(); ++it) {
+            if (next(it)->first == it->first + 1 && next(it)->second != it->second) {
+                a = it->second;
+                b = next(it)->second;
+                break;
+            }
+        }
+        check(a != b, "document has a phrase of two terms");
+
+        andBefore = getAll(new AndIterator(new SimpleIterator(index, a), new SimpleIterator(index, b)));
+        quoteBefore = getAll(new QuoteIterator(index, {a, b}, 2));
+        rankedBefore = getRanked(&segmented, to_string(a) + " " + to_string(b));
+        positionsBefore = quotePositionsRead(index, a, b);
+
+        check(count(andBefore.begin(), andBefore.end(), docId) == 1, "AND finds the document");
+        check(count(quoteBefore.begin(), quoteBefore.end(), docId) == 1, "quote finds the document");
+        check(count(rankedBefore.begin(), rankedBefore.end(), externalId) == 1, "ranked finds the document");
+    }
+
+    if (!Deletions::write(dir + Deletions::FILE_PATH, {docId})) {
+        cerr << "ERROR: Can't write deletions of '" << dir << "'" << endl;
+        return 1;
+    }
+
+    {
+        SegmentedIndex segmented(dir);
+        Index *index = segmented.segment(0);
+
+        auto andAfter = getAll(new AndIterator(new SimpleIterator(index, a), new SimpleIterator(index, b)));
+        auto quoteAfter = getAll(new QuoteIterator(index, {a, b}, 2));
+        auto rankedAfter = getRanked(&segmented, to_string(a) + " " + to_string(b));
+
+        check(andAfter == without(andBefore, docId), "AND drops the deleted document");
+        check(quoteAfter == without(quoteBefore, docId), "quote drops the deleted document");
+        check(quotePositionsRead(index, a, b) == positionsBefore - 1, "quote reads no positions of the deleted document");
+        check(count(rankedAfter.begin(), rankedAfter.end(), externalId) == 0, "ranked drops the deleted document");
+        check(rankedAfter.size() == rankedBefore.size() - 1, "ranked keeps the other documents");
+    }
+
+    remove((dir + Deletions::FILE_PATH).c_str());
+
+    cout << "Errors: " << ERR_NUM << endl;
+    return ERR_NUM == 0 ? 0 : 1;
+}
@@ -8,6 +8,9 @@
 
 using namespace std;
 
+Index INDEX(WORK_DIR);
+
+
 struct TestItem {
     string testName;
     function<void(ostream&)> f;
@@ -36,7 +39,7 @@ vector<TestItem> tests = {
     {
         "москва",
         [](ostream &cout) {
-            IndexIterator *it = new SimpleIterator(4242477);
+            IndexIterator *it = new SimpleIterator(&INDEX, 4242477);
             getAll(it, cout);
         },
         "1.test"
@@ -44,7 +47,7 @@ vector<TestItem> tests = {
     {
         "что && где",
         [](ostream &cout) {
-            IndexIterator *it = new AndIterator(new SimpleIterator(4243081), new SimpleIterator(4243049));
+            IndexIterator *it = new AndIterator(new SimpleIterator(&INDEX, 4243081), new SimpleIterator(&INDEX, 4243049));
             getAll(it, cout);
         },
         "2.test"
@@ -52,8 +55,8 @@ vector<TestItem> tests = {
     {
         "что && где || что && когда",
         [](ostream &cout) {
-            IndexIterator *a = new AndIterator(new SimpleIterator(4243081), new SimpleIterator(4243049));
-            IndexIterator *b = new AndIterator(new SimpleIterator(4243081), new SimpleIterator(4243026));
+            IndexIterator *a = new AndIterator(new SimpleIterator(&INDEX, 4243081), new SimpleIterator(&INDEX, 4243049));
+            IndexIterator *b = new AndIterator(new SimpleIterator(&INDEX, 4243081), new SimpleIterator(&INDEX, 4243026));
             IndexIterator *it = new OrIterator(a, b);
             getAll(it, cout);
         },
@@ -62,7 +65,7 @@ vector<TestItem> tests = {
     {
         "\"москва слезам верит\" 4",
         [](ostream &cout) {
-            IndexIterator *it = new QuoteIterator({4242477, 4075889, 4228378}, 4);
+            IndexIterator *it = new QuoteIterator(&INDEX, {4242477, 4075889, 4228378}, 4);
             getAll(it, cout);
         },
         "4.test"
@@ -70,7 +73,7 @@ vector<TestItem> tests = {
     {
         "\"москва слезам не верит\" 4",
         [](ostream &cout) {
-            IndexIterator *it = new QuoteIterator({4242477, 4075889, 4243084, 4228378}, 4);
+            IndexIterator *it = new QuoteIterator(&INDEX, {4242477, 4075889, 4243084, 4228378}, 4);
             getAll(it, cout);
         },
         "5.test"
@@ -78,7 +81,7 @@ vector<TestItem> tests = {
     {
         "\"что где когда\"",
         [](ostream &cout) {
-            IndexIterator *it = new QuoteIterator({4243081, 4243049, 4243026}, 3);
+            IndexIterator *it = new QuoteIterator(&INDEX, {4243081, 4243049, 4243026}, 3);
             //getAll(it, cout);
         },
         "6.test"
@@ -86,7 +89,7 @@ vector<TestItem> tests = {
     // {
     //     "\"быть или не\"",
     //     [](ostream &cout) {
-    //         IndexIterator *it = new QuoteIterator({1219117, 1668634, 2125081}, 4);
+    //         IndexIterator *it = new QuoteIterator(&INDEX, {1219117, 1668634, 2125081}, 4);
     //         getAll(it, cout);
     //     },
     //     "7.test"
@@ -94,7 +97,7 @@ vector<TestItem> tests = {
     // {
     //     "\"быть или не быть\"",
     //     [](ostream &cout) {
-    //         IndexIterator *it = new QuoteIterator({1219117, 1668634, 2125081, 1219117}, 4);
+    //         IndexIterator *it = new QuoteIterator(&INDEX, {1219117, 1668634, 2125081, 1219117}, 4);
     //         getAll(it, cout);
     //     },
     //     "8.test"
@@ -102,7 +105,7 @@ vector<TestItem> tests = {
     {
         "слезам",
         [](ostream &cout) {
-            IndexIterator *it = new SimpleIterator(4075889);
+            IndexIterator *it = new SimpleIterator(&INDEX, 4075889);
             getAll(it, cout);
         },
         "9.test"
@@ -110,7 +113,7 @@ vector<TestItem> tests = {
     {
         "не",
         [](ostream &cout) {
-            IndexIterator *it = new SimpleIterator(4243084);
+            IndexIterator *it = new SimpleIterator(&INDEX, 4243084);
             getAll(it, cout);
         },
         "10.test"
@@ -118,7 +121,7 @@ vector<TestItem> tests = {
     {
         "верит",
         [](ostream &cout) {
-            IndexIterator *it = new SimpleIterator(4228378);
+            IndexIterator *it = new SimpleIterator(&INDEX, 4228378);
             getAll(it, cout);
         },
         "11.test"
@@ -126,7 +129,7 @@ vector<TestItem> tests = {
     // {
     //     "москва && слезам",
     //     [](ostream &cout) {
-    //         IndexIterator *it = new AndIterator(new SimpleIterator(2069902), new SimpleIterator(2720450));
+    //         IndexIterator *it = new AndIterator(new SimpleIterator(&INDEX, 2069902), new SimpleIterator(&INDEX, 2720450));
     //         getAll(it, cout);
     //     },
     //     "12.test"
@@ -134,7 +137,7 @@ vector<TestItem> tests = {
     // {
     //     "москва && не",
     //     [](ostream &cout) {
-    //         IndexIterator *it = new AndIterator(new SimpleIterator(2069902), new SimpleIterator(2125081));
+    //         IndexIterator *it = new AndIterator(new SimpleIterator(&INDEX, 2069902), new SimpleIterator(&INDEX, 2125081));
     //         getAll(it, cout);
     //     },
     //     "13.test"
@@ -142,7 +145,7 @@ vector<TestItem> tests = {
     // {
     //     "слезам && не",
     //     [](ostream &cout) {
-    //         IndexIterator *it = new AndIterator(new SimpleIterator(2720450), new SimpleIterator(2125081));
+    //         IndexIterator *it = new AndIterator(new SimpleIterator(&INDEX, 2720450), new SimpleIterator(&INDEX, 2125081));
     //         getAll(it, cout);
     //     },
     //     "14.test"
@@ -150,8 +153,8 @@ vector<TestItem> tests = {
     // {
     //     "москва && слезам && не",
     //     [](ostream &cout) {
-    //         IndexIterator *a = new AndIterator(new SimpleIterator(2069902), new SimpleIterator(2720450));
-    //         IndexIterator *it = new AndIterator(a, new SimpleIterator(2125081));
+    //         IndexIterator *a = new AndIterator(new SimpleIterator(&INDEX, 2069902), new SimpleIterator(&INDEX, 2720450));
+    //         IndexIterator *it = new AndIterator(a, new SimpleIterator(&INDEX, 2125081));
     //         getAll(it, cout);
     //     },
     //     "15.test"
@@ -159,8 +162,8 @@ vector<TestItem> tests = {
     // {
     //     "москва && слезам && верит",
     //     [](ostream &cout) {
-    //         IndexIterator *a = new AndIterator(new SimpleIterator(2069902), new SimpleIterator(2720450));
-    //         IndexIterator *it = new AndIterator(a, new SimpleIterator(1255913));
+    //         IndexIterator *a = new AndIterator(new SimpleIterator(&INDEX, 2069902), new SimpleIterator(&INDEX, 2720450));
+    //         IndexIterator *it = new AndIterator(a, new SimpleIterator(&INDEX, 1255913));
     //         getAll(it, cout);
     //     },
     //     "16.test"
@@ -168,8 +171,8 @@ vector<TestItem> tests = {
     // {
     //     "москва && слезам && не && верит",
     //     [](ostream &cout) {
-    //         IndexIterator *a = new AndIterator(new SimpleIterator(2069902), new SimpleIterator(2720450));
-    //         IndexIterator *b = new AndIterator(new SimpleIterator(2125081), new SimpleIterator(1255913));
+    //         IndexIterator *a = new AndIterator(new SimpleIterator(&INDEX, 2069902), new SimpleIterator(&INDEX, 2720450));
+    //         IndexIterator *b = new AndIterator(new SimpleIterator(&INDEX, 2125081), new SimpleIterator(&INDEX, 1255913));
     //         IndexIterator *it = new AndIterator(a, b);
     //         getAll(it, cout);
     //     },
@@ -178,7 +181,7 @@ vector<TestItem> tests = {
     {
         "москва && москва",
         [](ostream &cout) {
-            IndexIterator *it = new AndIterator(new SimpleIterator(4242477), new SimpleIterator(4242477));
+            IndexIterator *it = new AndIterator(new SimpleIterator(&INDEX, 4242477), new SimpleIterator(&INDEX, 4242477));
             getAll(it, cout);
         },
         "18.test"
@@ -186,10 +189,10 @@ vector<TestItem> tests = {
     // {
     //     "(! \"москва слезам не верит\" 4 || (где || когда)) && что",
     //     [](ostream &cout) {
-    //         IndexIterator *a = new NotIterator(new QuoteIterator({2069902, 2720450, 2125081, 1255913}, 4));
-    //         IndexIterator *b = new OrIterator(new SimpleIterator(1369257), new SimpleIterator(1799149));
+    //         IndexIterator *a = new NotIterator(new QuoteIterator(&INDEX, {2069902, 2720450, 2125081, 1255913}, 4));
+    //         IndexIterator *b = new OrIterator(new SimpleIterator(&INDEX, 1369257), new SimpleIterator(&INDEX, 1799149));
     //         IndexIterator *it = new OrIterator(a, b);
-    //         it = new AndIterator(it, new SimpleIterator(3098799));
+    //         it = new AndIterator(it, new SimpleIterator(&INDEX, 3098799));
     //         getAll(it, cout);
     //     },
     //     "19.test"
@@ -197,9 +200,9 @@ vector<TestItem> tests = {
     // {
     //     "(быть && не) && (или && что) && (где && когда)",
     //     [](ostream &cout) {
-    //         IndexIterator *a = new AndIterator(new SimpleIterator(1219117), new SimpleIterator(2125081));
-    //         IndexIterator *b = new AndIterator(new SimpleIterator(1668634), new SimpleIterator(3098799));
-    //         IndexIterator *c = new AndIterator(new SimpleIterator(1369257), new SimpleIterator(1799149));
+    //         IndexIterator *a = new AndIterator(new SimpleIterator(&INDEX, 1219117), new SimpleIterator(&INDEX, 2125081));
+    //         IndexIterator *b = new AndIterator(new SimpleIterator(&INDEX, 1668634), new SimpleIterator(&INDEX, 3098799));
+    //         IndexIterator *c = new AndIterator(new SimpleIterator(&INDEX, 1369257), new SimpleIterator(&INDEX, 1799149));
     //         IndexIterator *it = new AndIterator(a, b);
     //         it = new AndIterator(it, c);
     //         getAll(it, cout);
@@ -209,11 +212,11 @@ vector<TestItem> tests = {
     // {
     //     "((((быть && не) && или) && что) && где) && когда",
     //     [](ostream &cout) {
-    //         IndexIterator *it = new AndIterator(new SimpleIterator(1219117), new SimpleIterator(2125081));
-    //         it = new AndIterator(it, new SimpleIterator(1668634));
-    //         it = new AndIterator(it, new SimpleIterator(3098799));
-    //         it = new AndIterator(it, new SimpleIterator(1369257));
-    //         it = new AndIterator(it, new SimpleIterator(1799149));
+    //         IndexIterator *it = new AndIterator(new SimpleIterator(&INDEX, 1219117), new SimpleIterator(&INDEX, 2125081));
+    //         it = new AndIterator(it, new SimpleIterator(&INDEX, 1668634));
+    //         it = new AndIterator(it, new SimpleIterator(&INDEX, 3098799));
+    //         it = new AndIterator(it, new SimpleIterator(&INDEX, 1369257));
+    //         it = new AndIterator(it, new SimpleIterator(&INDEX, 1799149));
     //         getAll(it, cout);
     //     },
     //     "21.test"
@@ -221,7 +224,7 @@ vector<TestItem> tests = {
     // {
     //     "и && медведь",
     //     [](ostream &cout) {
-    //         IndexIterator *it = new AndIterator(new SimpleIterator(1643361), new SimpleIterator(2003227));
+    //         IndexIterator *it = new AndIterator(new SimpleIterator(&INDEX, 1643361), new SimpleIterator(&INDEX, 2003227));
     //         getAll(it, cout);
     //     },
     //     "22.test"
@@ -229,7 +232,7 @@ vector<TestItem> tests = {
     // {
     //     "википедия && аквамариновый",
     //     [](ostream &cout) {
-    //         IndexIterator *it = new AndIterator(new SimpleIterator(1271737), new SimpleIterator(1011528));
+    //         IndexIterator *it = new AndIterator(new SimpleIterator(&INDEX, 1271737), new SimpleIterator(&INDEX, 1011528));
     //         getAll(it, cout);
     //     },
     //     "23.test"
@@ -237,7 +240,7 @@ vector<TestItem> tests = {
     // {
     //     "аквамариновый && медведь",
     //     [](ostream &cout) {
-    //         IndexIterator *it = new AndIterator(new SimpleIterator(1011528), new SimpleIterator(2003227));
+    //         IndexIterator *it = new AndIterator(new SimpleIterator(&INDEX, 1011528), new SimpleIterator(&INDEX, 2003227));
     //         getAll(it, cout);
     //     },
     //     "24.test"
@@ -245,8 +248,8 @@ vector<TestItem> tests = {
     // {
     //     "(аквамариновый && медведь) && википедия",
     //     [](ostream &cout) {
-    //         IndexIterator *it = new AndIterator(new SimpleIterator(1011528), new SimpleIterator(2003227));
-    //         it = new AndIterator(it, new SimpleIterator(1271737));
+    //         IndexIterator *it = new AndIterator(new SimpleIterator(&INDEX, 1011528), new SimpleIterator(&INDEX, 2003227));
+    //         it = new AndIterator(it, new SimpleIterator(&INDEX, 1271737));
     //         getAll(it, cout);
     //     },
     //     "25.test"
@@ -254,8 +257,8 @@ vector<TestItem> tests = {
     // {
     //     "аквамариновый && (медведь && википедия)",
     //     [](ostream &cout) {
-    //         IndexIterator *it = new AndIterator(new SimpleIterator(2003227), new SimpleIterator(1271737));
-    //         it = new AndIterator(it, new SimpleIterator(1011528));
+    //         IndexIterator *it = new AndIterator(new SimpleIterator(&INDEX, 2003227), new SimpleIterator(&INDEX, 1271737));
+    //         it = new AndIterator(it, new SimpleIterator(&INDEX, 1011528));
     //         getAll(it, cout);
     //     },
     //     "26.test"
@@ -263,8 +266,8 @@ vector<TestItem> tests = {
     // {
     //     "(и && в) && (а && на)",
     //     [](ostream &cout) {
-    //         IndexIterator *a = new AndIterator(new SimpleIterator(1643361), new SimpleIterator(1222741));
-    //         IndexIterator *b = new AndIterator(new SimpleIterator(978768), new SimpleIterator(2092054));
+    //         IndexIterator *a = new AndIterator(new SimpleIterator(&INDEX, 1643361), new SimpleIterator(&INDEX, 1222741));
+    //         IndexIterator *b = new AndIterator(new SimpleIterator(&INDEX, 978768), new SimpleIterator(&INDEX, 2092054));
     //         IndexIterator *it = new AndIterator(a, b);
     //         getAll(it, cout);
     //     },
@@ -273,7 +276,7 @@ vector<TestItem> tests = {
     // {
     //     "википедия && чеитина",
     //     [](ostream &cout) {
-    //         IndexIterator *it = new AndIterator(new SimpleIterator(1271737), new SimpleIterator(3082065));
+    //         IndexIterator *it = new AndIterator(new SimpleIterator(&INDEX, 1271737), new SimpleIterator(&INDEX, 3082065));
     //         getAll(it, cout);
     //     },
     //     "28.test"
@@ -281,7 +284,7 @@ vector<TestItem> tests = {
     // {
     //     "википедия && медведь",
     //     [](ostream &cout) {
-    //         IndexIterator *it = new AndIterator(new SimpleIterator(1271737), new SimpleIterator(2003227));
+    //         IndexIterator *it = new AndIterator(new SimpleIterator(&INDEX, 1271737), new SimpleIterator(&INDEX, 2003227));
     //         getAll(it, cout);
     //     },
     //     "29.test"
@@ -289,7 +292,7 @@ vector<TestItem> tests = {
     // {
     //     "википедия && и",
     //     [](ostream &cout) {
-    //         IndexIterator *it = new AndIterator(new SimpleIterator(1271737), new SimpleIterator(1643361));
+    //         IndexIterator *it = new AndIterator(new SimpleIterator(&INDEX, 1271737), new SimpleIterator(&INDEX, 1643361));
     //         getAll(it, cout);
     //     },
     //     "30.test"
@@ -0,0 +1,56 @@
+# Random texts and their tokens by text_cleaner/make_tokens.py, two lines
+# per case: the text, then the tokens separated by spaces.
+#
+# usage: python3 tokenizer_cases.py [cases] [seed] | ./tokenizer_test.out
+
+import os
+import random
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'text_cleaner'))
+from make_tokens import tokenize
+
+
+RANGES = [
+    (0x20, 0x7E),        # ASCII
+    (0xA0, 0x24F),       # Latin-1 and Latin Extended
+    (0x300, 0x36F),      # combining marks
+    (0x370, 0x3FF),      # Greek
+    (0x3A3, 0x3A3),      # capital sigma
+    (0x400, 0x4FF),      # Cyrillic
+    (0x1E00, 0x1FFF),    # Latin and Greek Extended
+    (0x2000, 0x2BFF),    # punctuation, symbols, letterlike
+    (0x3000, 0x30FF),    # CJK punctuation, kana
+    (0x4E00, 0x4E80),    # CJK
+    (0xAC00, 0xD7A3),    # Hangul
+    (0xF900, 0xFFEF),    # compatibility forms
+    (0x10000, 0x104FF),  # Linear B to Osmanya, Deseret
+    (0x1D400, 0x1D7FF),  # mathematical alphanumerics
+    (0x1F000, 0x1FAFF),  # emoji
+    (0x20000, 0x20100),  # CJK extension B
+    (0x2F800, 0x2FA1F),  # CJK compatibility supplement
+    (0xE0000, 0xE01EF),  # tags and variation selectors
+]
+
+
+def random_text(rnd):
+    chars = []
+    for _ in range(rnd.randint(1, 16)):
+        lo, hi = rnd.choice(RANGES)
+        chars.append(chr(rnd.randint(lo, hi)))
+    return ''.join(chars)
+
+
+def main():
+    cases = int(sys.argv[1]) if len(sys.argv) > 1 else 10000
+    rnd = random.Random(int(sys.argv[2]) if len(sys.argv) > 2 else 1)
+    out = open(sys.stdout.fileno(), 'w', encoding='utf-8', newline='\n')
+    for _ in range(cases):
+        text = random_text(rnd)
+        out.write(text + '\n')
+        out.write(' '.join(tokenize(text)) + '\n')
+    out.close()
+
+
+if __name__ == '__main__':
+    main()
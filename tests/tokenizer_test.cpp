@@ -0,0 +1,41 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../index_builder/tokenizer.h"
+
+using namespace std;
+
+
+/*
+ * Tokenizer of the index builder against text_cleaner/make_tokens.py:
+ * reads the cases of tokenizer_cases.py, a text and its tokens separated
+ * by spaces, and prints the texts tokenized differently.
+ * usage: python3 tokenizer_cases.py | tokenizer_test.out
+ */
+
+const int MAX_PRINTED = 20;
+
+
+int main() {
+    Tokenizer tokenizer;
+    string text, expected;
+    int casesNum = 0, errNum = 0;
+
+    while (getline(cin, text) && getline(cin, expected)) {
+        string got;
+        tokenizer.tokenize(text.data(), text.size(), [&](const string &token) {
+            if (!got.empty()) got += ' ';
+            got += token;
+        });
+
+        casesNum++;
+        if (got != expected) {
+            if (++errNum <= MAX_PRINTED) {
+                cout << "Test [" << text << "]: FAIL, got [" << got << "], expected [" << expected << "]" << endl;
+            }
+        }
+    }
+
+    cout << "Cases: " << casesNum << ", errors: " << errNum << endl;
+    return casesNum > 0 && errNum == 0 ? 0 : 1;
+}
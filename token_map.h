@@ -0,0 +1,341 @@
+#pragma once
+
+#include <cstdio>
+#include <iostream>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <unordered_map>
+#include <algorithm>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+
+/*
+ * Token to term id dictionary as a CHD perfect hash over a string pool,
+ * compiled by make_token_map and mapped as is, so a lookup is one hash of
+ * the token and one compare with the pool.
+ *
+ * File: Header, displacements of buckets, slots, offsets of terms in the
+ * pool (termsNum + 1), the pool of tokens and terms. A token goes to the
+ * bucket of its hash, the displacement (d0, d1) of the bucket gives its
+ * slot (f1 + d0 * f2 + d1) % slotsNum.
+ */
+class TokenMap {
+public:
+    static const uint32_t MAGIC = 0x4b4f5457; // "WTOK"
+    static const uint32_t VERSION = 1;
+    static const uint32_t NO_TERM = -1;
+
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+
+        uint32_t tokensNum;
+        uint32_t termsNum;
+        uint32_t bucketsNum;
+        uint32_t slotsNum;
+        uint32_t seed;
+        uint32_t reserved;
+
+        uint64_t poolSize;
+    };
+
+    struct Slot {
+        uint32_t offset;
+        uint32_t length;
+        uint32_t termId;
+    };
+private:
+    static const unsigned int BUCKET_SIZE = 4;
+    static const unsigned int MAX_SEEDS = 16;
+    static const uint32_t MAX_D0 = 1 << 8;
+    static const uint32_t MAX_D1 = 1 << 16;
+
+    std::vector<char> buffer;
+    void *mapped;
+    size_t mappedSize;
+
+    const Header *header;
+    const uint32_t *displacements;
+    const Slot *slots;
+    const uint32_t *termOffsets;
+    const char *pool;
+
+    static uint64_t mix(uint64_t h) {
+        h ^= h >> 30;
+        h *= 0xbf58476d1ce4e5b9ULL;
+        h ^= h >> 27;
+        h *= 0x94d049bb133111ebULL;
+        return h ^ (h >> 31);
+    }
+
+    static uint64_t hash(const char *s, size_t n, uint32_t seed) {
+        uint64_t h = 14695981039346656037ULL ^ mix(seed);
+        for (size_t i = 0; i < n; i++) {
+            h ^= (unsigned char)s[i];
+            h *= 1099511628211ULL;
+        }
+        return mix(h);
+    }
+
+    static uint32_t slotOf(uint64_t h, uint32_t d, uint32_t slotsNum) {
+        uint64_t f1 = (uint32_t)h % slotsNum;
+        uint64_t f2 = mix(h) % slotsNum;
+        return (f1 + (d >> 16) * f2 + (d & 0xFFFF)) % slotsNum;
+    }
+
+    void attach(const char *data) {
+        header = (const Header*)data;
+        displacements = (const uint32_t*)(data + sizeof(Header));
+        slots = (const Slot*)(displacements + header->bucketsNum);
+        termOffsets = (const uint32_t*)(slots + header->slotsNum);
+        pool = (const char*)(termOffsets + header->termsNum + 1);
+    }
+
+    void close() {
+        if (mapped) {
+            munmap(mapped, mappedSize);
+            mapped = nullptr;
+        }
+        buffer.clear();
+        header = nullptr;
+    }
+
+    /* Displacements of buckets of the seed, false if some bucket doesn't fit */
+    static bool place(
+        const std::vector<uint64_t> &hashes, uint32_t bucketsNum, uint32_t slotsNum,
+        std::vector<uint32_t> &displacements, std::vector<uint32_t> &slotOfToken)
+    {
+        std::vector<std::vector<uint32_t>> buckets(bucketsNum);
+        for (uint32_t i = 0; i < hashes.size(); i++) {
+            buckets[(hashes[i] >> 32) % bucketsNum].push_back(i);
+        }
+
+        std::vector<uint32_t> order(bucketsNum);
+        for (uint32_t b = 0; b < bucketsNum; b++) order[b] = b;
+        std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+            return buckets[a].size() > buckets[b].size();
+        });
+
+        std::vector<bool> taken(slotsNum, false);
+        std::vector<uint32_t> positions;
+        displacements.assign(bucketsNum, 0);
+        slotOfToken.assign(hashes.size(), 0);
+
+        for (uint32_t b : order) {
+            auto &bucket = buckets[b];
+            if (bucket.empty()) break;
+
+            bool placed = false;
+            for (uint32_t d0 = 0; d0 < MAX_D0 && !placed; d0++) {
+                for (uint32_t d1 = 0; d1 < std::min(MAX_D1, slotsNum) && !placed; d1++) {
+                    uint32_t d = (d0 << 16) | d1;
+                    positions.clear();
+                    for (uint32_t i : bucket) {
+                        uint32_t s = slotOf(hashes[i], d, slotsNum);
+                        if (taken[s] || std::find(positions.begin(), positions.end(), s) != positions.end()) break;
+                        positions.push_back(s);
+                    }
+                    if (positions.size() != bucket.size()) continue;
+
+                    for (size_t k = 0; k < bucket.size(); k++) {
+                        taken[positions[k]] = true;
+                        slotOfToken[bucket[k]] = positions[k];
+                    }
+                    displacements[b] = d;
+                    placed = true;
+                }
+            }
+            if (!placed) return false;
+        }
+        return true;
+    }
+public:
+    TokenMap() : mapped(nullptr), mappedSize(0), header(nullptr) {}
+
+    ~TokenMap() {
+        close();
+    }
+
+    TokenMap(const TokenMap&) = delete;
+    TokenMap& operator=(const TokenMap&) = delete;
+
+    /*
+     * Token and term lists of make_dictionary.sh: the term of a token is on
+     * the same line, term ids go in the order of the first occurrence.
+     */
+    static bool readText(
+        const std::string &tokensFile, const std::string &termsFile,
+        std::vector<std::pair<std::string, uint32_t>> &tokens, std::vector<std::string> &terms)
+    {
+        std::ifstream finTokens(tokensFile);
+        std::ifstream finTerms(termsFile);
+        if (!finTokens || !finTerms) return false;
+
+        std::unordered_map<std::string, uint32_t> termsId;
+        std::unordered_map<std::string, size_t> tokenPos;
+        std::string token, term;
+
+        while (finTokens >> token) {
+            if (!(finTerms >> term)) {
+                std::cerr << tokensFile << " is bigger than " << termsFile << " but should be equal" << std::endl;
+                break;
+            }
+
+            auto it = termsId.find(term);
+            uint32_t termId;
+            if (it == termsId.end()) {
+                termId = terms.size();
+                termsId[term] = termId;
+                terms.push_back(term);
+            } else {
+                termId = it->second;
+            }
+
+            auto pos = tokenPos.find(token);
+            if (pos == tokenPos.end()) {
+                tokenPos[token] = tokens.size();
+                tokens.emplace_back(token, termId);
+            } else {
+                tokens[pos->second].second = termId;
+            }
+        }
+
+        if (finTerms >> term) {
+            std::cerr << termsFile << " is bigger than " << tokensFile << " but should be equal" << std::endl;
+        }
+        return true;
+    }
+
+    /* Compiled map of unique tokens, false if the pool is too big or no seed works */
+    static bool build(const std::vector<std::pair<std::string, uint32_t>> &tokens, const std::vector<std::string> &terms, std::vector<char> &out) {
+        Header h;
+        memset(&h, 0, sizeof(Header));
+        h.magic = MAGIC;
+        h.version = VERSION;
+        h.tokensNum = tokens.size();
+        h.termsNum = terms.size();
+        h.bucketsNum = tokens.size() / BUCKET_SIZE + 1;
+        h.slotsNum = tokens.size() + tokens.size() / 100 + 1;
+
+        for (auto &t : tokens) h.poolSize += t.first.size();
+        for (auto &t : terms) h.poolSize += t.size();
+        if (h.poolSize > UINT32_MAX) return false;
+
+        std::vector<uint64_t> hashes(tokens.size());
+        std::vector<uint32_t> displacements;
+        std::vector<uint32_t> slotOfToken;
+        bool placed = false;
+        for (h.seed = 0; h.seed < MAX_SEEDS && !placed; h.seed++) {
+            for (size_t i = 0; i < tokens.size(); i++) {
+                hashes[i] = hash(tokens[i].first.data(), tokens[i].first.size(), h.seed);
+            }
+            placed = place(hashes, h.bucketsNum, h.slotsNum, displacements, slotOfToken);
+        }
+        if (!placed) return false;
+        h.seed--;
+
+        std::vector<Slot> slots(h.slotsNum, Slot{0, 0, NO_TERM});
+        std::vector<uint32_t> termOffsets;
+        std::string pool;
+        for (size_t i = 0; i < tokens.size(); i++) {
+            slots[slotOfToken[i]] = Slot{(uint32_t)pool.size(), (uint32_t)tokens[i].first.size(), tokens[i].second};
+            pool += tokens[i].first;
+        }
+        for (auto &t : terms) {
+            termOffsets.push_back(pool.size());
+            pool += t;
+        }
+        termOffsets.push_back(pool.size());
+
+        out.clear();
+        auto append = [&](const void *data, size_t size) {
+            out.insert(out.end(), (const char*)data, (const char*)data + size);
+        };
+        append(&h, sizeof(Header));
+        append(displacements.data(), displacements.size() * sizeof(uint32_t));
+        append(slots.data(), slots.size() * sizeof(Slot));
+        append(termOffsets.data(), termOffsets.size() * sizeof(uint32_t));
+        append(pool.data(), pool.size());
+        return true;
+    }
+
+    static bool write(const std::string &path, const std::vector<char> &data) {
+        FILE *fout = fopen(path.c_str(), "wb");
+        if (!fout) return false;
+        bool ok = fwrite(data.data(), 1, data.size(), fout) == data.size();
+        return fclose(fout) == 0 && ok;
+    }
+
+    /* Map compiled in memory */
+    bool assign(std::vector<char> &&data) {
+        close();
+        buffer = std::move(data);
+        if (buffer.size() < sizeof(Header) || ((Header*)buffer.data())->magic != MAGIC) {
+            buffer.clear();
+            return false;
+        }
+        attach(buffer.data());
+        return true;
+    }
+
+    /* Map compiled to a file, mapped without reading */
+    bool open(const std::string &path) {
+        close();
+
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+
+        struct stat st;
+        if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(Header)) {
+            ::close(fd);
+            return false;
+        }
+
+        mappedSize = st.st_size;
+        mapped = mmap(nullptr, mappedSize, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (mapped == MAP_FAILED) {
+            mapped = nullptr;
+            return false;
+        }
+
+        const Header *h = (const Header*)mapped;
+        if (h->magic != MAGIC || h->version != VERSION) {
+            close();
+            return false;
+        }
+        attach((const char*)mapped);
+        return true;
+    }
+
+    uint32_t find(const char *s, size_t n) const {
+        if (header->tokensNum == 0) return NO_TERM;
+        uint64_t h = hash(s, n, header->seed);
+        uint32_t d = displacements[(h >> 32) % header->bucketsNum];
+        const Slot &slot = slots[slotOf(h, d, header->slotsNum)];
+        if (slot.length != n || memcmp(pool + slot.offset, s, n) != 0) return NO_TERM;
+        return slot.termId;
+    }
+
+    uint32_t find(const std::string &s) const {
+        return find(s.data(), s.size());
+    }
+
+    size_t tokensNum() const {
+        return header->tokensNum;
+    }
+
+    size_t termsNum() const {
+        return header->termsNum;
+    }
+
+    std::string term(uint32_t termId) const {
+        return std::string(pool + termOffsets[termId], termOffsets[termId + 1] - termOffsets[termId]);
+    }
+};